@@ -165,6 +165,62 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoall.
+ *
+ * \param sendbuf The buffer containing the data to be sent to each unit,
+ *                \c nelem values for every unit in the order of unit ids.
+ * \param recvbuf The buffer to hold the data received from each unit.
+ * \param nelem   Number of values sent to and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the alltoall.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI alltoallv.
+ *
+ * Counts and displacements may exceed \c INT_MAX. Units agree whether
+ * this is the case at any unit before the values are exchanged.
+ *
+ * \param sendbuf     The buffer containing the data to be sent to each unit.
+ * \param nsendcounts Array containing the number of values to send to
+ *                    each unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the data received from each unit.
+ * \param nrecvcounts Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param team        The team to participate in the alltoallv.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       team) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI allreduce.
  *
@@ -213,6 +269,38 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI_Exscan.
+ *
+ * Computes the exclusive prefix reduction of the values in \c sendbuf of
+ * all units in \c team in the order of their unit ids, i.e. unit \c i
+ * receives the result of <tt>op(v_0, ..., v_{i-1})</tt>.
+ * The content of \c recvbuf is undefined on the first unit in \c team.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the result of the
+ *                element-wise prefix reduction in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and
+ *                \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and
+ *                \c recvbuf.
+ * \param op      The reduce operation to perform, which does not have to
+ *                be commutative.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team) DART_NOTHROW;
+
 /** \} */
 
 /**
@@ -277,6 +365,40 @@ dart_ret_t dart_accumulate_blocking_local(
   dart_datatype_t  dtype,
   dart_operation_t op) DART_NOTHROW;
 
+/**
+ * Perform an element-wise atomic update on \c nelem values at the element
+ * offsets \c offsets relative to the address pointed to by \c gptr by
+ * applying the operation \c op with the corresponding value in \c values
+ * on them.
+ * All updates are issued in a single operation on the target unit.
+ *
+ * DART Equivalent to MPI_Accumulate with an indexed target data type.
+ * As in \ref dart_accumulate, the operation is not completed before a
+ * call to \ref dart_flush.
+ *
+ * \param gptr    A global pointer determining the base address of the
+ *                target elements.
+ * \param values  The local buffer holding the \c nelem elements to
+ *                accumulate.
+ * \param nelem   The number of elements to accumulate.
+ * \param offsets The distinct offsets of the target elements in number of
+ *                elements relative to \c gptr.
+ * \param dtype   The data type to use in the accumulate operation \c op.
+ * \param op      The accumulation operation to perform.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_accumulate_indexed(
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nelem,
+  const size_t   * offsets,
+  dart_datatype_t  dtype,
+  dart_operation_t op) DART_NOTHROW;
+
 /**
  * Perform an element-wise atomic update on the value of type \c dtype pointed
  * to by \c gptr by applying the operation \c op with \c value on it and
@@ -694,6 +816,177 @@ dart_ret_t dart_handle_free(
 
 /** \} */
 
+/**
+ * \name Non-blocking collective operations using handles
+ * The handle can be used to wait for the local completion of the operation
+ * using \c dart_wait_local, \c dart_test_local etc. Buffers passed to the
+ * operation must not be accessed before its completion.
+ */
+
+/** \{ */
+
+/**
+ * 'HANDLE' variant of dart_barrier.
+ * The barrier is complete once all units in \c team entered it.
+ *
+ * \param team        The team to perform a barrier on.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait_local, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_barrier_handle(
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of dart_bcast.
+ *
+ * \param buf    Buffer that is the source (on \c root) or the destination of
+ *               the broadcast.
+ * \param nelem  The number of values to broadcast/receive.
+ * \param dtype  The data type of values in \c buf.
+ * \param root   The unit that broadcasts data to all other members in \c team
+ * \param team   The team to participate in the broadcast.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait_local, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_bcast_handle(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of dart_allgather.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of values sent by each process and received from
+ *                each unit. Must not exceed \c INT_MAX.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the allgather.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait_local, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_allgather_handle(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of dart_allreduce.
+ * The operation \c op and data type \c dtype must not be destroyed before
+ * the operation completed.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from
+ *                each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use
+ *                in \c op.
+ * \param op      The reduction operation to perform.
+ * \param team    The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait_local, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_allreduce_handle(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handle) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of dart_alltoall.
+ *
+ * \param sendbuf The buffer containing the data to be sent to each unit,
+ *                \c nelem values for every unit in the order of unit ids.
+ * \param recvbuf The buffer to hold the data received from each unit.
+ * \param nelem   Number of values sent to and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the alltoall.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait_local, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoall_handle(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of dart_alltoallv.
+ * The arrays of counts and displacements may be released before the
+ * operation completed.
+ * Counts and displacements may exceed \c INT_MAX, units agree whether
+ * this is the case at any unit when the operation is started.
+ *
+ * \param sendbuf     The buffer containing the data to be sent to each unit.
+ * \param nsendcounts Array containing the number of values to send to
+ *                    each unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the data received from each unit.
+ * \param nrecvcounts Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param team        The team to participate in the alltoallv.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait_local, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv_handle(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
@@ -802,6 +1095,57 @@ dart_ret_t dart_recv(
   int                  tag,
   dart_global_unit_t   unit) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI send on the communicator of a team.
+ *
+ * Messages sent to a team are only matched by receives on the same team.
+ *
+ * \param sendbuf Buffer containing the data to be sent by the unit.
+ * \param nelem   Number of values sent to the specified unit.
+ * \param dtype   The data type of values in \c sendbuf.
+ * \param tag     Message tag for the distinction between different messages.
+ * \param team    Team of the sending and the receiving unit.
+ * \param unit    Unit in \c team the message is sent to.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_team_send(
+  const void         * sendbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_team_t          team,
+  dart_team_unit_t     unit) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI recv with source \c MPI_ANY_SOURCE on the
+ * communicator of a team.
+ *
+ * \param recvbuf Buffer for the incoming data, may be \c NULL if
+ *                \c nelem is 0.
+ * \param nelem   Number of values received by the unit
+ * \param dtype   The data type of values in \c recvbuf.
+ * \param tag     Message tag for the distinction between different messages.
+ * \param team    Team of the sending and the receiving unit.
+ * \param unit    Output parameter, the unit in \c team that sent the
+ *                received message. May be \c NULL.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_team_recv_any(
+  void               * recvbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_team_t          team,
+  dart_team_unit_t   * unit) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI sendrecv.
  *
@@ -397,6 +397,41 @@ dart_ret_t dart_team_memregister(
   void            * addr,
   dart_gptr_t     * gptr) DART_NOTHROW;
 
+/**
+ * Collective function, attaches multiple segments of external memory
+ * previously allocated by the user.
+ * Same as calling \ref dart_team_memregister for every segment but
+ * exchanges the addresses of all segments in a single collective
+ * operation.
+ * All units in the team must register the same number of segments,
+ * segments may be empty.
+ * Does not perform any memory allocation.
+ * If registration fails at any unit, no segment is registered at any
+ * unit.
+ *
+ * \param teamid  The team to participate in the collective operation.
+ * \param nsegs   The number of segments to attach, identical at all units.
+ * \param nlelem  The number of local elements in every segment.
+ * \param dtype   The data type of elements in the segments.
+ * \param addrs   Pointers to the pre-allocated segments to be registered.
+ * \param gptrs   Array of \c nsegs global pointer objects to set up.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \see dart_team_memregister
+ * \see dart_team_memderegister
+ *
+ * \threadsafe_none
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_team_memregister_segments(
+  dart_team_t       teamid,
+  size_t            nsegs,
+  const size_t    * nlelem,
+  dart_datatype_t   dtype,
+  void           ** addrs,
+  dart_gptr_t     * gptrs) DART_NOTHROW;
+
 /**
  * Collective function similar to dart_team_memfree() but on previously
  * externally allocated memory.
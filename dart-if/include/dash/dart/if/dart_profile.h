@@ -0,0 +1,196 @@
+#ifndef DART__IF__PROFILE_H__
+#define DART__IF__PROFILE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_util.h>
+
+/**
+ * \file dart_profile.h
+ *
+ * \defgroup  DartProfile  DART communication profiling interface
+ * \ingroup   DartInterface
+ *
+ * Interface to query counters of calls, transferred bytes and latencies
+ * of DART communication operations.
+ *
+ * Profiling support is compiled in if DART has been built with the
+ * CMake option \c ENABLE_DART_PROFILING and is disabled at runtime by
+ * default.
+ * It is enabled at startup if the environment variable \c DART_PROFILE
+ * is set to \c 1 or \c on, or by calling \ref dart_profile_enable.
+ *
+ * If profiling has been enabled at startup, the counters of every unit
+ * are written in \ref dart_exit to the standard error stream or, if the
+ * environment variable \c DART_PROFILE_PATH is set, to the file
+ * \c dart_profile.u<unit>.txt in the specified directory.
+ *
+ * Latencies of non-blocking operations only include issuing the
+ * operation, their completion is accounted to the flush or wait
+ * operations.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \cond DART_HIDDEN_SYMBOLS */
+#define DART_INTERFACE_ON
+/** \endcond */
+
+/**
+ * Profiled DART communication operations.
+ *
+ * \ingroup DartProfile
+ */
+typedef enum
+{
+  /* One-sided operations, profiled per target unit: */
+  DART_PROFILE_OP_GET = 0,
+  DART_PROFILE_OP_GET_BLOCKING,
+  DART_PROFILE_OP_GET_HANDLE,
+  DART_PROFILE_OP_PUT,
+  DART_PROFILE_OP_PUT_BLOCKING,
+  DART_PROFILE_OP_PUT_HANDLE,
+  DART_PROFILE_OP_ACCUMULATE,
+  DART_PROFILE_OP_FETCH_AND_OP,
+  DART_PROFILE_OP_COMPARE_AND_SWAP,
+  DART_PROFILE_OP_FLUSH,
+  DART_PROFILE_OP_FLUSH_LOCAL,
+  DART_PROFILE_OP_SEND,
+  DART_PROFILE_OP_RECV,
+  /** Number of operations profiled per target unit, not an operation! */
+  DART_PROFILE_OP_LAST_UNIT,
+  /* Operations on all units: */
+  DART_PROFILE_OP_FLUSH_ALL = DART_PROFILE_OP_LAST_UNIT,
+  DART_PROFILE_OP_FLUSH_LOCAL_ALL,
+  DART_PROFILE_OP_WAIT,
+  DART_PROFILE_OP_WAIT_LOCAL,
+  DART_PROFILE_OP_WAITALL,
+  DART_PROFILE_OP_WAITALL_LOCAL,
+  DART_PROFILE_OP_BARRIER,
+  DART_PROFILE_OP_BCAST,
+  DART_PROFILE_OP_SCATTER,
+  DART_PROFILE_OP_GATHER,
+  DART_PROFILE_OP_ALLGATHER,
+  DART_PROFILE_OP_ALLGATHERV,
+  DART_PROFILE_OP_ALLTOALL,
+  DART_PROFILE_OP_ALLTOALLV,
+  DART_PROFILE_OP_ALLREDUCE,
+  DART_PROFILE_OP_REDUCE,
+  DART_PROFILE_OP_EXSCAN,
+  DART_PROFILE_OP_SENDRECV,
+  /** Number of profiled operations, not an operation! */
+  DART_PROFILE_OP_LAST
+} dart_profile_op_t;
+
+/**
+ * Number of bins in latency histograms.
+ *
+ * \ingroup DartProfile
+ */
+#define DART_PROFILE_NUM_BINS 16
+
+/**
+ * Lower bound of latencies in nanoseconds counted in bin \c b of latency
+ * histograms.
+ * Bin 0 counts latencies below 256 ns, bin \c b counts latencies in
+ * [128 * 2^b, 256 * 2^b) ns and the final bin all latencies above.
+ *
+ * \ingroup DartProfile
+ */
+#define DART_PROFILE_BIN_NS(b) ((b) == 0 ? 0 : ((uint64_t)128 << (b)))
+
+/**
+ * Counters of a profiled operation.
+ *
+ * \ingroup DartProfile
+ */
+typedef struct
+{
+  /** Number of calls */
+  uint64_t num_calls;
+  /** Number of calls served by the calling unit or shared memory windows
+   *  instead of MPI one-sided or point-to-point operations */
+  uint64_t num_shmem;
+  /** Number of bytes transferred by or contributed to the operation */
+  uint64_t num_bytes;
+  /** Accumulated latency of all calls in nanoseconds */
+  uint64_t total_ns;
+  /** Maximum latency of a call in nanoseconds */
+  uint64_t max_ns;
+  /** Histogram of call latencies, see \ref DART_PROFILE_BIN_NS */
+  uint64_t latency_hist[DART_PROFILE_NUM_BINS];
+} dart_profile_counters_t;
+
+/**
+ * Enable or disable profiling of communication operations at runtime.
+ *
+ * \return \c DART_OK on success, \c DART_ERR_INVAL if profiling support
+ *         has not been compiled in.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_enable(bool enable) DART_NOTHROW;
+
+/**
+ * Whether profiling of communication operations is enabled.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_is_enabled(bool * enabled) DART_NOTHROW;
+
+/**
+ * Reset all profiling counters of the calling unit.
+ *
+ * \threadsafe_none
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_reset() DART_NOTHROW;
+
+/**
+ * Counters of the specified operation accumulated over all target units.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_counters(
+  dart_profile_op_t         op,
+  dart_profile_counters_t * counters) DART_NOTHROW;
+
+/**
+ * Counters of the specified operation targeting the given unit.
+ * Only available for operations preceding \c DART_PROFILE_OP_LAST_UNIT.
+ *
+ * \return \c DART_OK on success, \c DART_ERR_INVAL if the operation is
+ *         not profiled per target unit.
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+dart_ret_t dart_profile_unit_counters(
+  dart_profile_op_t         op,
+  dart_global_unit_t        unit,
+  dart_profile_counters_t * counters) DART_NOTHROW;
+
+/**
+ * Name of the specified operation, e.g. \c "dart_get".
+ *
+ * \threadsafe
+ * \ingroup DartProfile
+ */
+const char * dart_profile_op_name(dart_profile_op_t op) DART_NOTHROW;
+
+/** \cond DART_HIDDEN_SYMBOLS */
+#define DART_INTERFACE_OFF
+/** \endcond */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DART__IF__PROFILE_H__ */
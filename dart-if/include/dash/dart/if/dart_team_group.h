@@ -400,6 +400,59 @@ dart_ret_t dart_team_clone(
   dart_team_t   team,
   dart_team_t * newteam) DART_NOTHROW;
 
+/**
+ * Algorithms of collective operations of a team.
+ *
+ * \ingroup DartGroupTeam
+ */
+typedef enum {
+  /** Collective operations on the communicator of the whole team */
+  DART_COLL_FLAT = 0,
+  /**
+   * Two-level collective operations: units on the same node exchange data
+   * through shared memory, one leader unit per node communicates with the
+   * leaders of the other nodes.
+   * Applies to \ref dart_barrier, \ref dart_bcast and
+   * \ref dart_allreduce with predefined reduce operations.
+   */
+  DART_COLL_HIERARCHICAL
+} dart_coll_algorithm_t;
+
+/**
+ * Select the algorithm used for collective operations of the specified
+ * team. The default algorithm is \ref DART_COLL_FLAT unless environment
+ * variable \c DART_COLL_HIERARCHICAL is set to \c 1 or \c on.
+ *
+ * This call is collective on the specified team.
+ *
+ * \param teamid    The team to configure.
+ * \param algorithm The algorithm of subsequent collective operations.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartGroupTeam
+ */
+dart_ret_t dart_team_set_coll_algorithm(
+  dart_team_t             teamid,
+  dart_coll_algorithm_t   algorithm) DART_NOTHROW;
+
+/**
+ * Query the algorithm used for collective operations of the specified
+ * team.
+ *
+ * \param      teamid    The team to query.
+ * \param[out] algorithm The algorithm of collective operations.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartGroupTeam
+ */
+dart_ret_t dart_team_get_coll_algorithm(
+  dart_team_t             teamid,
+  dart_coll_algorithm_t * algorithm) DART_NOTHROW;
+
 /**
  * Return the unit id of the caller in the specified team.
  *
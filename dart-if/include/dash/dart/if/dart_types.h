@@ -761,6 +761,37 @@ dart_type_create_custom(
 dart_ret_t
 dart_type_destroy(dart_datatype_t *dart_type);
 
+/**
+ * Statistics of the caches of underlying communication data types that are
+ * created for transfers of strided data types.
+ *
+ * \ingroup DartTypes
+ */
+typedef struct
+{
+  /// number of transfers that reused a cached communication data type
+  uint64_t hits;
+  /// number of transfers that required a new communication data type
+  uint64_t misses;
+  /// number of cached communication data types released to make room
+  uint64_t evictions;
+}
+dart_type_cache_stats_t;
+
+/**
+ * Query the accumulated statistics of the caches of communication data
+ * types created for transfers of strided data types.
+ *
+ * \param[out] stats The cache statistics of the calling unit.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_type_cache_stats(dart_type_cache_stats_t *stats);
+
 /**
  * The operator called from a reduction operation.
  * The operator should apply the intended operation to each of the \c len
@@ -0,0 +1,114 @@
+/**
+ * \file dart_coll_hier_priv.h
+ *
+ * Hierarchical (node-aware) collective operations.
+ *
+ * Units on the same node exchange data through a shared memory window,
+ * the first unit of every node (node leader) performs the collective
+ * operation with the leaders of the other nodes:
+ *
+ * \code
+ *   allreduce:  copy to shared slot -> partial reduction of slots
+ *               -> allreduce among leaders -> copy from shared result
+ *   bcast:      root copies to shared result -> bcast among leaders
+ *               -> copy from shared result
+ *   barrier:    node barrier -> barrier among leaders -> node barrier
+ * \endcode
+ *
+ * Buffers exceeding the size of a shared slot are processed in chunks.
+ */
+#ifndef DART__MPI__COLL_HIER_PRIV_H__
+#define DART__MPI__COLL_HIER_PRIV_H__
+
+#include <mpi.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_team_group.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+
+/**
+ * Size in bytes of the shared memory slot of a unit used to exchange
+ * data within a node.
+ */
+#ifndef DART_COLL_HIER_SLOT_SIZE
+#define DART_COLL_HIER_SLOT_SIZE (64 * 1024)
+#endif
+
+typedef struct dart_coll_hier {
+  /// Units of the team on the same node
+  MPI_Comm   node_comm;
+  /// Node leaders of the team, \c MPI_COMM_NULL on other units
+  MPI_Comm   leader_comm;
+  /// Rank of the unit in \c node_comm
+  int        node_rank;
+  /// Number of units in \c node_comm
+  int        node_size;
+  /// Number of nodes of the team
+  int        num_nodes;
+  /// Rank of the node leader in \c leader_comm for every unit of the team
+  int      * node_of_unit;
+  /// Shared memory window allocated by the node leader
+  MPI_Win    win;
+  /// Shared slots of the units of the node, followed by two result buffers
+  char     * slots;
+  /// Number of collective operations on the shared buffers, selects the
+  /// result buffer
+  unsigned   seq;
+} dart_coll_hier_t;
+
+/**
+ * Set up hierarchical collective operations of the given team,
+ * collective on the team.
+ */
+DART_INTERNAL
+dart_ret_t dart__mpi__coll_hier_init(dart_team_data_t * team_data);
+
+/**
+ * Release resources of hierarchical collective operations of the given
+ * team, collective on the team.
+ */
+DART_INTERNAL
+dart_ret_t dart__mpi__coll_hier_fini(dart_team_data_t * team_data);
+
+/**
+ * Set up hierarchical collective operations of a newly created team if
+ * requested in environment variable \c DART_COLL_HIERARCHICAL.
+ */
+DART_INTERNAL
+dart_ret_t dart__mpi__coll_hier_init_default(dart_team_data_t * team_data);
+
+/**
+ * Whether \c dart_allreduce of the given operation and type can use the
+ * hierarchical algorithm.
+ */
+DART_INTERNAL
+bool dart__mpi__coll_hier_allreduce_supported(
+  dart_operation_t   op,
+  dart_datatype_t    dtype);
+
+DART_INTERNAL
+dart_ret_t dart__mpi__coll_hier_barrier(
+  dart_team_data_t * team_data);
+
+DART_INTERNAL
+dart_ret_t dart__mpi__coll_hier_bcast(
+  void             * buf,
+  size_t             nbytes,
+  dart_team_unit_t   root,
+  dart_team_data_t * team_data);
+
+DART_INTERNAL
+dart_ret_t dart__mpi__coll_hier_allreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_data_t * team_data);
+
+#endif /* DART__MPI__COLL_HIER_PRIV_H__ */
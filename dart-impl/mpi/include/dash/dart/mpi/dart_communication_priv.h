@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <mpi.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include <dash/dart/base/macro.h>
 #include <dash/dart/base/logging.h>
@@ -77,6 +78,28 @@ dart_ret_t dart__mpi__op_fini();
 
 #define DART_MPI_TYPE_UNDEFINED (MPI_Datatype)MPI_UNDEFINED
 
+/**
+ * The maximum number of MPI vector types cached for every strided DART type.
+ */
+#ifndef DART_MPI_STRIDED_CACHE_SIZE
+#define DART_MPI_STRIDED_CACHE_SIZE 8
+#endif
+
+/**
+ * Committed MPI vector type created for transfers of a specific number of
+ * blocks of a strided DART type.
+ */
+typedef struct {
+  /// the committed MPI vector type
+  MPI_Datatype         mpi_type;
+  /// the number of blocks in the MPI vector type
+  size_t               num_blocks;
+  /// value of the cache clock at the most recent use of this entry
+  uint64_t             last_use;
+  /// the number of transfers currently using the MPI type
+  int                  refcnt;
+} dart_strided_cache_entry_t;
+
 typedef enum {
   DART_KIND_BASIC = 0,
   DART_KIND_STRIDED,
@@ -103,10 +126,15 @@ typedef struct dart_datatype_struct {
     } contiguous;
     /// used for DART_KIND_STRIDED
     /// NOTE: the underlying MPI strided type is created dynamically based on
-    ///       the number of blocks required.
+    ///       the number of blocks required and cached for subsequent
+    ///       transfers of the same number of blocks.
     struct {
       /// the stride between blocks of size \c num_elem
       int              stride;
+      /// the number of valid entries in \c cache
+      int              cache_size;
+      /// MPI vector types of recently used numbers of blocks
+      dart_strided_cache_entry_t cache[DART_MPI_STRIDED_CACHE_SIZE];
     } strided;
     /// used for DART_KIND_INDEXED
     struct {
@@ -206,13 +234,26 @@ size_t dart__mpi__datatype_num_elem(dart_datatype_t dart_type) {
   return (dart__mpi__datatype_struct(dart_type)->num_elem);
 }
 
+/**
+ * Returns a committed MPI vector type of \c num_blocks blocks of the strided
+ * type \c dart_type. The MPI type is taken from the cache of \c dart_type
+ * if possible and has to be returned using
+ * \ref dart__mpi__release_strided_mpi once the operation using it has been
+ * started.
+ */
 MPI_Datatype
 dart__mpi__create_strided_mpi(
   dart_datatype_t dart_type,
   size_t          num_blocks) DART_INTERNAL;
 
+/**
+ * Returns an MPI type obtained from \ref dart__mpi__create_strided_mpi.
+ * The MPI type is freed unless it is held in the cache of \c dart_type.
+ */
 void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type) DART_INTERNAL;
+dart__mpi__release_strided_mpi(
+  dart_datatype_t   dart_type,
+  MPI_Datatype    * mpi_type) DART_INTERNAL;
 
 DART_INLINE
 void
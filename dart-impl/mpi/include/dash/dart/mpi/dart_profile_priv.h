@@ -0,0 +1,94 @@
+/**
+ * \file dart_profile_priv.h
+ *
+ * Recording of communication profiling counters, see dart_profile.h.
+ *
+ * Profiled code regions are enclosed in \c DART_PROFILE_BEGIN and
+ * \c DART_PROFILE_END which expand to no-ops if profiling support has
+ * not been compiled in:
+ *
+ * \code
+ *   DART_PROFILE_BEGIN(prof_ts);
+ *   MPI_Get(...);
+ *   DART_PROFILE_END(prof_ts, DART_PROFILE_OP_GET, teamid, unit,
+ *                    nbytes, false);
+ * \endcode
+ */
+#ifndef DART__MPI__PROFILE_PRIV_H__
+#define DART__MPI__PROFILE_PRIV_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_profile.h>
+
+#if defined(DART_ENABLE_PROFILING)
+
+/** Whether profiling is enabled at runtime */
+extern bool dart__mpi__profile_on;
+
+DART_INLINE uint64_t dart__mpi__profile_now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Record a call of a profiled operation started at timestamp \c ts_begin.
+ * Pass \c DART_UNDEFINED_UNIT_ID as unit for operations without a single
+ * target unit.
+ */
+DART_INTERNAL
+void dart__mpi__profile_record(
+  dart_profile_op_t op,
+  uint64_t          ts_begin,
+  dart_team_t       teamid,
+  dart_unit_t       team_unit,
+  size_t            nbytes,
+  bool              shmem);
+
+/**
+ * Read runtime configuration of profiling from the environment, to be
+ * called in \c dart_init.
+ */
+DART_INTERNAL
+dart_ret_t dart__mpi__profile_init();
+
+/**
+ * Write counters if profiling has been enabled at startup and release
+ * counters, to be called in \c dart_exit.
+ */
+DART_INTERNAL
+dart_ret_t dart__mpi__profile_fini();
+
+#define DART_PROFILE_BEGIN(_ts)                                       \
+  uint64_t _ts = dart__unlikely(dart__mpi__profile_on)                \
+                 ? dart__mpi__profile_now() : 0
+
+#define DART_PROFILE_END(_ts, _op, _teamid, _unit, _nbytes, _shmem)   \
+  do {                                                                \
+    if (dart__unlikely(_ts != 0)) {                                   \
+      dart__mpi__profile_record(                                      \
+        (_op), (_ts), (_teamid), (_unit), (_nbytes), (_shmem));       \
+    }                                                                 \
+  } while (0)
+
+#else // !defined(DART_ENABLE_PROFILING)
+
+#define dart__mpi__profile_init() DART_OK
+#define dart__mpi__profile_fini() DART_OK
+
+#define DART_PROFILE_BEGIN(_ts)                                       \
+  do { } while (0)
+
+#define DART_PROFILE_END(_ts, _op, _teamid, _unit, _nbytes, _shmem)   \
+  do { } while (0)
+
+#endif // defined(DART_ENABLE_PROFILING)
+
+#endif /* DART__MPI__PROFILE_PRIV_H__ */
@@ -186,6 +186,12 @@ typedef struct dart_team_data {
 
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+  /**
+   * @brief State of hierarchical collective operations, NULL if
+   * collective operations use the flat algorithm.
+   */
+  struct dart_coll_hier *coll_hier;
+
   dart_unit_t unitid;
 
   int         size;
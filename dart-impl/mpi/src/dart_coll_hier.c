@@ -0,0 +1,312 @@
+/**
+ * \file dart_coll_hier.c
+ *
+ * Implementation of hierarchical (node-aware) collective operations,
+ * see dart_coll_hier_priv.h.
+ */
+#include <mpi.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_team_group.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
+#include <dash/dart/mpi/dart_coll_hier_priv.h>
+
+#define CHECK_MPI_RET(__call, __name)                      \
+  do {                                                     \
+    if (dart__unlikely(__call != MPI_SUCCESS)) {           \
+      DART_LOG_ERROR("%s ! %s failed!", __func__, __name); \
+      return DART_ERR_OTHER;                               \
+    }                                                      \
+  } while (0)
+
+/**
+ * Result buffer of the current collective operation on the shared
+ * buffers. Subsequent operations alternate between two result buffers so
+ * a unit may write the result buffer of an operation while other units
+ * still read the result of the previous operation.
+ */
+static inline char * dart__mpi__coll_hier_result(dart_coll_hier_t * hier)
+{
+  return hier->slots +
+         (size_t)(hier->node_size + (hier->seq % 2)) *
+           DART_COLL_HIER_SLOT_SIZE;
+}
+
+/**
+ * Synchronize the units of a node and their view of the shared buffers.
+ */
+static inline dart_ret_t dart__mpi__coll_hier_node_sync(
+  dart_coll_hier_t * hier)
+{
+  CHECK_MPI_RET(MPI_Win_sync(hier->win), "MPI_Win_sync");
+  CHECK_MPI_RET(MPI_Barrier(hier->node_comm), "MPI_Barrier");
+  CHECK_MPI_RET(MPI_Win_sync(hier->win), "MPI_Win_sync");
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__coll_hier_init(dart_team_data_t * team_data)
+{
+  if (team_data->coll_hier != NULL) {
+    return DART_OK;
+  }
+#if defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  DART_LOG_ERROR("dart__mpi__coll_hier_init ! "
+                 "hierarchical collectives require MPI shared windows");
+  return DART_ERR_INVAL;
+#else
+  if (team_data->sharedmem_comm == MPI_COMM_NULL) {
+    DART_LOG_ERROR("dart__mpi__coll_hier_init ! "
+                   "no shared memory communicator in team %d",
+                   team_data->teamid);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart__mpi__coll_hier_init() team:%d", team_data->teamid);
+
+  dart_coll_hier_t * hier = calloc(1, sizeof(dart_coll_hier_t));
+  hier->leader_comm = MPI_COMM_NULL;
+
+  CHECK_MPI_RET(
+    MPI_Comm_dup(team_data->sharedmem_comm, &hier->node_comm),
+    "MPI_Comm_dup");
+  MPI_Comm_rank(hier->node_comm, &hier->node_rank);
+  MPI_Comm_size(hier->node_comm, &hier->node_size);
+
+  // Leaders are ordered by their unit id in the team:
+  CHECK_MPI_RET(
+    MPI_Comm_split(
+      team_data->comm,
+      (hier->node_rank == 0) ? 0 : MPI_UNDEFINED,
+      team_data->unitid,
+      &hier->leader_comm),
+    "MPI_Comm_split");
+
+  int node_info[2] = { 0, 0 };
+  if (hier->leader_comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(hier->leader_comm, &node_info[0]);
+    MPI_Comm_size(hier->leader_comm, &node_info[1]);
+  }
+  CHECK_MPI_RET(
+    MPI_Bcast(node_info, 2, MPI_INT, 0, hier->node_comm),
+    "MPI_Bcast");
+  hier->num_nodes    = node_info[1];
+  hier->node_of_unit = malloc(team_data->size * sizeof(int));
+  CHECK_MPI_RET(
+    MPI_Allgather(
+      &node_info[0], 1, MPI_INT,
+      hier->node_of_unit, 1, MPI_INT,
+      team_data->comm),
+    "MPI_Allgather");
+
+  // Slots of all units of the node and the two result buffers are
+  // allocated contiguously by the node leader:
+  MPI_Aint win_size = (hier->node_rank == 0)
+                      ? (MPI_Aint)(hier->node_size + 2) *
+                          DART_COLL_HIER_SLOT_SIZE
+                      : 0;
+  char * baseptr;
+  CHECK_MPI_RET(
+    MPI_Win_allocate_shared(
+      win_size, 1, MPI_INFO_NULL, hier->node_comm, &baseptr, &hier->win),
+    "MPI_Win_allocate_shared");
+  MPI_Aint leader_size;
+  int      disp_unit;
+  CHECK_MPI_RET(
+    MPI_Win_shared_query(
+      hier->win, 0, &leader_size, &disp_unit, &hier->slots),
+    "MPI_Win_shared_query");
+  CHECK_MPI_RET(
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, hier->win),
+    "MPI_Win_lock_all");
+
+  team_data->coll_hier = hier;
+  DART_LOG_DEBUG("dart__mpi__coll_hier_init > team:%d nodes:%d "
+                 "node size:%d", team_data->teamid, hier->num_nodes,
+                 hier->node_size);
+  return DART_OK;
+#endif // defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+}
+
+dart_ret_t dart__mpi__coll_hier_fini(dart_team_data_t * team_data)
+{
+  dart_coll_hier_t * hier = team_data->coll_hier;
+  if (hier == NULL) {
+    return DART_OK;
+  }
+  DART_LOG_DEBUG("dart__mpi__coll_hier_fini() team:%d", team_data->teamid);
+  MPI_Win_unlock_all(hier->win);
+  MPI_Win_free(&hier->win);
+  if (hier->leader_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&hier->leader_comm);
+  }
+  MPI_Comm_free(&hier->node_comm);
+  free(hier->node_of_unit);
+  free(hier);
+  team_data->coll_hier = NULL;
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__coll_hier_init_default(dart_team_data_t * team_data)
+{
+  const char * envstr = getenv("DART_COLL_HIERARCHICAL");
+  if (envstr != NULL &&
+      (strcmp(envstr, "1") == 0 || strcmp(envstr, "on") == 0)) {
+    return dart__mpi__coll_hier_init(team_data);
+  }
+  return DART_OK;
+}
+
+bool dart__mpi__coll_hier_allreduce_supported(
+  dart_operation_t   op,
+  dart_datatype_t    dtype)
+{
+  // Partial results are combined in arbitrary order, restricted to the
+  // predefined reduce operations which are commutative:
+  return (op >= DART_OP_MIN && op <= DART_OP_LXOR &&
+          dart__mpi__datatype_isbasic(dtype));
+}
+
+dart_ret_t dart__mpi__coll_hier_barrier(
+  dart_team_data_t * team_data)
+{
+  dart_coll_hier_t * hier = team_data->coll_hier;
+  CHECK_MPI_RET(MPI_Barrier(hier->node_comm), "MPI_Barrier");
+  if (hier->num_nodes > 1) {
+    if (hier->leader_comm != MPI_COMM_NULL) {
+      CHECK_MPI_RET(MPI_Barrier(hier->leader_comm), "MPI_Barrier");
+    }
+    CHECK_MPI_RET(MPI_Barrier(hier->node_comm), "MPI_Barrier");
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__coll_hier_bcast(
+  void             * buf,
+  size_t             nbytes,
+  dart_team_unit_t   root,
+  dart_team_data_t * team_data)
+{
+  dart_coll_hier_t * hier      = team_data->coll_hier;
+  char             * data      = (char *)buf;
+  int                root_node = hier->node_of_unit[root.id];
+  bool               is_root   = (team_data->unitid == root.id);
+  dart_ret_t         ret;
+
+  for (size_t offset = 0; offset < nbytes;
+       offset += DART_COLL_HIER_SLOT_SIZE) {
+    size_t len = nbytes - offset;
+    if (len > DART_COLL_HIER_SLOT_SIZE) {
+      len = DART_COLL_HIER_SLOT_SIZE;
+    }
+    char * result = dart__mpi__coll_hier_result(hier);
+    if (is_root) {
+      memcpy(result, data + offset, len);
+    }
+    ret = dart__mpi__coll_hier_node_sync(hier);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    if (hier->num_nodes > 1) {
+      if (hier->leader_comm != MPI_COMM_NULL) {
+        CHECK_MPI_RET(
+          MPI_Bcast(result, (int)len, MPI_BYTE, root_node,
+                    hier->leader_comm),
+          "MPI_Bcast");
+      }
+      ret = dart__mpi__coll_hier_node_sync(hier);
+      if (ret != DART_OK) {
+        return ret;
+      }
+    }
+    if (!is_root) {
+      memcpy(data + offset, result, len);
+    }
+    hier->seq++;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__coll_hier_allreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_data_t * team_data)
+{
+  dart_coll_hier_t * hier      = team_data->coll_hier;
+  MPI_Op             mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype       mpi_dtype = dart__mpi__op_type(op, dtype);
+  size_t             esize     = dart__mpi__datatype_sizeof(dtype);
+  // DART_OP_MINMAX combines pairs of elements:
+  size_t             grain     = (op == DART_OP_MINMAX) ? 2 : 1;
+  size_t             chunk     = (DART_COLL_HIER_SLOT_SIZE / (esize * grain))
+                                 * grain;
+  const char       * src       = (const char *)sendbuf;
+  char             * dst       = (char *)recvbuf;
+  char             * slot      = hier->slots +
+                                 (size_t)hier->node_rank *
+                                   DART_COLL_HIER_SLOT_SIZE;
+  dart_ret_t         ret;
+
+  for (size_t offset = 0; offset < nelem; offset += chunk) {
+    size_t count = nelem - offset;
+    if (count > chunk) {
+      count = chunk;
+    }
+    char * result = dart__mpi__coll_hier_result(hier);
+    memcpy(slot, src + offset * esize, count * esize);
+    ret = dart__mpi__coll_hier_node_sync(hier);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    // Every unit of the node reduces a section of the elements:
+    size_t ngrains   = count / grain;
+    size_t sec_begin = (ngrains * hier->node_rank / hier->node_size)
+                       * grain;
+    size_t sec_end   = (ngrains * (hier->node_rank + 1) / hier->node_size)
+                       * grain;
+    if (sec_end > sec_begin) {
+      size_t sec_offs = sec_begin * esize;
+      memcpy(result + sec_offs, hier->slots + sec_offs,
+             (sec_end - sec_begin) * esize);
+      for (int r = 1; r < hier->node_size; ++r) {
+        CHECK_MPI_RET(
+          MPI_Reduce_local(
+            hier->slots + (size_t)r * DART_COLL_HIER_SLOT_SIZE + sec_offs,
+            result + sec_offs,
+            (int)(sec_end - sec_begin),
+            mpi_dtype,
+            mpi_op),
+          "MPI_Reduce_local");
+      }
+    }
+    if (hier->num_nodes > 1) {
+      ret = dart__mpi__coll_hier_node_sync(hier);
+      if (ret != DART_OK) {
+        return ret;
+      }
+      if (hier->leader_comm != MPI_COMM_NULL) {
+        CHECK_MPI_RET(
+          MPI_Allreduce(
+            MPI_IN_PLACE, result, (int)count, mpi_dtype, mpi_op,
+            hier->leader_comm),
+          "MPI_Allreduce");
+      }
+    }
+    ret = dart__mpi__coll_hier_node_sync(hier);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    memcpy(dst + offset * esize, result, count * esize);
+    hier->seq++;
+  }
+  return DART_OK;
+}
@@ -19,6 +19,8 @@
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_profile_priv.h>
+#include <dash/dart/mpi/dart_coll_hier_priv.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
@@ -89,7 +91,7 @@
     free(__ptr);                     \
   } while (0)
 
-/** DART handle type for non-blocking one-sided operations. */
+/** DART handle type for non-blocking operations. */
 struct dart_handle_struct
 {
   MPI_Request reqs[2];   // a large transfer might consist of two operations
@@ -97,8 +99,35 @@ struct dart_handle_struct
   dart_unit_t dest;
   uint8_t     num_reqs;
   bool        needs_flush;
+  // arguments of a non-blocking collective that have to remain valid until
+  // completion, released together with the handle
+  void      * coll_args;
 };
 
+static inline void dart__mpi__handle_free(dart_handle_t handle)
+{
+  free(handle->coll_args);
+  free(handle);
+}
+
+/**
+ * Create a handle for the request of a non-blocking collective operation.
+ * Takes ownership of \c coll_args.
+ */
+static inline dart_handle_t dart__mpi__coll_handle(
+  MPI_Request   req,
+  void        * coll_args)
+{
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->reqs[0]     = req;
+  handle->num_reqs    = 1;
+  handle->win         = MPI_WIN_NULL;
+  handle->dest        = DART_UNDEFINED_UNIT_ID;
+  handle->needs_flush = false;
+  handle->coll_args   = coll_args;
+  return handle;
+}
+
 /**
  * Help to check for return of MPI call.
  * Since DART currently does not define an MPI error handler the abort will not
@@ -112,6 +141,61 @@ struct dart_handle_struct
     }                                                      \
   } while (0)
 
+/**
+ * Number of bytes in \c nelem elements of the base type of \c dtype,
+ * used in profiling counters.
+ */
+static inline size_t dart__mpi__profile_nbytes(
+    size_t          nelem,
+    dart_datatype_t dtype)
+{
+  if (!dart__mpi__datatype_iscontiguous(dtype)) {
+    dtype = dart__mpi__datatype_base(dtype);
+  }
+  return nelem * dart__mpi__datatype_sizeof(dtype);
+}
+
+/**
+ * Sum of \c n counts, used in profiling counters.
+ */
+static inline size_t dart__mpi__profile_sum(
+    const size_t * counts,
+    int            n)
+{
+  size_t sum = 0;
+  for (int i = 0; i < n; ++i) {
+    sum += counts[i];
+  }
+  return sum;
+}
+
+/**
+ * Whether a transfer of contiguous data from or to the given unit is
+ * served by a memcpy instead of MPI, used in profiling counters.
+ */
+static inline bool dart__mpi__profile_shmem(
+    const dart_team_data_t    * team_data,
+    const dart_segment_info_t * seginfo,
+    dart_team_unit_t            team_unit_id,
+    dart_datatype_t             src_type,
+    dart_datatype_t             dst_type)
+{
+  if (!dart__mpi__datatype_iscontiguous(src_type) ||
+      !dart__mpi__datatype_iscontiguous(dst_type)) {
+    return false;
+  }
+  if (team_data->unitid == team_unit_id.id) {
+    return true;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return (seginfo->segid >= 0 &&
+          team_data->sharedmem_tab[team_unit_id.id].id >= 0);
+#else
+  (void)seginfo;
+  return false;
+#endif
+}
+
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 static dart_ret_t get_shared_mem(
@@ -324,12 +408,12 @@ dart__mpi__get_complex(
         win,
         reqs, num_reqs),
       "MPI_Rget");
-  // clean-up strided data types
+  // release strided data types
   if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
+    dart__mpi__release_strided_mpi(src_type, &src_mpi_type);
   }
   if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
+    dart__mpi__release_strided_mpi(dst_type, &dst_mpi_type);
   }
   return DART_OK;
 }
@@ -470,12 +554,12 @@ dart__mpi__put_complex(
         reqs, num_reqs),
       "MPI_Put");
 
-  // clean-up strided data types
+  // release strided data types
   if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
+    dart__mpi__release_strided_mpi(src_type, &src_mpi_type);
   }
   if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
+    dart__mpi__release_strided_mpi(dst_type, &dst_mpi_type);
   }
   return DART_OK;
 }
@@ -516,6 +600,8 @@ dart_ret_t dart_get(
 
   dart_ret_t ret = DART_OK;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   // leave complex data type handling to MPI
   if (dart__mpi__datatype_iscontiguous(src_type) &&
       dart__mpi__datatype_iscontiguous(dst_type)) {
@@ -529,6 +615,12 @@ dart_ret_t dart_get(
         offset, nelem, src_type, dst_type, NULL, NULL);
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_GET, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(nelem, src_type),
+    dart__mpi__profile_shmem(
+      team_data, seginfo, team_unit_id, src_type, dst_type));
+
   DART_LOG_DEBUG("dart_get > finished");
   return ret;
 }
@@ -565,6 +657,8 @@ dart_ret_t dart_put(
 
   dart_ret_t ret = DART_OK;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   if (dart__mpi__datatype_iscontiguous(src_type) &&
       dart__mpi__datatype_iscontiguous(dst_type)) {
     // fast path for basic data types
@@ -579,6 +673,12 @@ dart_ret_t dart_put(
         NULL, NULL, NULL);
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_PUT, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(nelem, src_type),
+    dart__mpi__profile_shmem(
+      team_data, seginfo, team_unit_id, src_type, dst_type));
+
   return ret;
 }
 
@@ -621,6 +721,8 @@ dart_ret_t dart_accumulate(
     return DART_ERR_INVAL;
   }
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -667,6 +769,10 @@ dart_ret_t dart_accumulate(
         "MPI_Accumulate");
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_ACCUMULATE, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
+
   DART_LOG_DEBUG("dart_accumulate > finished");
   return DART_OK;
 }
@@ -712,6 +818,8 @@ dart_ret_t dart_accumulate_blocking_local(
     return DART_ERR_INVAL;
   }
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -765,10 +873,122 @@ dart_ret_t dart_accumulate_blocking_local(
 
   MPI_Waitall(num_reqs, reqs, MPI_STATUSES_IGNORE);
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_ACCUMULATE, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
+
   DART_LOG_DEBUG("dart_accumulate > finished");
   return DART_OK;
 }
 
+dart_ret_t dart_accumulate_indexed(
+    dart_gptr_t      gptr,
+    const void     * values,
+    size_t           nelem,
+    const size_t   * offsets,
+    dart_datatype_t  dtype,
+    dart_operation_t op)
+{
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t    offset = gptr.addr_or_offs.offset;
+  int16_t     seg_id = gptr.segid;
+  dart_team_t teamid = gptr.teamid;
+
+  if (dart__unlikely(op > DART_OP_LAST)) {
+    DART_LOG_ERROR("Custom reduction operators not allowed in "
+                   "dart_accumulate_indexed!");
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_IS_BASICTYPE(dtype);
+  MPI_Op      mpi_op = dart__mpi__op(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not accumulate more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_accumulate_indexed ! failed: nelem (%zu) > INT_MAX",
+                   nelem);
+    return DART_ERR_INVAL;
+  }
+
+  if (nelem == 0) {
+    return DART_OK;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_indexed ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  DART_LOG_DEBUG("dart_accumulate_indexed() nelem:%zu dtype:%ld op:%d "
+                 "unit:%d", nelem, dtype, op, team_unit_id.id);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+      &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_indexed ! "
+        "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  int * displs = malloc(sizeof(int) * nelem);
+  if (dart__unlikely(displs == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_indexed ! "
+                   "failed to allocate %zu displacements", nelem);
+    return DART_ERR_OTHER;
+  }
+  for (size_t i = 0; i < nelem; ++i) {
+    if (dart__unlikely(offsets[i] > INT_MAX)) {
+      DART_LOG_ERROR("dart_accumulate_indexed ! failed: "
+                     "offset (%zu) > INT_MAX", offsets[i]);
+      free(displs);
+      return DART_ERR_INVAL;
+    }
+    displs[i] = (int)offsets[i];
+  }
+
+  DART_PROFILE_BEGIN(prof_ts);
+
+  MPI_Win win = seginfo->win;
+  offset     += dart_segment_disp(seginfo, team_unit_id);
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  MPI_Datatype dst_type;
+  MPI_Type_create_indexed_block(nelem, 1, displs, mpi_dtype, &dst_type);
+  MPI_Type_commit(&dst_type);
+  free(displs);
+
+  DART_LOG_TRACE("dart_accumulate_indexed:  MPI_Accumulate (src %p, size %zu)",
+      values, nelem);
+  int ret = MPI_Accumulate(
+              values,
+              nelem,
+              mpi_dtype,
+              team_unit_id.id,
+              offset,
+              1,
+              dst_type,
+              mpi_op,
+              win);
+  MPI_Type_free(&dst_type);
+  if (dart__unlikely(ret != MPI_SUCCESS)) {
+    DART_LOG_ERROR("dart_accumulate_indexed ! MPI_Accumulate failed");
+    return DART_ERR_INVAL;
+  }
+
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_ACCUMULATE, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
+
+  DART_LOG_DEBUG("dart_accumulate_indexed > finished");
+  return DART_OK;
+}
+
 
 dart_ret_t dart_fetch_and_op(
     dart_gptr_t      gptr,
@@ -814,6 +1034,8 @@ dart_ret_t dart_fetch_and_op(
       dtype, op, team_unit_id.id,
       gptr.addr_or_offs.offset, seg_id);
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -829,6 +1051,10 @@ dart_ret_t dart_fetch_and_op(
         win),
       "MPI_Fetch_and_op");
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_FETCH_AND_OP, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(1, dtype), false);
+
   DART_LOG_DEBUG("dart_fetch_and_op > finished");
   return DART_OK;
 }
@@ -872,6 +1098,8 @@ dart_ret_t dart_compare_and_swap(
     return DART_ERR_INVAL;
   }
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   MPI_Win win  = seginfo->win;
   offset      += dart_segment_disp(seginfo, team_unit_id);
 
@@ -885,6 +1113,10 @@ dart_ret_t dart_compare_and_swap(
         offset,
         win),
       "MPI_Compare_and_swap");
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_COMPARE_AND_SWAP, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(1, dtype), false);
+
   DART_LOG_DEBUG("dart_compare_and_swap > finished");
   return DART_OK;
 }
@@ -936,6 +1168,8 @@ dart_ret_t dart_get_handle(
 
   dart_ret_t ret = DART_OK;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   // leave complex data type handling to MPI
   if (dart__mpi__datatype_iscontiguous(src_type) &&
       dart__mpi__datatype_iscontiguous(dst_type)) {
@@ -951,8 +1185,14 @@ dart_ret_t dart_get_handle(
         handle->reqs, &handle->num_reqs);
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_GET_HANDLE, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(nelem, src_type),
+    dart__mpi__profile_shmem(
+      team_data, seginfo, team_unit_id, src_type, dst_type));
+
   if (handle->num_reqs == 0) {
-    free(handle);
+    dart__mpi__handle_free(handle);
     handle = DART_HANDLE_NULL;
   }
 
@@ -1006,6 +1246,8 @@ dart_ret_t dart_put_handle(
 
   dart_ret_t ret = DART_OK;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   if (dart__mpi__datatype_iscontiguous(src_type) &&
       dart__mpi__datatype_iscontiguous(dst_type)) {
     // fast path for basic data types
@@ -1024,8 +1266,14 @@ dart_ret_t dart_put_handle(
                                  &handle->needs_flush);
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_PUT_HANDLE, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(nelem, src_type),
+    dart__mpi__profile_shmem(
+      team_data, seginfo, team_unit_id, src_type, dst_type));
+
   if (handle->num_reqs == 0) {
-    free(handle);
+    dart__mpi__handle_free(handle);
     handle = DART_HANDLE_NULL;
   }
 
@@ -1080,6 +1328,8 @@ dart_ret_t dart_put_blocking(
   dart_ret_t ret = DART_OK;
   bool needs_flush = false;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   if (dart__mpi__datatype_iscontiguous(src_type) &&
       dart__mpi__datatype_iscontiguous(dst_type)) {
     // fast path for basic data types
@@ -1099,6 +1349,12 @@ dart_ret_t dart_put_blocking(
     CHECK_MPI_RET(MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_PUT_BLOCKING, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(nelem, src_type),
+    dart__mpi__profile_shmem(
+      team_data, seginfo, team_unit_id, src_type, dst_type));
+
   DART_LOG_DEBUG("dart_put_blocking > finished");
   return ret;
 }
@@ -1146,6 +1402,8 @@ dart_ret_t dart_get_blocking(
   MPI_Request reqs[2]  = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
   uint8_t     num_reqs = 0;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   // leave complex data type handling to MPI
   if (dart__mpi__datatype_iscontiguous(src_type) &&
       dart__mpi__datatype_iscontiguous(dst_type)) {
@@ -1166,6 +1424,12 @@ dart_ret_t dart_get_blocking(
       MPI_Waitall(num_reqs, reqs, MPI_STATUSES_IGNORE), "MPI_Waitall");
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_GET_BLOCKING, teamid, team_unit_id.id,
+    dart__mpi__profile_nbytes(nelem, src_type),
+    dart__mpi__profile_shmem(
+      team_data, seginfo, team_unit_id, src_type, dst_type));
+
   DART_LOG_DEBUG("dart_get_blocking > finished");
   return DART_OK;
 }
@@ -1202,6 +1466,8 @@ dart_ret_t dart_flush(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   DART_LOG_TRACE("dart_flush: MPI_Win_flush");
   CHECK_MPI_RET(
     MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
@@ -1215,6 +1481,8 @@ dart_ret_t dart_flush(
     MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
     "MPI_Iprobe");
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_FLUSH, teamid, team_unit_id.id, 0, false);
   DART_LOG_DEBUG("dart_flush > finished");
   return DART_OK;
 }
@@ -1247,6 +1515,8 @@ dart_ret_t dart_flush_all(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
   CHECK_MPI_RET(
     MPI_Win_flush_all(win), "MPI_Win_flush");
@@ -1260,6 +1530,9 @@ dart_ret_t dart_flush_all(
     MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
     "MPI_Iprobe");
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_FLUSH_ALL, teamid, DART_UNDEFINED_UNIT_ID,
+    0, false);
   DART_LOG_DEBUG("dart_flush_all > finished");
   return DART_OK;
 }
@@ -1294,6 +1567,8 @@ dart_ret_t dart_flush_local(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   DART_LOG_TRACE("dart_flush_local: MPI_Win_flush_local");
   CHECK_MPI_RET(
     MPI_Win_flush_local(team_unit_id.id, win),
@@ -1305,6 +1580,8 @@ dart_ret_t dart_flush_local(
     MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
     "MPI_Iprobe");
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_FLUSH_LOCAL, teamid, team_unit_id.id, 0, false);
   DART_LOG_DEBUG("dart_flush_local > finished");
   return DART_OK;
 }
@@ -1336,6 +1613,8 @@ dart_ret_t dart_flush_local_all(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   CHECK_MPI_RET(
     MPI_Win_flush_local_all(win),
     "MPI_Win_flush_local_all");
@@ -1346,6 +1625,9 @@ dart_ret_t dart_flush_local_all(
     MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
     "MPI_Iprobe");
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_FLUSH_LOCAL_ALL, teamid, DART_UNDEFINED_UNIT_ID,
+    0, false);
   DART_LOG_DEBUG("dart_flush_local_all > finished");
   return DART_OK;
 }
@@ -1354,6 +1636,8 @@ dart_ret_t dart_wait_local(
   dart_handle_t * handleptr)
 {
   DART_LOG_DEBUG("dart_wait_local() handle:%p", (void*)(handleptr));
+  DART_PROFILE_BEGIN(prof_ts);
+
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
     dart_handle_t handle = *handleptr;
     DART_LOG_TRACE("dart_wait_local:     handle: %p",
@@ -1372,9 +1656,12 @@ dart_ret_t dart_wait_local(
     } else {
       DART_LOG_TRACE("dart_wait_local:     handle->num_reqs == 0");
     }
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
   }
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_WAIT_LOCAL, DART_UNDEFINED_TEAM_ID,
+    DART_UNDEFINED_UNIT_ID, 0, false);
   DART_LOG_DEBUG("dart_wait_local > finished");
   return DART_OK;
 }
@@ -1383,6 +1670,8 @@ dart_ret_t dart_wait(
   dart_handle_t * handleptr)
 {
   DART_LOG_DEBUG("dart_wait() handle:%p", (void*)(handleptr));
+  DART_PROFILE_BEGIN(prof_ts);
+
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
     dart_handle_t handle = *handleptr;
     DART_LOG_TRACE("dart_wait:     handle: %p",
@@ -1406,9 +1695,12 @@ dart_ret_t dart_wait(
       DART_LOG_TRACE("dart_wait:     handle->num_reqs == 0");
     }
     /* Free handle resource */
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
   }
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_WAIT, DART_UNDEFINED_TEAM_ID,
+    DART_UNDEFINED_UNIT_ID, 0, false);
   DART_LOG_DEBUG("dart_wait > finished");
   return DART_OK;
 }
@@ -1428,6 +1720,8 @@ dart_ret_t dart_waitall_local(
     DART_LOG_ERROR("dart_waitall_local ! number of handles > INT_MAX");
     return DART_ERR_INVAL;
   }
+  DART_PROFILE_BEGIN(prof_ts);
+
   if (handles != NULL) {
     size_t r_n = 0;
     MPI_Request *mpi_req = ALLOC_TMP(2 * num_handles * sizeof(MPI_Request));
@@ -1473,12 +1767,15 @@ dart_ret_t dart_waitall_local(
         DART_LOG_TRACE("dart_waitall_local: free handle[%zu] %p",
                        i, (void*)(handles[i]));
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_free(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
     FREE_TMP(2 * num_handles * sizeof(MPI_Request), mpi_req);
   }
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_WAITALL_LOCAL, DART_UNDEFINED_TEAM_ID,
+    DART_UNDEFINED_UNIT_ID, 0, false);
   DART_LOG_DEBUG("dart_waitall_local > %d", ret);
   return ret;
 }
@@ -1521,6 +1818,8 @@ dart_ret_t dart_waitall(
 
   DART_LOG_DEBUG("dart_waitall: number of handles: %zu", n);
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   if (handles != NULL) {
     MPI_Request *mpi_req = ALLOC_TMP(2 * n * sizeof(MPI_Request));
     /*
@@ -1592,13 +1891,16 @@ dart_ret_t dart_waitall(
         DART_LOG_TRACE("dart_waitall: -- free handle[%zu]: %p",
                        i, (void*)(handles[i]));
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_free(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
     DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
     FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
   }
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_WAITALL, DART_UNDEFINED_TEAM_ID,
+    DART_UNDEFINED_UNIT_ID, 0, false);
   DART_LOG_DEBUG("dart_waitall > finished");
   return DART_OK;
 }
@@ -1658,7 +1960,7 @@ dart_ret_t dart_test_local(
 
   if (flag) {
     // deallocate handle
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
     *is_finished = 1;
   }
@@ -1695,7 +1997,7 @@ dart_ret_t dart_test(
       );
     }
     // deallocate handle
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
     *is_finished = 1;
   }
@@ -1742,7 +2044,7 @@ dart_ret_t dart_testall_local(
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
           // free the handle
-          free(handles[i]);
+          dart__mpi__handle_free(handles[i]);
           handles[i] = DART_HANDLE_NULL;
         }
       }
@@ -1803,7 +2105,7 @@ dart_ret_t dart_testall(
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
           // free the handle
-          free(handles[i]);
+          dart__mpi__handle_free(handles[i]);
           handles[i] = DART_HANDLE_NULL;
         }
       }
@@ -1820,7 +2122,7 @@ dart_ret_t dart_handle_free(
   dart_handle_t * handleptr)
 {
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
-    free(*handleptr);
+    dart__mpi__handle_free(*handleptr);
     *handleptr = DART_HANDLE_NULL;
   }
   return DART_OK;
@@ -1848,14 +2150,57 @@ dart_ret_t dart_barrier(
     return DART_ERR_INVAL;
   }
 
+  DART_PROFILE_BEGIN(prof_ts);
+
+  if (team_data->coll_hier != NULL) {
+    dart_ret_t ret = dart__mpi__coll_hier_barrier(team_data);
+    DART_PROFILE_END(
+      prof_ts, DART_PROFILE_OP_BARRIER, teamid, DART_UNDEFINED_UNIT_ID,
+      0, true);
+    DART_LOG_DEBUG("dart_barrier > hierarchical barrier finished");
+    return ret;
+  }
+
   /* Fetch proper communicator from teams. */
   CHECK_MPI_RET(
     MPI_Barrier(team_data->comm), "MPI_Barrier");
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_BARRIER, teamid, DART_UNDEFINED_UNIT_ID,
+    0, false);
   DART_LOG_DEBUG("dart_barrier > MPI_Barrier finished");
   return DART_OK;
 }
 
+dart_ret_t dart_barrier_handle(
+  dart_team_t     teamid,
+  dart_handle_t * handle)
+{
+  DART_LOG_DEBUG("dart_barrier_handle() team:%d", teamid);
+
+  *handle = DART_HANDLE_NULL;
+
+  if (dart__unlikely(teamid == DART_UNDEFINED_TEAM_ID)) {
+    DART_LOG_ERROR("dart_barrier_handle ! failed: team may not be "
+                   "DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_barrier_handle ! failed: Unknown team: %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Request req;
+  CHECK_MPI_RET(
+    MPI_Ibarrier(team_data->comm, &req), "MPI_Ibarrier");
+  *handle = dart__mpi__coll_handle(req, NULL);
+
+  DART_LOG_DEBUG("dart_barrier_handle > MPI_Ibarrier started");
+  return DART_OK;
+}
+
 dart_ret_t dart_bcast(
   void              * buf,
   size_t              nelem,
@@ -1876,6 +2221,20 @@ dart_ret_t dart_bcast(
 
   MPI_Comm comm = team_data->comm;
 
+  DART_PROFILE_BEGIN(prof_ts);
+  if (team_data->coll_hier != NULL &&
+      dart__mpi__datatype_iscontiguous(dtype)) {
+    dart_ret_t ret = dart__mpi__coll_hier_bcast(
+                       buf, nelem * dart__mpi__datatype_sizeof(dtype),
+                       root, team_data);
+    DART_PROFILE_END(
+      prof_ts, DART_PROFILE_OP_BCAST, teamid, DART_UNDEFINED_UNIT_ID,
+      dart__mpi__profile_nbytes(nelem, dtype), true);
+    DART_LOG_TRACE("dart_bcast > root:%d team:%d nelem:%zu hierarchical "
+                   "finished", root.id, teamid, nelem);
+    return ret;
+  }
+
   // chunk up the bcast if necessary
   const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
   const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
@@ -1897,11 +2256,73 @@ dart_ret_t dart_bcast(
       "MPI_Bcast");
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_BCAST, teamid, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
   DART_LOG_TRACE("dart_bcast > root:%d team:%d nelem:%zu finished",
                  root.id, teamid, nelem);
   return DART_OK;
 }
 
+dart_ret_t dart_bcast_handle(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handle)
+{
+  DART_LOG_TRACE("dart_bcast_handle() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  *handle = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_bcast_handle ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  MPI_Comm comm = team_data->comm;
+
+  // chunk up the bcast if necessary, the handle holds up to two requests
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+        char * src_ptr   = (char*) buf;
+
+  dart_handle_t coll_handle = NULL;
+  MPI_Request   req;
+
+  if (nchunks > 0) {
+    CHECK_MPI_RET(
+      MPI_Ibcast(src_ptr, nchunks,
+                 dart__mpi__datatype_maxtype(dtype),
+                 root.id, comm, &req),
+      "MPI_Ibcast");
+    coll_handle = dart__mpi__coll_handle(req, NULL);
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+  }
+
+  if (remainder > 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+    CHECK_MPI_RET(
+      MPI_Ibcast(src_ptr, remainder, mpi_dtype, root.id, comm, &req),
+      "MPI_Ibcast");
+    if (coll_handle == NULL) {
+      coll_handle = dart__mpi__coll_handle(req, NULL);
+    } else {
+      coll_handle->reqs[coll_handle->num_reqs++] = req;
+    }
+  }
+  *handle = coll_handle;
+
+  DART_LOG_TRACE("dart_bcast_handle > root:%d team:%d nelem:%zu started",
+                 root.id, teamid, nelem);
+  return DART_OK;
+}
+
 dart_ret_t dart_scatter(
   const void        * sendbuf,
   void              * recvbuf,
@@ -1920,6 +2341,7 @@ dart_ret_t dart_scatter(
 
   CHECK_UNITID_RANGE(root, team_data);
 
+  DART_PROFILE_BEGIN(prof_ts);
   // chunk up the scatter if necessary
   const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
   const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
@@ -1960,6 +2382,9 @@ dart_ret_t dart_scatter(
       "MPI_Scatter");
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_SCATTER, teamid, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
   return DART_OK;
 }
 
@@ -1984,6 +2409,7 @@ dart_ret_t dart_gather(
 
   CHECK_UNITID_RANGE(root, team_data);
 
+  DART_PROFILE_BEGIN(prof_ts);
   // chunk up the scatter if necessary
   const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
   const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
@@ -2024,6 +2450,9 @@ dart_ret_t dart_gather(
       "MPI_Gather");
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_GATHER, teamid, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
   return DART_OK;
 }
 
@@ -2049,6 +2478,7 @@ dart_ret_t dart_allgather(
     sendbuf = MPI_IN_PLACE;
   }
 
+  DART_PROFILE_BEGIN(prof_ts);
   // chunk up the scatter if necessary
   const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
   const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
@@ -2087,11 +2517,68 @@ dart_ret_t dart_allgather(
       "MPI_Allgather");
   }
 
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_ALLGATHER, teamid, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
   DART_LOG_TRACE("dart_allgather > team:%d nelem:%"PRIu64"",
                  teamid, nelem);
   return DART_OK;
 }
 
+dart_ret_t dart_allgather_handle(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid,
+  dart_handle_t   * handle)
+{
+  DART_LOG_TRACE("dart_allgather_handle() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  *handle = DART_HANDLE_NULL;
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_allgather_handle ! failed: nelem (%zu) > INT_MAX",
+                   nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_allgather_handle ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  MPI_Request  req;
+  CHECK_MPI_RET(
+    MPI_Iallgather(
+        sendbuf,
+        nelem,
+        mpi_dtype,
+        recvbuf,
+        nelem,
+        mpi_dtype,
+        team_data->comm,
+        &req),
+    "MPI_Iallgather");
+  *handle = dart__mpi__coll_handle(req, NULL);
+
+  DART_LOG_TRACE("dart_allgather_handle > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+  return DART_OK;
+}
+
 dart_ret_t dart_allgatherv(
   const void      * sendbuf,
   size_t            nsendelem,
@@ -2145,6 +2632,8 @@ dart_ret_t dart_allgatherv(
     irecvdispls[i]  = recvdispls[i];
   }
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
   if (MPI_Allgatherv(
            sendbuf,
@@ -2163,38 +2652,507 @@ dart_ret_t dart_allgatherv(
   }
   free(inrecvcounts);
   free(irecvdispls);
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_ALLGATHERV, teamid, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(nsendelem, dtype), false);
   DART_LOG_TRACE("dart_allgatherv > team:%d nsendelem:%"PRIu64"",
                  teamid, nsendelem);
   return DART_OK;
 }
 
-dart_ret_t dart_allreduce(
-  const void       * sendbuf,
-  void             * recvbuf,
-  size_t             nelem,
-  dart_datatype_t    dtype,
-  dart_operation_t   op,
-  dart_team_t        team)
+/**
+ * Whether any count or displacement of an alltoallv operation exceeds
+ * INT_MAX, in which case the operation cannot be passed to
+ * \c MPI_Alltoallv.
+ */
+static bool dart__mpi__alltoallv_is_large(
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  int               comm_size)
 {
-
-  CHECK_IS_CONTIGUOUSTYPE(dtype);
-
-  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
-  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
-
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
-    DART_LOG_ERROR("dart_allreduce ! failed: nelem (%zu) > INT_MAX", nelem);
-    return DART_ERR_INVAL;
+  for (int i = 0; i < comm_size; i++) {
+    if (nsendcounts[i] > MAX_CONTIG_ELEMENTS ||
+        senddispls[i]  > MAX_CONTIG_ELEMENTS ||
+        nrecvcounts[i] > MAX_CONTIG_ELEMENTS ||
+        recvdispls[i]  > MAX_CONTIG_ELEMENTS)
+    {
+      DART_LOG_TRACE(
+        "dart_alltoallv: counts or displacements of unit %i > INT_MAX", i);
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Converts the counts and displacements of an alltoallv operation to the
+ * integer arrays expected by MPI, stored consecutively in the returned
+ * buffer (send counts, send displacements, receive counts, receive
+ * displacements). Counts and displacements must not exceed INT_MAX.
+ *
+ * \return  The buffer to be released by the caller, or NULL if it could
+ *          not be allocated.
+ */
+static int * dart__mpi__alltoallv_args(
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  int               comm_size)
+{
+  int *args = malloc(sizeof(int) * 4 * comm_size);
+  if (args == NULL) {
+    return NULL;
+  }
+  for (int i = 0; i < comm_size; i++) {
+    args[i]                 = nsendcounts[i];
+    args[comm_size + i]     = senddispls[i];
+    args[2 * comm_size + i] = nrecvcounts[i];
+    args[3 * comm_size + i] = recvdispls[i];
+  }
+  return args;
+}
+
+/**
+ * Creates the datatype of \c nelem values of \c dtype at displacement
+ * \c disp (in number of values) used in \c MPI_Alltoallw, which does not
+ * limit counts and displacements to INT_MAX.
+ */
+static int dart__mpi__alltoallw_type(
+  dart_datatype_t   dtype,
+  size_t            nelem,
+  size_t            disp,
+  MPI_Datatype    * type)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  MPI_Aint     lb;
+  MPI_Aint     extent;
+  MPI_Type_get_extent(mpi_dtype, &lb, &extent);
+
+  size_t       nchunks     = nelem / MAX_CONTIG_ELEMENTS;
+  size_t       remainder   = nelem % MAX_CONTIG_ELEMENTS;
+  int          blocklens[2] = { (int)nchunks, (int)remainder };
+  MPI_Aint     displs[2]    = {
+                 (MPI_Aint)disp * extent,
+                 (MPI_Aint)(disp + nchunks * MAX_CONTIG_ELEMENTS) * extent };
+  MPI_Datatype types[2]     = { dart__mpi__datatype_maxtype(dtype),
+                                mpi_dtype };
+  int ret = MPI_Type_create_struct(2, blocklens, displs, types, type);
+  if (ret != MPI_SUCCESS) {
+    return ret;
+  }
+  return MPI_Type_commit(type);
+}
+
+/**
+ * Releases the datatypes created in \c dart__mpi__alltoallw_args.
+ * The arguments are not modified as they might be in use by a pending
+ * operation.
+ */
+static void dart__mpi__alltoallw_free_types(
+  const MPI_Datatype * types,
+  int                  comm_size)
+{
+  for (int i = 0; i < 2 * comm_size; i++) {
+    MPI_Datatype type = types[i];
+    if (type != MPI_DATATYPE_NULL && type != MPI_BYTE) {
+      MPI_Type_free(&type);
+    }
+  }
+}
+
+/**
+ * Converts the counts and displacements of an alltoallv operation to the
+ * arguments of \c MPI_Alltoallw. Every block is described by a datatype
+ * with its displacement in bytes, counts are 0 or 1 and displacements are
+ * 0.
+ *
+ * The returned buffer contains the send and receive datatypes followed by
+ * the send counts, the displacements and the receive counts. The datatypes
+ * can be released once the operation has been started.
+ *
+ * \return  The buffer to be released by the caller, or NULL on failure.
+ */
+static MPI_Datatype * dart__mpi__alltoallw_args(
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_datatype_t   dtype,
+  int               comm_size,
+  bool              in_place)
+{
+  MPI_Datatype *types = malloc(
+                          2 * comm_size * sizeof(MPI_Datatype) +
+                          3 * comm_size * sizeof(int));
+  if (types == NULL) {
+    return NULL;
+  }
+  int  *counts = (int *)(types + 2 * comm_size);
+  bool  failed = false;
+  for (int i = 0; i < comm_size; i++) {
+    // send arguments are ignored in in-place operations but must be valid
+    types[i]                  = MPI_BYTE;
+    types[comm_size + i]      = MPI_DATATYPE_NULL;
+    counts[i]                 = 0;
+    counts[comm_size + i]     = 0;
+    counts[2 * comm_size + i] = (nrecvcounts[i] > 0) ? 1 : 0;
+    if (!in_place && nsendcounts[i] > 0) {
+      counts[i] = 1;
+      failed   |= dart__mpi__alltoallw_type(
+                    dtype, nsendcounts[i], senddispls[i], &types[i])
+                  != MPI_SUCCESS;
+    }
+    failed |= dart__mpi__alltoallw_type(
+                dtype, nrecvcounts[i], recvdispls[i], &types[comm_size + i])
+              != MPI_SUCCESS;
+  }
+  if (failed) {
+    DART_LOG_ERROR("dart_alltoallv ! failed to create datatypes");
+    dart__mpi__alltoallw_free_types(types, comm_size);
+    free(types);
+    return NULL;
+  }
+  return types;
+}
+
+/** Counts or displacements of the unit exceed INT_MAX */
+#define DART__MPI__ALLTOALLV_LARGE   0x1
+/** The unit failed to allocate the arguments of the operation */
+#define DART__MPI__ALLTOALLV_FAILED  0x2
+
+/**
+ * Combines the \c DART__MPI__ALLTOALLV_* flags of all units in the team,
+ * all units have to use \c MPI_Alltoallw if counts or displacements
+ * of any unit exceed INT_MAX and all units fail if any unit failed.
+ */
+static int dart__mpi__alltoallv_agree(
+  int               flags,
+  MPI_Comm          comm,
+  int             * all_flags)
+{
+  *all_flags = flags;
+  return MPI_Allreduce(MPI_IN_PLACE, all_flags, 1, MPI_INT, MPI_BOR, comm);
+}
+
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoall() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_alltoall ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoall ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  // units without values to send may pass NULL as send buffer
+  if (sendbuf == recvbuf && NULL != sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  DART_PROFILE_BEGIN(prof_ts);
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  if (MPI_Alltoall(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           team_data->comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoall ! team:%d nelem:%"PRIu64" failed",
+                   teamid, nelem);
+    return DART_ERR_INVAL;
+  }
+
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_ALLTOALL, teamid, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(nelem * team_data->size, dtype), false);
+  DART_LOG_TRACE("dart_alltoall > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoall_handle(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid,
+  dart_handle_t   * handle)
+{
+  DART_LOG_TRACE("dart_alltoall_handle() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  *handle = DART_HANDLE_NULL;
+
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_alltoall_handle ! failed: nelem (%zu) > INT_MAX",
+                   nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoall_handle ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  // units without values to send may pass NULL as send buffer
+  if (sendbuf == recvbuf && NULL != sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  MPI_Request  req;
+  if (MPI_Ialltoall(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           team_data->comm,
+           &req) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoall_handle ! team:%d nelem:%"PRIu64" failed",
+                   teamid, nelem);
+    return DART_ERR_INVAL;
+  }
+  *handle = dart__mpi__coll_handle(req, NULL);
+
+  DART_LOG_TRACE("dart_alltoall_handle > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  int  comm_size = team_data->size;
+  int *args      = NULL;
+  int  flags     = 0;
+  if (dart__mpi__alltoallv_is_large(
+        nsendcounts, senddispls, nrecvcounts, recvdispls, comm_size)) {
+    flags = DART__MPI__ALLTOALLV_LARGE;
+  } else {
+    args = dart__mpi__alltoallv_args(
+             nsendcounts, senddispls, nrecvcounts, recvdispls, comm_size);
+    if (args == NULL) {
+      DART_LOG_ERROR("dart_alltoallv ! team:%d failed to allocate "
+                     "arguments", teamid);
+      flags = DART__MPI__ALLTOALLV_FAILED;
+    }
+  }
+
+  // units without values to send may pass NULL as send buffer
+  if (sendbuf == recvbuf && NULL != sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  DART_PROFILE_BEGIN(prof_ts);
+
+  int all_flags;
+  if (dart__mpi__alltoallv_agree(flags, team_data->comm, &all_flags)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d MPI_Allreduce failed", teamid);
+    free(args);
+    return DART_ERR_INVAL;
+  }
+  if (all_flags & DART__MPI__ALLTOALLV_FAILED) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed at any unit", teamid);
+    free(args);
+    return DART_ERR_OTHER;
+  }
+
+  if (all_flags & DART__MPI__ALLTOALLV_LARGE) {
+    // counts or displacements exceed INT_MAX at any unit
+    free(args);
+    MPI_Datatype *types = dart__mpi__alltoallw_args(
+                            nsendcounts, senddispls, nrecvcounts, recvdispls,
+                            dtype, comm_size, sendbuf == MPI_IN_PLACE);
+    if (types == NULL) {
+      return DART_ERR_OTHER;
+    }
+    int *counts = (int *)(types + 2 * comm_size);
+    int  ret    = MPI_Alltoallw(
+                    sendbuf, counts, counts + comm_size, types,
+                    recvbuf, counts + 2 * comm_size, counts + comm_size,
+                    types + comm_size,
+                    team_data->comm);
+    dart__mpi__alltoallw_free_types(types, comm_size);
+    free(types);
+    if (ret != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_alltoallv ! team:%d MPI_Alltoallw failed", teamid);
+      return DART_ERR_INVAL;
+    }
+  } else {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+    int ret = MPI_Alltoallv(
+                sendbuf,
+                args,
+                args + comm_size,
+                mpi_dtype,
+                recvbuf,
+                args + 2 * comm_size,
+                args + 3 * comm_size,
+                mpi_dtype,
+                team_data->comm);
+    free(args);
+    if (ret != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+      return DART_ERR_INVAL;
+    }
+  }
+
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_ALLTOALLV, teamid, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(
+      dart__mpi__profile_sum(nsendcounts, comm_size), dtype),
+    false);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv_handle(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid,
+  dart_handle_t   * handle)
+{
+  DART_LOG_TRACE("dart_alltoallv_handle() team:%d", teamid);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  *handle = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv_handle ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  int comm_size = team_data->size;
+
+  // units without values to send may pass NULL as send buffer
+  if (sendbuf == recvbuf && NULL != sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  // Whether counts or displacements exceed INT_MAX at any unit is only
+  // known after a blocking agreement, the non-blocking operation always
+  // uses MPI_Ialltoallw which does not limit counts and displacements.
+  // Datatypes and counts must remain valid until the operation completed,
+  // they are released together with the handle.
+  MPI_Datatype *types = dart__mpi__alltoallw_args(
+                          nsendcounts, senddispls, nrecvcounts, recvdispls,
+                          dtype, comm_size, sendbuf == MPI_IN_PLACE);
+  if (types == NULL) {
+    DART_LOG_ERROR("dart_alltoallv_handle ! team:%d failed to create "
+                   "arguments", teamid);
+    return DART_ERR_OTHER;
+  }
+  MPI_Request req;
+  int *counts = (int *)(types + 2 * comm_size);
+  int  ret    = MPI_Ialltoallw(
+                  sendbuf, counts, counts + comm_size, types,
+                  recvbuf, counts + 2 * comm_size, counts + comm_size,
+                  types + comm_size,
+                  team_data->comm, &req);
+  // datatypes in use by the pending operation are released once it
+  // completed
+  dart__mpi__alltoallw_free_types(types, comm_size);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv_handle ! team:%d MPI_Ialltoallw failed",
+                   teamid);
+    free(types);
+    return DART_ERR_INVAL;
+  }
+  *handle = dart__mpi__coll_handle(req, types);
+
+  DART_LOG_TRACE("dart_alltoallv_handle > team:%d", teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_allreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_allreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_allreduce ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+  DART_PROFILE_BEGIN(prof_ts);
+
+  if (team_data->coll_hier != NULL &&
+      dart__mpi__coll_hier_allreduce_supported(op, dtype)) {
+    dart_ret_t ret = dart__mpi__coll_hier_allreduce(
+                       sendbuf, recvbuf, nelem, dtype, op, team_data);
+    DART_PROFILE_END(
+      prof_ts, DART_PROFILE_OP_ALLREDUCE, team, DART_UNDEFINED_UNIT_ID,
+      dart__mpi__profile_nbytes(nelem, dtype), true);
+    return ret;
   }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
-  if (dart__unlikely(team_data == NULL)) {
-    DART_LOG_ERROR("dart_allreduce ! unknown teamid %d", team);
-    return DART_ERR_INVAL;
-  }
   MPI_Comm comm = team_data->comm;
   CHECK_MPI_RET(
     MPI_Allreduce(
@@ -2205,6 +3163,54 @@ dart_ret_t dart_allreduce(
            mpi_op,    // reduce operation
            comm),
     "MPI_Allreduce");
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_ALLREDUCE, team, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
+  return DART_OK;
+}
+
+dart_ret_t dart_allreduce_handle(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handle)
+{
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  *handle = DART_HANDLE_NULL;
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_allreduce_handle ! failed: nelem (%zu) > INT_MAX",
+                   nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_allreduce_handle ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+  MPI_Request req;
+  CHECK_MPI_RET(
+    MPI_Iallreduce(
+           sendbuf,   // send buffer
+           recvbuf,   // receive buffer
+           nelem,     // buffer size
+           mpi_dtype, // datatype
+           mpi_op,    // reduce operation
+           team_data->comm,
+           &req),
+    "MPI_Iallreduce");
+  *handle = dart__mpi__coll_handle(req, NULL);
   return DART_OK;
 }
 
@@ -2237,6 +3243,8 @@ dart_ret_t dart_reduce(
 
   CHECK_UNITID_RANGE(root, team_data);
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   comm = team_data->comm;
   CHECK_MPI_RET(
     MPI_Reduce(
@@ -2248,6 +3256,55 @@ dart_ret_t dart_reduce(
            root.id,
            comm),
     "MPI_Reduce");
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_REDUCE, team, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
+  return DART_OK;
+}
+
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
+{
+  DART_LOG_TRACE("dart_exscan() team:%d nelem:%"PRIu64"", team, nelem);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_exscan ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_exscan ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  DART_PROFILE_BEGIN(prof_ts);
+
+  CHECK_MPI_RET(
+    MPI_Exscan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           team_data->comm),
+    "MPI_Exscan");
+
+  DART_LOG_TRACE("dart_exscan > team:%d nelem:%"PRIu64"", team, nelem);
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_EXSCAN, team, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
   return DART_OK;
 }
 
@@ -2279,6 +3336,8 @@ dart_ret_t dart_send(
 
   CHECK_UNITID_RANGE(unit, team_data);
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   comm = team_data->comm;
   // dart_unit = MPI rank in comm_world
   CHECK_MPI_RET(
@@ -2290,6 +3349,9 @@ dart_ret_t dart_send(
         tag,
         comm),
     "MPI_Send");
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_SEND, team, unit.id,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
   return DART_OK;
 }
 
@@ -2321,6 +3383,8 @@ dart_ret_t dart_recv(
 
   CHECK_UNITID_RANGE(unit, team_data);
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   comm = team_data->comm;
   // dart_unit = MPI rank in comm_world
   CHECK_MPI_RET(
@@ -2333,6 +3397,102 @@ dart_ret_t dart_recv(
         comm,
         MPI_STATUS_IGNORE),
     "MPI_Recv");
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_RECV, team, unit.id,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
+  return DART_OK;
+}
+
+dart_ret_t dart_team_send(
+  const void         * sendbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_team_t          team,
+  dart_team_unit_t     unit)
+{
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_team_send ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_team_send ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(unit, team_data);
+
+  DART_PROFILE_BEGIN(prof_ts);
+
+  CHECK_MPI_RET(
+    MPI_Send(
+        sendbuf,
+        nelem,
+        mpi_dtype,
+        unit.id,
+        tag,
+        team_data->comm),
+    "MPI_Send");
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_SEND, team, unit.id,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
+  return DART_OK;
+}
+
+dart_ret_t dart_team_recv_any(
+  void                * recvbuf,
+  size_t                nelem,
+  dart_datatype_t       dtype,
+  int                   tag,
+  dart_team_t           team,
+  dart_team_unit_t    * unit)
+{
+  MPI_Status status;
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_team_recv_any ! failed: nelem (%zu) > INT_MAX",
+                   nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_team_recv_any ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  DART_PROFILE_BEGIN(prof_ts);
+
+  CHECK_MPI_RET(
+    MPI_Recv(
+        recvbuf,
+        nelem,
+        mpi_dtype,
+        MPI_ANY_SOURCE,
+        tag,
+        team_data->comm,
+        &status),
+    "MPI_Recv");
+  if (unit != NULL) {
+    // MPI rank in the team's communicator
+    unit->id = status.MPI_SOURCE;
+  }
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_RECV, team, status.MPI_SOURCE,
+    dart__mpi__profile_nbytes(nelem, dtype), false);
   return DART_OK;
 }
 
@@ -2376,6 +3536,8 @@ dart_ret_t dart_sendrecv(
   CHECK_UNITID_RANGE(dest, team_data);
   CHECK_UNITID_RANGE(src, team_data);
 
+  DART_PROFILE_BEGIN(prof_ts);
+
   comm = team_data->comm;
   CHECK_MPI_RET(
     MPI_Sendrecv(
@@ -2392,5 +3554,8 @@ dart_ret_t dart_sendrecv(
         comm,
         MPI_STATUS_IGNORE),
     "MPI_Sendrecv");
+  DART_PROFILE_END(
+    prof_ts, DART_PROFILE_OP_SENDRECV, team, DART_UNDEFINED_UNIT_ID,
+    dart__mpi__profile_nbytes(send_nelem, send_dtype), false);
   return DART_OK;
 }
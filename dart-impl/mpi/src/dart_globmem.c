@@ -683,6 +683,145 @@ dart_team_memregister(
   return DART_OK;
 }
 
+dart_ret_t
+dart_team_memregister_segments(
+   dart_team_t       teamid,
+   size_t            nsegs,
+   const size_t    * nlelem,
+   dart_datatype_t   dtype,
+   void           ** addrs,
+   dart_gptr_t     * gptrs)
+{
+  CHECK_IS_BASICTYPE(dtype);
+  size_t size;
+  int    dtype_size = dart__mpi__datatype_sizeof(dtype);
+  dart_unit_t gptr_unitid = 0;
+  dart_team_size(teamid, &size);
+
+  for (size_t s = 0; s < nsegs; ++s) {
+    gptrs[s] = DART_GPTR_NULL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR(
+      "dart_team_memregister_segments ! failed: Unknown team %i!", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (nsegs == 0) {
+    return DART_OK;
+  }
+
+  MPI_Comm   comm      = team_data->comm;
+  MPI_Win    win       = team_data->window;
+  MPI_Aint * disp      = malloc(nsegs * sizeof(MPI_Aint));
+  MPI_Aint * disp_all  = malloc(nsegs * size * sizeof(MPI_Aint));
+  dart_segment_info_t ** segments = calloc(nsegs,
+                                           sizeof(dart_segment_info_t *));
+  // Number of segments allocated and attached to the window:
+  size_t     nalloc    = 0;
+  size_t     nattach   = 0;
+  int        failed    = (disp == NULL || disp_all == NULL ||
+                          segments == NULL);
+
+  // Allocate segment data and attach segments to the team's dynamic
+  // window, empty segments are not attached:
+  for (size_t s = 0; !failed && s < nsegs; ++s) {
+    segments[s] = dart_segment_alloc(
+                    &team_data->segdata, DART_SEGMENT_REGISTER);
+    if (segments[s] == NULL) {
+      DART_LOG_ERROR(
+        "dart_team_memregister_segments: Allocation of segment data failed");
+      failed = 1;
+      break;
+    }
+    ++nalloc;
+    if (segments[s]->disp == NULL) {
+      segments[s]->disp = malloc(size * sizeof(MPI_Aint));
+      if (segments[s]->disp == NULL) {
+        DART_LOG_ERROR(
+          "dart_team_memregister_segments: Allocation of displacements "
+          "failed");
+        failed = 1;
+        break;
+      }
+    }
+    size_t nbytes = nlelem[s] * dtype_size;
+    disp[s]       = 0;
+    if (nbytes > 0) {
+      if (MPI_Win_attach(win, addrs[s], nbytes) != MPI_SUCCESS) {
+        DART_LOG_ERROR(
+          "dart_team_memregister_segments: MPI_Win_attach failed");
+        failed = 1;
+        break;
+      }
+      MPI_Get_address(addrs[s], &disp[s]);
+    }
+    ++nattach;
+  }
+
+  // Segment IDs must be identical at all units, agree on the outcome
+  // before exchanging displacements so registration fails at all units
+  // if it failed at any unit:
+  int any_failed = 1;
+  if (MPI_Allreduce(&failed, &any_failed, 1, MPI_INT, MPI_LOR, comm)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_team_memregister_segments: MPI_Allreduce failed");
+    any_failed = 1;
+  }
+  // Single exchange of the displacements of all segments:
+  if (!any_failed &&
+      MPI_Allgather(disp,     (int)nsegs, MPI_AINT,
+                    disp_all, (int)nsegs, MPI_AINT, comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_team_memregister_segments: MPI_Allgather failed");
+    any_failed = 1;
+  }
+
+  if (any_failed) {
+    // Roll back registration: detach segments from the window and release
+    // segment data in reverse order of allocation so subsequent segment
+    // IDs are identical at all units, independent of the number of
+    // segments a unit allocated before registration failed:
+    for (size_t s = nalloc; s > 0; --s) {
+      if (s <= nattach && nlelem[s-1] * dtype_size > 0) {
+        MPI_Win_detach(win, addrs[s-1]);
+      }
+      dart_segment_free(&team_data->segdata, segments[s-1]->segid);
+    }
+    free(disp);
+    free(disp_all);
+    free(segments);
+    return DART_ERR_OTHER;
+  }
+
+  for (size_t s = 0; s < nsegs; ++s) {
+    size_t nbytes = nlelem[s] * dtype_size;
+    dart_segment_info_t *segment = segments[s];
+    for (size_t u = 0; u < size; ++u) {
+      segment->disp[u] = disp_all[u * nsegs + s];
+    }
+    segment->size        = nbytes;
+    segment->shmwin      = MPI_WIN_NULL;
+    segment->win         = team_data->window;
+    segment->selfbaseptr = (nbytes > 0) ? (char *)addrs[s] : NULL;
+    segment->flags       = 0;
+
+    gptrs[s].unitid = gptr_unitid;
+    gptrs[s].segid  = segment->segid;
+    gptrs[s].teamid = teamid;
+    gptrs[s].flags  = 0;
+    gptrs[s].addr_or_offs.offset = 0;
+  }
+  free(disp);
+  free(disp_all);
+  free(segments);
+
+  DART_LOG_DEBUG(
+    "dart_team_memregister_segments: collective alloc, "
+    "nsegs:%zu across team %d", nsegs, teamid);
+  return DART_OK;
+}
+
 dart_ret_t
 dart_team_memderegister(
    dart_gptr_t gptr)
@@ -711,7 +850,11 @@ dart_team_memderegister(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win_detach(win, sub_mem);
+  if (sub_mem != NULL) {
+    // Empty segments registered in dart_team_memregister_segments are not
+    // attached to the window:
+    MPI_Win_detach(win, sub_mem);
+  }
   if (dart_segment_free(&team_data->segdata, segid) != DART_OK) {
     return DART_ERR_INVAL;
   }
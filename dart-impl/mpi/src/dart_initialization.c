@@ -18,7 +18,9 @@
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
+#include <dash/dart/mpi/dart_coll_hier_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_profile_priv.h>
 
 #define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
 
@@ -198,6 +200,16 @@ dart_ret_t do_init()
 
   _dart_initialized = 2;
 
+  ret = dart__mpi__profile_init();
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  ret = dart__mpi__coll_hier_init_default(team_data);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   DART_LOG_DEBUG("dart_init > initialization finished");
   return DART_OK;
 }
@@ -281,6 +293,8 @@ dart_ret_t dart_exit()
   dart_global_unit_t unitid;
   dart_myid(&unitid);
 
+  dart__mpi__profile_fini();
+
   dart__mpi__locality_finalize();
 
   _dart_initialized = 0;
@@ -293,6 +307,8 @@ dart_ret_t dart_exit()
     return DART_ERR_OTHER;
   }
 
+  dart__mpi__coll_hier_fini(team_data);
+
   dart_segment_info_t *seginfo = dart_segment_get_info(&team_data->segdata, 0);
 
   if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
@@ -9,6 +9,7 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_initialization.h>
 #include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 
 #include <stdlib.h>
@@ -36,6 +37,12 @@ static const char* __dart_base_type_names[DART_TYPE_LAST+1] = {
 
 dart_datatype_struct_t __dart_base_types[DART_TYPE_LAST];
 
+/// protects the MPI type caches of strided types and the cache statistics
+static dart_mutex_t            type_cache_mtx   = DART_MUTEX_INITIALIZER;
+/// incremented on every lookup in the MPI type cache of a strided type
+static uint64_t                type_cache_clock = 0;
+static dart_type_cache_stats_t type_cache_stats = { 0, 0, 0 };
+
 MPI_Datatype
 dart__mpi__datatype_create_max_datatype(MPI_Datatype mpi_type)
 {
@@ -172,6 +179,7 @@ dart_type_create_strided(
   new_struct->kind             = DART_KIND_STRIDED;
   new_struct->num_elem         = blocklen;
   new_struct->strided.stride   = stride;
+  new_struct->strided.cache_size = 0;
 
   *newtype = (dart_datatype_t)new_struct;
 
@@ -181,13 +189,12 @@ dart_type_create_strided(
 }
 
 
-MPI_Datatype
-dart__mpi__create_strided_mpi(
-  dart_datatype_t dart_type,
-  size_t          num_blocks)
+static MPI_Datatype
+create_vector_type(
+  dart_datatype_struct_t * dts,
+  size_t                   num_blocks)
 {
   MPI_Datatype new_mpi_dtype;
-  dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
   MPI_Type_vector(
     num_blocks,             // the number of blocks
     dts->num_elem,          // the number of elements per block
@@ -198,12 +205,95 @@ dart__mpi__create_strided_mpi(
   return new_mpi_dtype;
 }
 
+MPI_Datatype
+dart__mpi__create_strided_mpi(
+  dart_datatype_t dart_type,
+  size_t          num_blocks)
+{
+  dart_datatype_struct_t     *dts    = dart__mpi__datatype_struct(dart_type);
+  dart_strided_cache_entry_t *cache  = dts->strided.cache;
+  dart_strided_cache_entry_t *victim = NULL;
+  MPI_Datatype                new_mpi_dtype;
+
+  dart__base__mutex_lock(&type_cache_mtx);
+  ++type_cache_clock;
+  for (int i = 0; i < dts->strided.cache_size; ++i) {
+    if (cache[i].num_blocks == num_blocks) {
+      cache[i].last_use = type_cache_clock;
+      cache[i].refcnt++;
+      type_cache_stats.hits++;
+      new_mpi_dtype = cache[i].mpi_type;
+      dart__base__mutex_unlock(&type_cache_mtx);
+      return new_mpi_dtype;
+    }
+  }
+  type_cache_stats.misses++;
+
+  new_mpi_dtype = create_vector_type(dts, num_blocks);
+
+  if (dts->strided.cache_size < DART_MPI_STRIDED_CACHE_SIZE) {
+    victim = &cache[dts->strided.cache_size++];
+  } else {
+    // evict the least recently used entry that is not in use
+    for (int i = 0; i < dts->strided.cache_size; ++i) {
+      if (cache[i].refcnt == 0 &&
+          (victim == NULL || cache[i].last_use < victim->last_use)) {
+        victim = &cache[i];
+      }
+    }
+    if (victim != NULL) {
+      DART_LOG_TRACE("Evicting MPI type of %zu blocks from cache of type %p",
+                     victim->num_blocks, dts);
+      MPI_Type_free(&victim->mpi_type);
+      type_cache_stats.evictions++;
+    }
+  }
+  // if all entries are in use the new type is not cached and freed on
+  // release
+  if (victim != NULL) {
+    victim->mpi_type   = new_mpi_dtype;
+    victim->num_blocks = num_blocks;
+    victim->last_use   = type_cache_clock;
+    victim->refcnt     = 1;
+  }
+  dart__base__mutex_unlock(&type_cache_mtx);
+  return new_mpi_dtype;
+}
+
 void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type)
+dart__mpi__release_strided_mpi(
+  dart_datatype_t   dart_type,
+  MPI_Datatype    * mpi_type)
 {
+  dart_datatype_struct_t     *dts   = dart__mpi__datatype_struct(dart_type);
+  dart_strided_cache_entry_t *cache = dts->strided.cache;
+
+  dart__base__mutex_lock(&type_cache_mtx);
+  for (int i = 0; i < dts->strided.cache_size; ++i) {
+    if (cache[i].mpi_type == *mpi_type && cache[i].refcnt > 0) {
+      cache[i].refcnt--;
+      dart__base__mutex_unlock(&type_cache_mtx);
+      return;
+    }
+  }
+  dart__base__mutex_unlock(&type_cache_mtx);
+  // not cached
   MPI_Type_free(mpi_type);
 }
 
+dart_ret_t
+dart_type_cache_stats(dart_type_cache_stats_t *stats)
+{
+  if (stats == NULL) {
+    DART_LOG_ERROR("dart_type_cache_stats: stats pointer may not be NULL!");
+    return DART_ERR_INVAL;
+  }
+  dart__base__mutex_lock(&type_cache_mtx);
+  *stats = type_cache_stats;
+  dart__base__mutex_unlock(&type_cache_mtx);
+  return DART_OK;
+}
+
 dart_ret_t
 dart_type_create_indexed(
   dart_datatype_t   basetype,
@@ -341,6 +431,13 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
     free(dart_type->indexed.offsets);
     dart_type->indexed.offsets   = NULL;
     MPI_Type_free(&dart_type->indexed.mpi_type);
+  } else if (dart_type->kind == DART_KIND_STRIDED) {
+    dart__base__mutex_lock(&type_cache_mtx);
+    for (int i = 0; i < dart_type->strided.cache_size; ++i) {
+      MPI_Type_free(&dart_type->strided.cache[i].mpi_type);
+    }
+    dart_type->strided.cache_size = 0;
+    dart__base__mutex_unlock(&type_cache_mtx);
   } else if (dart_type->kind == DART_KIND_CUSTOM) {
     MPI_Type_free(&dart_type->contiguous.mpi_type);
     if (dart_type->contiguous.max_type != DART_MPI_TYPE_UNDEFINED) {
@@ -0,0 +1,342 @@
+/**
+ * \file dart_profile.c
+ *
+ * Implementation of the DART communication profiling interface.
+ */
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_team_group.h>
+#include <dash/dart/if/dart_profile.h>
+
+#include <dash/dart/mpi/dart_profile_priv.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/atomic.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+static const char * const dart__mpi__profile_op_names[DART_PROFILE_OP_LAST] =
+{
+  "dart_get",
+  "dart_get_blocking",
+  "dart_get_handle",
+  "dart_put",
+  "dart_put_blocking",
+  "dart_put_handle",
+  "dart_accumulate",
+  "dart_fetch_and_op",
+  "dart_compare_and_swap",
+  "dart_flush",
+  "dart_flush_local",
+  "dart_send",
+  "dart_recv",
+  "dart_flush_all",
+  "dart_flush_local_all",
+  "dart_wait",
+  "dart_wait_local",
+  "dart_waitall",
+  "dart_waitall_local",
+  "dart_barrier",
+  "dart_bcast",
+  "dart_scatter",
+  "dart_gather",
+  "dart_allgather",
+  "dart_allgatherv",
+  "dart_alltoall",
+  "dart_alltoallv",
+  "dart_allreduce",
+  "dart_reduce",
+  "dart_exscan",
+  "dart_sendrecv"
+};
+
+const char * dart_profile_op_name(dart_profile_op_t op)
+{
+  if (op < 0 || op >= DART_PROFILE_OP_LAST) {
+    return "undefined";
+  }
+  return dart__mpi__profile_op_names[op];
+}
+
+#if defined(DART_ENABLE_PROFILING)
+
+bool dart__mpi__profile_on = false;
+
+/** Whether profiling has been enabled in the environment at startup */
+static bool dart__mpi__profile_env = false;
+
+/** Counters of every operation */
+static dart_profile_counters_t
+  dart__mpi__profile_op_counters[DART_PROFILE_OP_LAST];
+
+/** Counters of operations per target unit, allocated on first enable */
+static dart_profile_counters_t * dart__mpi__profile_unit_counters = NULL;
+static int                       dart__mpi__profile_nunits         = 0;
+
+static inline void dart__mpi__profile_update(
+  dart_profile_counters_t * counters,
+  uint64_t                  nanosecs,
+  size_t                    nbytes,
+  bool                      shmem)
+{
+  DART_FETCH_AND_ADD64(&counters->num_calls, 1);
+  DART_FETCH_AND_ADD64(&counters->num_bytes, nbytes);
+  DART_FETCH_AND_ADD64(&counters->total_ns,  nanosecs);
+  if (shmem) {
+    DART_FETCH_AND_ADD64(&counters->num_shmem, 1);
+  }
+  uint64_t max_ns = counters->max_ns;
+  while (nanosecs > max_ns) {
+    uint64_t prev = DART_COMPARE_AND_SWAP64(
+                      &counters->max_ns, max_ns, nanosecs);
+    if (prev == max_ns) {
+      break;
+    }
+    max_ns = prev;
+  }
+  int bin = 0;
+  if (nanosecs >= 256) {
+    // floor(log2(nanosecs)) - 7:
+    bin = (63 - __builtin_clzll(nanosecs)) - 7;
+    if (bin >= DART_PROFILE_NUM_BINS) {
+      bin = DART_PROFILE_NUM_BINS - 1;
+    }
+  }
+  DART_FETCH_AND_ADD64(&counters->latency_hist[bin], 1);
+}
+
+void dart__mpi__profile_record(
+  dart_profile_op_t op,
+  uint64_t          ts_begin,
+  dart_team_t       teamid,
+  dart_unit_t       team_unit,
+  size_t            nbytes,
+  bool              shmem)
+{
+  uint64_t nanosecs = dart__mpi__profile_now() - ts_begin;
+  dart__mpi__profile_update(
+    &dart__mpi__profile_op_counters[op], nanosecs, nbytes, shmem);
+
+  if (op >= DART_PROFILE_OP_LAST_UNIT ||
+      team_unit == DART_UNDEFINED_UNIT_ID ||
+      dart__mpi__profile_unit_counters == NULL) {
+    return;
+  }
+  dart_global_unit_t unit = DART_GLOBAL_UNIT_ID(team_unit);
+  if (teamid != DART_TEAM_ALL &&
+      dart_team_unit_l2g(teamid, DART_TEAM_UNIT_ID(team_unit), &unit)
+        != DART_OK) {
+    return;
+  }
+  if (unit.id < 0 || unit.id >= dart__mpi__profile_nunits) {
+    return;
+  }
+  dart__mpi__profile_update(
+    &dart__mpi__profile_unit_counters[
+      (size_t)op * dart__mpi__profile_nunits + unit.id],
+    nanosecs, nbytes, shmem);
+}
+
+static dart_ret_t dart__mpi__profile_alloc()
+{
+  if (dart__mpi__profile_unit_counters != NULL) {
+    return DART_OK;
+  }
+  size_t nunits;
+  if (dart_size(&nunits) != DART_OK) {
+    return DART_ERR_NOTINIT;
+  }
+  dart__mpi__profile_unit_counters = calloc(
+                                       (size_t)DART_PROFILE_OP_LAST_UNIT *
+                                         nunits,
+                                       sizeof(dart_profile_counters_t));
+  if (dart__mpi__profile_unit_counters == NULL) {
+    DART_LOG_ERROR("dart_profile_enable ! "
+                   "failed to allocate counters for %zu units", nunits);
+    return DART_ERR_OTHER;
+  }
+  dart__mpi__profile_nunits = (int)nunits;
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__profile_init()
+{
+  const char * envstr = getenv("DART_PROFILE");
+  if (envstr != NULL &&
+      (strcmp(envstr, "1") == 0 || strcmp(envstr, "on") == 0)) {
+    dart__mpi__profile_env = true;
+    return dart_profile_enable(true);
+  }
+  return DART_OK;
+}
+
+static void dart__mpi__profile_write(FILE * out, dart_global_unit_t myid)
+{
+  fprintf(out, "# [DART PROFILE] unit %d\n", myid.id);
+  fprintf(out, "# %-22s %12s %12s %16s %14s %14s\n",
+          "operation", "calls", "shmem", "bytes", "total_us", "max_us");
+  for (int op = 0; op < DART_PROFILE_OP_LAST; ++op) {
+    const dart_profile_counters_t * c = &dart__mpi__profile_op_counters[op];
+    if (c->num_calls == 0) {
+      continue;
+    }
+    fprintf(out, "  %-22s %12"PRIu64" %12"PRIu64" %16"PRIu64
+                 " %14.3f %14.3f\n",
+            dart__mpi__profile_op_names[op],
+            c->num_calls, c->num_shmem, c->num_bytes,
+            (double)c->total_ns * 1e-3, (double)c->max_ns * 1e-3);
+    fprintf(out, "  %-22s", "  latency histogram:");
+    for (int b = 0; b < DART_PROFILE_NUM_BINS; ++b) {
+      fprintf(out, " %"PRIu64, c->latency_hist[b]);
+    }
+    fprintf(out, "\n");
+  }
+}
+
+dart_ret_t dart__mpi__profile_fini()
+{
+  if (dart__mpi__profile_env) {
+    dart_global_unit_t myid;
+    dart_myid(&myid);
+    const char * path = getenv("DART_PROFILE_PATH");
+    if (path != NULL) {
+      char filename[4096];
+      snprintf(filename, sizeof(filename), "%s/dart_profile.u%05d.txt",
+               path, myid.id);
+      FILE * out = fopen(filename, "w");
+      if (out == NULL) {
+        DART_LOG_ERROR("dart_exit ! failed to open profile output file %s",
+                       filename);
+      } else {
+        dart__mpi__profile_write(out, myid);
+        fclose(out);
+      }
+    } else {
+      dart__mpi__profile_write(stderr, myid);
+    }
+  }
+  dart__mpi__profile_on  = false;
+  dart__mpi__profile_env = false;
+  free(dart__mpi__profile_unit_counters);
+  dart__mpi__profile_unit_counters = NULL;
+  dart__mpi__profile_nunits        = 0;
+  memset(dart__mpi__profile_op_counters, 0,
+         sizeof(dart__mpi__profile_op_counters));
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_enable(bool enable)
+{
+  if (enable) {
+    dart_ret_t ret = dart__mpi__profile_alloc();
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  dart__mpi__profile_on = enable;
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_is_enabled(bool * enabled)
+{
+  *enabled = dart__mpi__profile_on;
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_reset()
+{
+  memset(dart__mpi__profile_op_counters, 0,
+         sizeof(dart__mpi__profile_op_counters));
+  if (dart__mpi__profile_unit_counters != NULL) {
+    memset(dart__mpi__profile_unit_counters, 0,
+           (size_t)DART_PROFILE_OP_LAST_UNIT * dart__mpi__profile_nunits *
+             sizeof(dart_profile_counters_t));
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_counters(
+  dart_profile_op_t         op,
+  dart_profile_counters_t * counters)
+{
+  if (op < 0 || op >= DART_PROFILE_OP_LAST) {
+    DART_LOG_ERROR("dart_profile_counters ! invalid operation %d", op);
+    return DART_ERR_INVAL;
+  }
+  *counters = dart__mpi__profile_op_counters[op];
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_unit_counters(
+  dart_profile_op_t         op,
+  dart_global_unit_t        unit,
+  dart_profile_counters_t * counters)
+{
+  if (op < 0 || op >= DART_PROFILE_OP_LAST_UNIT) {
+    DART_LOG_ERROR("dart_profile_unit_counters ! "
+                   "operation %d is not profiled per unit", op);
+    return DART_ERR_INVAL;
+  }
+  if (dart__mpi__profile_unit_counters == NULL) {
+    memset(counters, 0, sizeof(dart_profile_counters_t));
+    return DART_OK;
+  }
+  if (unit.id < 0 || unit.id >= dart__mpi__profile_nunits) {
+    DART_LOG_ERROR("dart_profile_unit_counters ! invalid unit %d", unit.id);
+    return DART_ERR_INVAL;
+  }
+  *counters = dart__mpi__profile_unit_counters[
+                (size_t)op * dart__mpi__profile_nunits + unit.id];
+  return DART_OK;
+}
+
+#else // !defined(DART_ENABLE_PROFILING)
+
+dart_ret_t dart_profile_enable(bool enable)
+{
+  if (enable) {
+    DART_LOG_ERROR("dart_profile_enable ! "
+                   "DART has been built without profiling support");
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_is_enabled(bool * enabled)
+{
+  *enabled = false;
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_reset()
+{
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_counters(
+  dart_profile_op_t         op,
+  dart_profile_counters_t * counters)
+{
+  if (op < 0 || op >= DART_PROFILE_OP_LAST) {
+    return DART_ERR_INVAL;
+  }
+  memset(counters, 0, sizeof(dart_profile_counters_t));
+  return DART_OK;
+}
+
+dart_ret_t dart_profile_unit_counters(
+  dart_profile_op_t         op,
+  dart_global_unit_t        unit,
+  dart_profile_counters_t * counters)
+{
+  (void)unit;
+  if (op < 0 || op >= DART_PROFILE_OP_LAST_UNIT) {
+    return DART_ERR_INVAL;
+  }
+  memset(counters, 0, sizeof(dart_profile_counters_t));
+  return DART_OK;
+}
+
+#endif // defined(DART_ENABLE_PROFILING)
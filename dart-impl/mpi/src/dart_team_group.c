@@ -18,6 +18,7 @@
 
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_group_priv.h>
+#include <dash/dart/mpi/dart_coll_hier_priv.h>
 
 #include <limits.h>
 
@@ -642,6 +643,10 @@ dart_ret_t dart_team_create(
                    *newteam, teamid);
     DART_LOG_TRACE("TEAMCREATE - team:%d comm:%p win:%p subcomm:%p",
                    *newteam, team_data->comm, team_data->window, subcomm);
+
+    if (dart__mpi__coll_hier_init_default(team_data) != DART_OK) {
+      return DART_ERR_OTHER;
+    }
   }
 
   return DART_OK;
@@ -666,6 +671,8 @@ dart_ret_t dart_team_destroy(
 
   comm = team_data->comm;
 
+  dart__mpi__coll_hier_fini(team_data);
+
   // free(dart_unit_mapping[index]);
 
   // MPI_Win_free (&(sharedmem_win_list[index]));
@@ -698,6 +705,45 @@ dart_ret_t dart_team_clone(dart_team_t team, dart_team_t *newteam)
   return ret;
 }
 
+dart_ret_t dart_team_set_coll_algorithm(
+  dart_team_t             teamid,
+  dart_coll_algorithm_t   algorithm)
+{
+  DART_LOG_DEBUG("dart_team_set_coll_algorithm() team:%d algorithm:%d",
+                 teamid, algorithm);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_team_set_coll_algorithm ! unknown team %d",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+  switch (algorithm) {
+    case DART_COLL_FLAT:
+      return dart__mpi__coll_hier_fini(team_data);
+    case DART_COLL_HIERARCHICAL:
+      return dart__mpi__coll_hier_init(team_data);
+    default:
+      DART_LOG_ERROR("dart_team_set_coll_algorithm ! "
+                     "invalid algorithm %d", algorithm);
+      return DART_ERR_INVAL;
+  }
+}
+
+dart_ret_t dart_team_get_coll_algorithm(
+  dart_team_t             teamid,
+  dart_coll_algorithm_t * algorithm)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_team_get_coll_algorithm ! unknown team %d",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+  *algorithm = (team_data->coll_hier != NULL) ? DART_COLL_HIERARCHICAL
+                                              : DART_COLL_FLAT;
+  return DART_OK;
+}
+
 dart_ret_t dart_myid(dart_global_unit_t *unitid)
 {
   static dart_unit_t mpi_id = DART_UNDEFINED_UNIT_ID;
@@ -0,0 +1,231 @@
+/**
+ * Measures the performance of global-to-global dash::copy between
+ * arrays with different distribution patterns
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef double ElementType;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef struct benchmark_params_t {
+  int    reps;
+  int    rounds;
+  size_t size_base;
+  size_t blocksize;
+  bool   verify;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  double      time_total_s;
+  double      mb_per_s;
+  bool        valid;
+} measurement;
+
+typedef struct testcase_t {
+  std::string       name;
+  dash::Distribution src_dist;
+  dash::Distribution dst_dist;
+  bool              async;
+} testcase;
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate(
+              const testcase   & tc,
+              benchmark_params   params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.07.global-copy");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  auto bs = params.blocksize;
+  std::vector<testcase> testcases {
+    { "blocked.blocked",      dash::BLOCKED,         dash::BLOCKED,  false },
+    { "blocked.blockcyclic",  dash::BLOCKED,   dash::BLOCKCYCLIC(bs), false },
+    { "blockcyclic.blocked",  dash::BLOCKCYCLIC(bs), dash::BLOCKED,  false },
+    { "cyclic.blocked",       dash::CYCLIC,          dash::BLOCKED,  false },
+    { "blocked.cyclic",       dash::BLOCKED,         dash::CYCLIC,   false },
+    { "cyclic.blocked.async", dash::CYCLIC,          dash::BLOCKED,  true  }
+  };
+
+  int round = 0;
+  while (round < params.rounds) {
+    for (auto & tc : testcases) {
+      auto res = evaluate(tc, params);
+      print_measurement_record(bench_cfg, res, params);
+    }
+    round++;
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(const testcase & tc, benchmark_params params)
+{
+  measurement mes;
+
+  auto size = params.size_base * dash::size();
+  dash::Array<ElementType> src(size, tc.src_dist);
+  dash::Array<ElementType> dst(size, tc.dst_dist);
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = static_cast<ElementType>(src.pattern().global(l));
+  }
+  src.barrier();
+
+  auto ts_tot_start = Timer::Now();
+
+  for (int i = 0; i < params.reps; i++) {
+    if (tc.async) {
+      auto fut = dash::copy_async(src.begin(), src.end(), dst.begin());
+      fut.wait();
+      dst.barrier();
+    } else {
+      dash::copy(src.begin(), src.end(), dst.begin());
+    }
+  }
+
+  mes.time_total_s = Timer::ElapsedSince(ts_tot_start)
+                     / (double)params.reps / 1E6;
+  mes.mb_per_s     = (size * sizeof(ElementType))
+                     / mes.time_total_s / (1024 * 1024);
+  mes.testcase     = tc.name;
+
+  mes.valid = true;
+  if (params.verify) {
+    for (size_t l = 0; l < dst.lsize(); ++l) {
+      if (dst.local[l] !=
+          static_cast<ElementType>(dst.pattern().global(l))) {
+        mes.valid = false;
+        break;
+      }
+    }
+  }
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "size"       << ","
+         << std::setw(24) << "impl"       << ","
+         << std::setw(12) << "total.s"    << ","
+         << std::setw(12) << "mb/s"       << ","
+         << std::setw( 6) << "valid"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(DASH_MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5)  << dash::size() << ","
+         << std::setw(9)  << mpi_impl     << ","
+         << std::setw(12) << params.size_base * dash::size() << ","
+         << std::fixed << setprecision(2) << setw(24) << mes.testcase     << ","
+         << std::fixed << setprecision(8) << setw(12) << mes.time_total_s << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.mb_per_s     << ","
+         << std::setw(6)  << (mes.valid ? "yes" : "no")
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.reps           = 10;
+  params.rounds         = 5;
+  params.size_base      = 1 << 20;
+  params.blocksize      = 1024;
+  params.verify         = false;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-r") {
+      params.reps = atoi(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+    if (flag == "-s") {
+      params.size_base = static_cast<size_t>(atol(argv[i+1]));
+    }
+    if (flag == "-b") {
+      params.blocksize = static_cast<size_t>(atol(argv[i+1]));
+    }
+    if (flag == "-verify") {
+      params.verify = true;
+      --i;
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-r",      "repetitions per round", params.reps);
+  bench_cfg.print_param("-n",      "rounds", params.rounds);
+  bench_cfg.print_param("-s",      "elements per unit", params.size_base);
+  bench_cfg.print_param("-b",      "block size", params.blocksize);
+  bench_cfg.print_param("-verify", "verification", params.verify);
+  bench_cfg.print_section_end();
+}
@@ -135,6 +135,11 @@ std::pair<double, double> test_blas(
   unsigned                 repeat,
   const benchmark_params & params);
 
+std::pair<double, double> test_gemm(
+  extent_t                 sb,
+  unsigned                 repeat,
+  const benchmark_params & params);
+
 std::pair<double, double> test_plasma(
   extent_t                 sb,
   unsigned                 repeat,
@@ -404,6 +409,8 @@ void perform_test(
   std::pair<double, double> t_mmult;
   if (variant == "mkl" || variant == "blas") {
     t_mmult = test_blas(n, num_repeats, params);
+  } else if (variant == "gemm") {
+    t_mmult = test_gemm(n, num_repeats, params);
   } else if (variant == "plasma") {
     t_mmult = test_plasma(n, num_repeats, params, tilesize);
   } else if (variant == "pblas") {
@@ -681,6 +688,48 @@ std::pair<double, double> test_blas(
 #endif
 }
 
+/**
+ * Returns pair of durations (init_secs, multiply_secs) of the built-in
+ * local GEMM kernel used by dash::summa if MKL and BLAS are not available.
+ *
+ */
+std::pair<double, double> test_gemm(
+  extent_t sb,
+  unsigned repeat,
+  const benchmark_params & params)
+{
+  std::pair<double, double> time;
+
+  if (dash::size() != 1) {
+    time.first  = 0;
+    time.second = 0;
+    return time;
+  }
+
+  std::vector<value_t> l_matrix_a(sb * sb);
+  std::vector<value_t> l_matrix_b(sb * sb);
+  std::vector<value_t> l_matrix_c(sb * sb);
+
+  auto ts_init_start = Timer::Now();
+  init_values(l_matrix_a.data(), l_matrix_b.data(), l_matrix_c.data(),
+              sb, params);
+  time.first = Timer::ElapsedSince(ts_init_start);
+
+  auto ts_multiply_start = Timer::Now();
+  for (unsigned i = 0; i < repeat; ++i) {
+    dash::internal::gemm(
+      l_matrix_a.data(),
+      l_matrix_b.data(),
+      l_matrix_c.data(),
+      sb, sb, sb,
+      dash::ROW_MAJOR,
+      static_cast<int>(params.threads));
+  }
+  time.second = Timer::ElapsedSince(ts_multiply_start);
+
+  return time;
+}
+
 /**
  * Returns pair of durations (init_secs, multiply_secs).
  *
@@ -1158,6 +1207,15 @@ void print_params(
 #else
   conf.print_param("data type",                     "float");
 #endif
+#if defined(DASH_ENABLE_MKL)
+  conf.print_param("local kernel",                  "mkl");
+#elif defined(DASH_ENABLE_BLAS)
+  conf.print_param("local kernel",                  "blas");
+#else
+  conf.print_param("local kernel",                  "gemm");
+#endif
+  conf.print_param("gemm micro-kernel",
+                   dash::internal::gemm_kernel<value_t>::name());
   conf.print_section_end();
 
   conf.print_section_start("Runtime arguments");
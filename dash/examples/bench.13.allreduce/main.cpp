@@ -7,6 +7,7 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <vector>
 
 using std::cout;
 using std::endl;
@@ -23,6 +24,7 @@ typedef typename dash::util::BenchmarkParams::config_params_type
 typedef struct benchmark_params_t {
   int    reps;
   int    rounds;
+  size_t nelem;
 } benchmark_params;
 
 typedef struct measurement_t {
@@ -95,12 +97,18 @@ int main(int argc, char** argv)
 
   int     multiplier = 1;
   int          round = 0;
-  std::array<std::string, 5> testcases {{
+  std::array<std::string, 11> testcases {{
                             "dart_allreduce.minmax",
                             "dart_allreduce.min",
                             "dart_allreduce.shared",
                             "dart_allreduce.custom",
-                            "dart_allreduce.lambda"
+                            "dart_allreduce.lambda",
+                            "dart_allreduce.sum.flat",
+                            "dart_allreduce.sum.hier",
+                            "dart_bcast.flat",
+                            "dart_bcast.hier",
+                            "dart_barrier.flat",
+                            "dart_barrier.hier"
                             }};
 
   while(round < params.rounds) {
@@ -129,6 +137,20 @@ measurement evaluate(int reps, std::string testcase, benchmark_params params)
   float lmin = r;
   float lmax = 1000000 - r;
 
+  // Test cases with suffix '.hier' use hierarchical collectives
+  dart_team_t team = dash::Team::All().dart_id();
+  dart_coll_algorithm_t prev_algorithm;
+  dart_team_get_coll_algorithm(team, &prev_algorithm);
+  bool hier = testcase.size() > 5 &&
+              testcase.compare(testcase.size() - 5, 5, ".hier") == 0;
+  dart_team_set_coll_algorithm(
+    team, hier ? DART_COLL_HIERARCHICAL : DART_COLL_FLAT);
+
+  std::vector<double> sendbuf(params.nelem, static_cast<double>(r));
+  std::vector<double> recvbuf(params.nelem);
+
+  dart_barrier(team);
+
   auto ts_tot_start = Timer::Now();
 
   for (int i = 0; i < reps; i++) {
@@ -227,11 +249,35 @@ measurement evaluate(int reps, std::string testcase, benchmark_params params)
           );
       dart_type_destroy(&new_type);
       dart_op_destroy(&new_op);
+    } else if (testcase == "dart_allreduce.sum.flat" ||
+               testcase == "dart_allreduce.sum.hier") {
+      dart_allreduce(
+          sendbuf.data(),                     // send buffer
+          recvbuf.data(),                     // receive buffer
+          params.nelem,                       // buffer size
+          dash::dart_datatype<double>::value, // data type
+          DART_OP_SUM,                        // operation
+          team                                // team
+          );
+    } else if (testcase == "dart_bcast.flat" ||
+               testcase == "dart_bcast.hier") {
+      dart_bcast(
+          sendbuf.data(),                     // buffer
+          params.nelem,                       // buffer size
+          dash::dart_datatype<double>::value, // data type
+          dart_team_unit_t{static_cast<dart_unit_t>(i % dash::size())}, // root
+          team                                // team
+          );
+    } else if (testcase == "dart_barrier.flat" ||
+               testcase == "dart_barrier.hier") {
+      dart_barrier(team);
     }
   }
 
   mes.time_total_s   = Timer::ElapsedSince(ts_tot_start) / (double)reps / 1E6;
   mes.testcase       = testcase;
+
+  dart_team_set_coll_algorithm(team, prev_algorithm);
   return mes;
 }
 
@@ -269,6 +315,7 @@ benchmark_params parse_args(int argc, char * argv[])
   benchmark_params params;
   params.reps           = 100;
   params.rounds         = 10;
+  params.nelem          = 1024;
 
   for (auto i = 1; i < argc; i += 2) {
     std::string flag = argv[i];
@@ -278,6 +325,9 @@ benchmark_params parse_args(int argc, char * argv[])
     if (flag == "-n") {
       params.rounds = atoi(argv[i+1]);
     }
+    if (flag == "-s") {
+      params.nelem = atoi(argv[i+1]);
+    }
   }
   return params;
 }
@@ -293,5 +343,6 @@ void print_params(
   bench_cfg.print_section_start("Runtime arguments");
   bench_cfg.print_param("-r",    "repetitions per round", params.reps);
   bench_cfg.print_param("-n",    "rounds", params.rounds);
+  bench_cfg.print_param("-s",    "elements of sum and bcast", params.nelem);
   bench_cfg.print_section_end();
 }
@@ -0,0 +1,253 @@
+/**
+ * Measures the performance of distributed prefix scans on dash containers
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <numeric>
+#include <vector>
+#ifdef MPI_IMPL_ID
+#include <mpi.h>
+#endif
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef struct benchmark_params_t {
+  int    reps;
+  int    rounds;
+  size_t size_base;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  double      time_total_s;
+  double      mkeys_per_s;
+} measurement;
+
+enum experiment_t{
+  DASHINCLUSIVE = 0,
+  DASHEXCLUSIVE,
+  DASHLAMBDA,
+  MPIEXSCAN
+};
+
+#ifdef HAVE_ASSERT
+#include <cassert>
+#define ASSERT_EQ(_e, _a) do {  \
+  assert((_e) == (_a));         \
+} while (0)
+#else
+#define ASSERT_EQ(_e, _a) do {  \
+  dash__unused(_e);             \
+  dash__unused(_a);             \
+} while (0)
+#endif
+
+std::array<const char*, 4> testcase_str {{
+                          "scan.dash.inclusive",
+                          "scan.dash.exclusive",
+                          "scan.dash.lambda",
+                          "scan.mpi.exscan"
+                          }};
+
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+
+measurement evaluate(
+              int reps,
+              experiment_t     testcase,
+              benchmark_params params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  measurement res;
+
+  dash::util::BenchmarkParams bench_params("bench.15.scan");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  int          round = 0;
+#ifdef MPI_IMPL_ID
+  std::array<experiment_t, 4> testcases{{
+    DASHINCLUSIVE,
+    DASHEXCLUSIVE,
+    DASHLAMBDA,
+    MPIEXSCAN
+  }};
+#else
+  std::array<experiment_t, 3> testcases{{
+    DASHINCLUSIVE,
+    DASHEXCLUSIVE,
+    DASHLAMBDA
+  }};
+#endif
+
+  while(round < params.rounds) {
+    for(auto testcase : testcases){
+      res = evaluate(params.reps, testcase, params);
+      print_measurement_record(bench_cfg, res, params);
+    }
+    round++;
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(int reps, experiment_t testcase, benchmark_params params)
+{
+  measurement mes;
+
+  auto   size   = params.size_base * dash::size();
+  // Every element has value 1, the inclusive scan of an element is its
+  // global index increased by 1:
+  dash::Array<double> in(size, dash::BLOCKED);
+  dash::Array<double> out(size, dash::BLOCKED);
+  std::fill(in.lbegin(), in.lend(), 1.0);
+  in.barrier();
+
+  auto g_offset = in.pattern().global(0);
+
+  auto ts_tot_start = Timer::Now();
+
+  for (int i = 0; i < reps; i++) {
+    if (testcase == DASHINCLUSIVE) {
+      dash::inclusive_scan(in.begin(), in.end(), out.begin());
+      ASSERT_EQ(g_offset + in.lsize(), out.local[in.lsize() - 1]);
+    } else if (testcase == DASHEXCLUSIVE) {
+      dash::exclusive_scan(in.begin(), in.end(), out.begin(), 0.0);
+      ASSERT_EQ(g_offset, out.local[0]);
+    } else if (testcase == DASHLAMBDA) {
+      dash::inclusive_scan(in.begin(), in.end(), out.begin(),
+                           [](double a, double b) { return a + b; });
+      ASSERT_EQ(g_offset + in.lsize(), out.local[in.lsize() - 1]);
+    }
+#ifdef MPI_IMPL_ID
+    else if (testcase == MPIEXSCAN) {
+      double * l_out = out.lbegin();
+      std::partial_sum(in.lbegin(), in.lend(), l_out);
+      double l_total = l_out[in.lsize() - 1];
+      double carry   = 0.0;
+      MPI_Exscan(&l_total, &carry, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      if (dash::myid() != 0) {
+        for (size_t l = 0; l < in.lsize(); ++l) {
+          l_out[l] += carry;
+        }
+      }
+      ASSERT_EQ(g_offset + in.lsize(), out.local[in.lsize() - 1]);
+    }
+#endif
+  }
+
+  mes.time_total_s   = Timer::ElapsedSince(ts_tot_start) / (double)reps / 1E6;
+  mes.mkeys_per_s    = (size / mes.time_total_s) / 1E6;
+  mes.testcase       = testcase_str[testcase];
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "size"       << ","
+         << std::setw(30) << "impl"       << ","
+         << std::setw(12) << "total.s"    << ","
+         << std::setw(12) << "mkeys/s"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+        cout << std::right
+         << std::setw(5)  << dash::size() << ","
+         << std::setw(9)  << mpi_impl     << ","
+         << std::setw(12) << params.size_base * dash::size() << ","
+         << std::fixed << setprecision(2) << setw(30) << mes.testcase   << ","
+         << std::fixed << setprecision(8) << setw(12) << mes.time_total_s << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.mkeys_per_s
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.reps           = 10;
+  params.rounds         = 10;
+  params.size_base      = 1 << 20;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-r") {
+      params.reps = atoi(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+    if (flag == "-s") {
+      params.size_base = static_cast<size_t>(atol(argv[i+1]));
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-r",    "repetitions per round", params.reps);
+  bench_cfg.print_param("-n",    "rounds", params.rounds);
+  bench_cfg.print_param("-s",    "elements per unit", params.size_base);
+  bench_cfg.print_section_end();
+}
@@ -0,0 +1,222 @@
+/**
+ * Measures the performance of atomic updates of a distributed histogram
+ * using per-element atomic operations and batched atomic operations.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef struct benchmark_params_t {
+  int    reps;
+  int    rounds;
+  size_t num_keys;
+  size_t num_bins;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  double      time_total_s;
+  double      mupdates_per_s;
+} measurement;
+
+enum experiment_t {
+  ATOMIC_ADD = 0,
+  ATOMIC_BATCH_ADD
+};
+
+std::array<const char*, 2> testcase_str {{
+                          "atomic.add",
+                          "atomic.batch_add"
+                          }};
+
+typedef dash::Array<dash::Atomic<int>> histo_t;
+
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate(
+              int                      reps,
+              experiment_t             testcase,
+              const std::vector<int> & keys,
+              benchmark_params         params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  measurement res;
+
+  dash::util::BenchmarkParams bench_params("bench.16.atomic-batch");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  std::mt19937 rng(31337 + dash::myid());
+  std::uniform_int_distribution<int> key_dist(0, params.num_bins - 1);
+  std::vector<int> keys(params.num_keys);
+  for (auto & key : keys) {
+    key = key_dist(rng);
+  }
+
+  std::array<experiment_t, 2> testcases{{
+    ATOMIC_ADD,
+    ATOMIC_BATCH_ADD
+  }};
+
+  int round = 0;
+  while (round < params.rounds) {
+    for (auto testcase : testcases) {
+      res = evaluate(params.reps, testcase, keys, params);
+      print_measurement_record(bench_cfg, res, params);
+    }
+    round++;
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(
+  int                      reps,
+  experiment_t             testcase,
+  const std::vector<int> & keys,
+  benchmark_params         params)
+{
+  measurement mes;
+
+  histo_t histo(params.num_bins, dash::BLOCKED);
+  std::vector<int> ones(keys.size(), 1);
+  histo.barrier();
+
+  auto ts_tot_start = Timer::Now();
+
+  for (int i = 0; i < reps; i++) {
+    if (testcase == ATOMIC_ADD) {
+      for (auto key : keys) {
+        dash::atomic::add(histo[key], 1);
+      }
+    } else if (testcase == ATOMIC_BATCH_ADD) {
+      dash::atomic::batch_add(histo, keys, ones);
+    }
+    histo.barrier();
+  }
+
+  mes.time_total_s   = Timer::ElapsedSince(ts_tot_start) / (double)reps / 1E6;
+  mes.mupdates_per_s = (keys.size() * dash::size() / mes.time_total_s) / 1E6;
+  mes.testcase       = testcase_str[testcase];
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "keys"       << ","
+         << std::setw(12) << "bins"       << ","
+         << std::setw(20) << "impl"       << ","
+         << std::setw(12) << "total.s"    << ","
+         << std::setw(12) << "mupdates/s"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(DASH_MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5)  << dash::size() << ","
+         << std::setw(9)  << mpi_impl     << ","
+         << std::setw(12) << params.num_keys * dash::size() << ","
+         << std::setw(12) << params.num_bins << ","
+         << std::fixed << setprecision(2) << setw(20) << mes.testcase   << ","
+         << std::fixed << setprecision(8) << setw(12) << mes.time_total_s << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.mupdates_per_s
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.reps           = 10;
+  params.rounds         = 3;
+  params.num_keys       = 1 << 16;
+  params.num_bins       = 1 << 12;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-r") {
+      params.reps = atoi(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+    if (flag == "-k") {
+      params.num_keys = static_cast<size_t>(atol(argv[i+1]));
+    }
+    if (flag == "-b") {
+      params.num_bins = static_cast<size_t>(atol(argv[i+1]));
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-r",    "repetitions per round", params.reps);
+  bench_cfg.print_param("-n",    "rounds", params.rounds);
+  bench_cfg.print_param("-k",    "keys per unit", params.num_keys);
+  bench_cfg.print_param("-b",    "histogram bins", params.num_bins);
+  bench_cfg.print_section_end();
+}
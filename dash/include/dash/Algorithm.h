@@ -25,6 +25,7 @@
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
 #include <dash/algorithm/Sort.h>
+#include <dash/algorithm/Scan.h>
 
 #include <dash/algorithm/SUMMA.h>
 
@@ -9,6 +9,7 @@
 #include <dash/memory/GlobStaticMem.h>
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
+#include <dash/Onesided.h>
 #include <dash/Shared.h>
 #include <dash/HView.h>
 #include <dash/Meta.h>
@@ -1440,6 +1441,95 @@ public:
     return true;
   }
 
+  /**
+   * Redistributes the array's elements to the specified pattern, e.g.
+   * a \c dash::DynamicPattern rebalanced using
+   * \c dash::DynamicPattern::balance.
+   *
+   * Every unit allocates local memory for the new distribution and reads
+   * the elements in its new local range with a single one-sided transfer
+   * from every unit that previously owned a part of this range.
+   * Requires a one-dimensional pattern with blocked layout and the same
+   * size as the array's current pattern.
+   *
+   * Collective operation.
+   *
+   * \returns  Number of bytes the calling unit received from other units.
+   */
+  size_type redistribute(const PatternType & pattern)
+  {
+    static_assert(
+      PatternType::ndim() == 1 &&
+      PatternType::layout_properties::blocked,
+      "Array.redistribute requires a 1-dimensional pattern with blocked "
+      "layout");
+    DASH_LOG_TRACE("Array.redistribute()");
+    // Pattern might be a reference to this array's pattern:
+    PatternType new_pattern(pattern);
+    if (new_pattern.size() != m_size) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "Array.redistribute: pattern size " << new_pattern.size() << " " <<
+        "differs from array size " << m_size);
+    }
+    auto new_lsize = new_pattern.local_size();
+    PtrGlobMemType_t new_globmem(
+      new glob_mem_type(new_pattern.local_capacity(), *m_team));
+    value_type * new_lbegin = new_globmem->lbegin();
+
+    size_type nbytes_recv = 0;
+    if (new_lsize > 0) {
+      // Global index range of the calling unit in the new pattern:
+      index_type g_begin = new_pattern.global(0);
+      index_type g_end   = g_begin + new_lsize;
+      for (team_unit_t u{0}; u < static_cast<int>(m_team->size()); ++u) {
+        auto old_lsize = m_pattern.local_size(u);
+        if (old_lsize == 0) {
+          continue;
+        }
+        index_type old_g_begin = m_pattern.global(u, 0);
+        index_type old_g_end   = old_g_begin + old_lsize;
+        index_type copy_begin  = std::max(g_begin, old_g_begin);
+        index_type copy_end    = std::min(g_end,   old_g_end);
+        if (copy_begin >= copy_end) {
+          continue;
+        }
+        auto         nelem = copy_end - copy_begin;
+        value_type * dest  = new_lbegin + (copy_begin - g_begin);
+        if (u == m_myid) {
+          std::copy(m_lbegin + (copy_begin - old_g_begin),
+                    m_lbegin + (copy_end   - old_g_begin),
+                    dest);
+          continue;
+        }
+        DASH_LOG_TRACE("Array.redistribute", "unit:", u,
+                       "offset:", copy_begin - old_g_begin,
+                       "nelem:",  nelem);
+        dash::internal::get(
+          m_globmem->at(u, copy_begin - old_g_begin).dart_gptr(),
+          dest,
+          nelem);
+        nbytes_recv += nelem * sizeof(value_type);
+      }
+      m_globmem->flush_local();
+    }
+    // Old local memory must not be released before all units completed
+    // reading from it:
+    m_team->barrier();
+
+    m_pattern   = new_pattern;
+    m_globmem   = std::move(new_globmem);
+    m_lsize     = m_pattern.local_size();
+    m_lcapacity = m_pattern.local_capacity();
+    m_begin     = iterator(m_globmem.get(), m_pattern);
+    m_end       = iterator(m_begin) + m_size;
+    m_lbegin    = m_globmem->lbegin();
+    m_lend      = m_lbegin + m_lsize;
+    m_team->barrier();
+    DASH_LOG_TRACE_VAR("Array.redistribute >", nbytes_recv);
+    return nbytes_recv;
+  }
+
 private:
   bool allocate(
     const PatternType                 & pattern,
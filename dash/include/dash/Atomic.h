@@ -117,6 +117,7 @@ std::ostream & operator<<(
 #include <dash/atomic/GlobAtomicRef.h>
 #include <dash/atomic/GlobAtomicAsyncRef.h>
 #include <dash/atomic/Operation.h>
+#include <dash/atomic/BatchOperation.h>
 
 #endif // DASH__ATOMIC_H__INCLUDED
 
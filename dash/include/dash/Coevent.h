@@ -12,8 +12,21 @@
 #include <dash/coarray/CoEventIter.h>
 #include <dash/coarray/CoEventRef.h>
 
+#include <dash/internal/Backoff.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+
 namespace dash {
 
+class Coevent;
+
+template<class EventIt>
+EventIt wait_any(EventIt first, EventIt last, int count = 1);
+
 /**
  * \ingroup DashCoarrayConcept
  *
@@ -23,8 +36,14 @@ namespace dash {
  * Coevent can be used for point-to-point synchronization. Events can be posted
  * to any image. Waiting on non-local events is not supported.
  *
- * \note Coevents might deadlock if multiple units are pinned to the same
- *       cpu-core. This is due to progress problems in MPI.
+ * Waiting units poll their event counter in local memory with exponential
+ * backoff. Coevents created with \c coarray::coevent_notify::message
+ * additionally send a zero-byte message for every posted event so waiting
+ * units block in a receive instead of polling.
+ *
+ * \note Polling coevents might deadlock if multiple units are pinned to
+ *       the same cpu-core. This is due to progress problems in MPI.
+ *       Use \c coarray::coevent_notify::message in this case.
  *
  * Example:
  *
@@ -47,6 +66,7 @@ public:
   using const_iterator = coarray::CoEventIter;
   using reference      = coarray::CoEventRef;
   using size_type      = int;
+  using notify_type    = coarray::coevent_notify;
 
 private:
   dash::Array<event_cnt_t> _event_counts;
@@ -56,29 +76,36 @@ public:
   /**
    * Constructor to setup and initialize an Coevent.
    */
-  explicit Coevent(Team & team = dash::Team::All())
-    : _team(&team) {
+  explicit Coevent(
+    Team        & team   = dash::Team::All(),
+    notify_type   notify = notify_type::poll)
+    : _team(&team),
+      _notify(notify) {
       if(dash::is_initialized()){
         initialize(team);
       }
     }
 
   iterator begin() noexcept {
-    return iterator(static_cast<gptr_t>(_event_counts.begin()));
+    return iterator(static_cast<gptr_t>(_event_counts.begin()),
+                    *_team, _notify);
   }
 
   const_iterator begin() const noexcept {
-    return const_iterator(static_cast<gptr_t>(_event_counts.begin()));
+    return const_iterator(static_cast<gptr_t>(_event_counts.begin()),
+                          *_team, _notify);
   }
 
   iterator end() {
     DASH_ASSERT_MSG(dash::is_initialized(), "DASH is not initialized");
-    return iterator(static_cast<gptr_t>(_event_counts.end()));
+    return iterator(static_cast<gptr_t>(_event_counts.end()),
+                    *_team, _notify);
   }
 
   const_iterator end() const {
     DASH_ASSERT_MSG(dash::is_initialized(), "DASH is not initialized");
-    return const_iterator(static_cast<gptr_t>(_event_counts.end()));
+    return const_iterator(static_cast<gptr_t>(_event_counts.end()),
+                          *_team, _notify);
   }
 
   size_type size() const {
@@ -91,25 +118,46 @@ public:
    * This function is thread-safe
    */
   inline void wait(int count = 1) {
-    auto gref = _event_counts.at(_team->myid().id);
-    int current;
-    do {
-#ifdef DASH_DEBUG
-      // avoid spamming the logs while busy waiting
-      DASH_LOG_DEBUG("waiting for event at gptr",
-                     static_cast<gptr_t>(_event_counts.begin()
-                                         +_team->myid().id));
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-#endif
-      current = gref.get();
-    } while (current < count);
-    // decrement the counter
-    gref.sub(count);
+    DASH_LOG_DEBUG("waiting for", count, "events at gptr",
+                   static_cast<gptr_t>(_event_counts.begin()
+                                       +_team->myid().id));
+    if (_notify == notify_type::message) {
+      // Every notification is sent after its event has been counted:
+      receive_notifications(count);
+      consume(count);
+      return;
+    }
+    dash::internal::Backoff backoff;
+    while (!try_consume(count, !backoff.is_spinning())) {
+      backoff.pause();
+    }
   }
 
+  /**
+   * Consume the given number of incoming events if they arrived already,
+   * does not block.
+   * This function is thread-safe
+   *
+   * \return  true if the events have been consumed, false otherwise
+   */
+  inline bool try_wait(int count = 1) {
+    return try_consume(count, true);
+  }
+
+  /**
+   * returns the number of arrived events at this unit
+   */
   inline int test() {
     DASH_LOG_DEBUG("test for events on this unit");
-    return _event_counts.at(static_cast<int>(_team->myid())).load();
+    sync_local();
+    return local_count();
+  }
+
+  /**
+   * Notification of waiting units used by this coevent.
+   */
+  inline notify_type notify() const noexcept {
+    return _notify;
   }
 
   /**
@@ -119,7 +167,18 @@ public:
   inline void initialize(Team & team = dash::Team::All()) {
     if(!_is_initialized){
       _team = &team;
-      _event_counts.allocate(_team->size());
+      _event_counts.allocate(_team->size(), *_team);
+      if (_notify == notify_type::message) {
+        // Notification tags are derived from the segment id, the segment
+        // id is identical at all units of the team:
+        auto segid = _event_counts.begin().dart_gptr().segid;
+        if (segid < 1 || segid > coarray::coevent_notify_max_segid) {
+          DASH_THROW(
+            dash::exception::RuntimeError,
+            "Coevent: segment id " << segid << " of event counters exceeds "
+            "range of notification tags");
+        }
+      }
       dash::fill(_event_counts.begin(), _event_counts.end(), 0);
       _event_counts.barrier();
       _is_initialized = true;
@@ -136,7 +195,7 @@ public:
   inline reference operator()(const int & unit) DASH_ASSERT_NOEXCEPT {
     DASH_ASSERT_MSG(dash::is_initialized(), "DASH is not initialized");
     auto ptr = static_cast<gptr_t>(_event_counts.begin() + unit);
-    return reference(ptr);
+    return reference(ptr, *_team, _notify);
   }
 
   /**
@@ -147,10 +206,168 @@ public:
   }
 
 private:
-  Team * _team;
-  bool   _is_initialized = false;
+  template<class EventIt>
+  friend EventIt wait_any(EventIt first, EventIt last, int count);
+
+  /**
+   * Number of events counted in local memory, might not include events
+   * posted since the last call of \c sync_local().
+   */
+  inline int local_count() const {
+    auto lcount = reinterpret_cast<const volatile int *>(
+                    _event_counts.lbegin());
+    int  count  = *lcount;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return count;
+  }
+
+  /**
+   * Synchronize the local event counter with completed remote updates,
+   * also drives progress of the communication backend.
+   */
+  inline void sync_local() const {
+    DASH_ASSERT_RETURNS(
+      dart_flush(_event_counts[_team->myid().id].dart_gptr()),
+      DART_OK);
+  }
+
+  /**
+   * Consume the given number of events if they arrived already.
+   */
+  inline bool try_consume(int count, bool sync) {
+    if (local_count() < count) {
+      if (!sync) {
+        return false;
+      }
+      sync_local();
+      if (local_count() < count) {
+        return false;
+      }
+    }
+    if (_notify == notify_type::message) {
+      receive_notifications(count);
+    }
+    consume(count);
+    return true;
+  }
+
+  /**
+   * Decrement the local event counter by the given number of events.
+   */
+  inline void consume(int count) {
+    _event_counts.at(_team->myid().id).sub(count);
+  }
+
+  /**
+   * Block until the given number of event notifications arrived.
+   */
+  inline void receive_notifications(int count) {
+    int tag = coarray::coevent_notify_tag(_event_counts.begin().dart_gptr());
+    for (int n = 0; n < count; ++n) {
+      DASH_ASSERT_RETURNS(
+        dart_team_recv_any(nullptr, 0, DART_TYPE_BYTE, tag,
+                           _team->dart_id(), nullptr),
+        DART_OK);
+    }
+  }
+
+private:
+  Team        * _team;
+  notify_type   _notify         = notify_type::poll;
+  bool          _is_initialized = false;
 };
 
+/**
+ * Wait for the given number of incoming events at any of the coevents in
+ * the range, events are only consumed at the returned coevent.
+ * Coevents are polled in local memory with exponential backoff,
+ * independent of their notification type.
+ *
+ * \return  Iterator to the coevent at which the events have been
+ *          consumed.
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<class EventIt>
+EventIt wait_any(
+  /// Iterator to the first coevent, the referenced type must be
+  /// convertible to \c Coevent &
+  EventIt first,
+  /// Iterator past the final coevent
+  EventIt last,
+  /// Number of events to wait for
+  int     count)
+{
+  DASH_ASSERT_MSG(first != last, "wait_any on empty range of coevents");
+  dash::internal::Backoff backoff;
+  while (true) {
+    bool sync = !backoff.is_spinning();
+    for (auto it = first; it != last; ++it) {
+      Coevent & event = *it;
+      if (event.try_consume(count, sync)) {
+        return it;
+      }
+    }
+    backoff.pause();
+  }
+}
+
+/**
+ * Wait for the given number of incoming events at any of the coevents.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Coevent ev_a, ev_b;
+ *   auto idx = dash::wait_any({ ev_a, ev_b });
+ * \endcode
+ *
+ * \return  Index of the coevent at which the events have been consumed.
+ *
+ * \ingroup DashCoarrayLib
+ */
+inline size_t wait_any(
+  std::initializer_list<std::reference_wrapper<Coevent>> events,
+  int                                                    count = 1)
+{
+  return static_cast<size_t>(
+           wait_any(events.begin(), events.end(), count) - events.begin());
+}
+
+/**
+ * Wait for the given number of incoming events at every coevent in the
+ * range.
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<class EventIt>
+void wait_all(
+  /// Iterator to the first coevent, the referenced type must be
+  /// convertible to \c Coevent &
+  EventIt first,
+  /// Iterator past the final coevent
+  EventIt last,
+  /// Number of events to wait for at every coevent
+  int     count = 1)
+{
+  for (auto it = first; it != last; ++it) {
+    Coevent & event = *it;
+    event.wait(count);
+  }
+}
+
+/**
+ * Wait for the given number of incoming events at every coevent.
+ *
+ * \ingroup DashCoarrayLib
+ */
+inline void wait_all(
+  std::initializer_list<std::reference_wrapper<Coevent>> events,
+  int                                                    count = 1)
+{
+  wait_all(events.begin(), events.end(), count);
+}
+
 } // namespace dash
 
 #endif /* DASH__COEVENT_H__INCLUDED */
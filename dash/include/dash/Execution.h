@@ -0,0 +1,77 @@
+#ifndef DASH__EXECUTION_H__INCLUDED
+#define DASH__EXECUTION_H__INCLUDED
+
+#include <type_traits>
+
+namespace dash {
+
+/**
+ * Execution policies of DASH algorithms, corresponding to the execution
+ * policies in \c std::execution.
+ *
+ * Execution policies specify how a unit processes the elements of a
+ * global range in its local memory. Algorithms invoked with a parallel
+ * policy use the threads available to the unit as specified by
+ * \c dash::util::UnitLocality::num_domain_threads.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::fill(dash::execution::par, array.begin(), array.end(), 42);
+ *   auto sum = dash::accumulate(dash::execution::par_unseq,
+ *                               array.begin(), array.end(), 0);
+ * \endcode
+ *
+ * \ingroup DashAlgorithms
+ */
+namespace execution {
+
+/**
+ * Execution policy specifying that local elements are processed
+ * sequentially by the calling thread.
+ */
+class sequenced_policy { };
+
+/**
+ * Execution policy specifying that local elements are processed by
+ * multiple threads of the unit.
+ * Element access functions may be invoked concurrently and must not cause
+ * data races.
+ */
+class parallel_policy { };
+
+/**
+ * Execution policy specifying that local elements are processed by
+ * multiple threads of the unit and may be vectorized.
+ * Element access functions may be invoked concurrently and interleaved
+ * within a single thread and therefore must not synchronize.
+ */
+class parallel_unsequenced_policy { };
+
+constexpr sequenced_policy            seq { };
+constexpr parallel_policy             par { };
+constexpr parallel_unsequenced_policy par_unseq { };
+
+} // namespace execution
+
+/**
+ * Type trait to determine whether \c T is an execution policy type.
+ */
+template <class T>
+struct is_execution_policy : std::false_type { };
+
+template <>
+struct is_execution_policy<dash::execution::sequenced_policy>
+: std::true_type { };
+
+template <>
+struct is_execution_policy<dash::execution::parallel_policy>
+: std::true_type { };
+
+template <>
+struct is_execution_policy<dash::execution::parallel_unsequenced_policy>
+: std::true_type { };
+
+} // namespace dash
+
+#endif // DASH__EXECUTION_H__INCLUDED
@@ -41,7 +41,7 @@ public:
   : _ready(false)
   { }
 
-  Future(ResultT & result)
+  Future(const ResultT & result)
   : _value(result),
     _ready(true)
   { }
@@ -6,6 +6,8 @@
 #include <dash/GlobPtr.h>
 #include <dash/Onesided.h>
 
+#include <dash/memory/WriteCombineBuffer.h>
+
 #include <dash/iterator/internal/GlobRefBase.h>
 
 
@@ -38,6 +40,9 @@ class GlobRef;
  *   array.flush();
  *   // From here, all changes are published
  * \endcode
+ *
+ * If write-combining is enabled, assigned values are buffered and
+ * coalesced to larger transfers, see \c dash::WriteCombineBuffer.
  */
 template<typename T>
 class GlobAsyncRef
@@ -276,6 +281,11 @@ public:
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", new_value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", _gptr);
 
+    if (dash::WriteCombineBuffer::put(
+          _gptr, &new_value, sizeof(nonconst_value_type))) {
+      return;
+    }
+
     _value = new_value;
 
     dart_handle_t new_handle;
@@ -317,6 +327,7 @@ public:
    */
   void flush() const
   {
+    dash::WriteCombineBuffer::flush();
     DASH_ASSERT_RETURNS(
       dart_flush(_gptr),
       DART_OK
@@ -4,5 +4,6 @@
 #include <dash/memory/GlobHeapMem.h>
 #include <dash/memory/GlobStaticMem.h>
 #include <dash/memory/GlobUnitMem.h>
+#include <dash/memory/WriteCombineBuffer.h>
 
 #endif // DASH__MEMORY_H__INCLUDED
@@ -2,42 +2,86 @@
 #define DASH__SHARED_COUNTER_H_
 
 #include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/GlobRef.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace dash {
 
 /**
- * A simple shared counter that allows atomic increment-
- * and decrement operations.
+ * A shared counter that allows atomic increment- and decrement
+ * operations.
  *
- * TODO: Should probably be based on MPI_ACCUMULATE.
+ * Counter values are distributed to a configurable number of shards
+ * located at units evenly spaced in the team. Every unit increments the
+ * shard of its own group of units using atomic accumulate operations,
+ * so increments of units in different groups do not contend.
+ *
+ * Reading the counter value fetches the values of all shards atomically
+ * with non-blocking operations that are completed by a single flush,
+ * so the latency of a read is independent of the number of shards.
+ * Relaxed reads return a locally cached counter value that is refreshed
+ * asynchronously.
  */
 template<typename ValueType = int>
 class SharedCounter {
 private:
-  typedef SharedCounter<ValueType> self_t;
+  typedef SharedCounter<ValueType>               self_t;
+  typedef dash::GlobRef<dash::Atomic<ValueType>> atomic_ref_t;
 
 public:
   /**
-   * Constructor.
+   * Constructor, creates a counter with one shard per unit in
+   * \c dash::Team::All().
    */
   SharedCounter()
-  : _num_units(dash::Team::All().size()),
-    _myid(dash::Team::All().myid()),
-    _local_counts(_num_units)
-  {
-    _local_counts.local[0] = 0;
-    _local_counts.barrier();
-  }
+  : SharedCounter(dash::Team::All())
+  { }
 
+  /**
+   * Constructor, creates a counter with one shard per unit in the given
+   * team.
+   */
   SharedCounter(dash::Team& team)
+  : SharedCounter(team, team.size())
+  { }
+
+  /**
+   * Constructor, creates a counter with the given number of shards.
+   * A single shard minimizes the cost of reads, one shard per unit
+   * minimizes contention of increments.
+   */
+  SharedCounter(
+    dash::Team & team,
+    /// Number of shards, at least 1 and at most the size of the team
+    size_t       num_shards)
   : _num_units(team.size()),
     _myid(team.myid()),
-    _local_counts(_num_units, team)
+    _num_shards(std::max<size_t>(1, std::min(num_shards, team.size()))),
+    _local_counts(_num_units, team),
+    _fetch_buf(_num_shards),
+    _refresh_buf(_num_shards)
   {
     _local_counts.local[0] = 0;
     _local_counts.barrier();
   }
 
+  ~SharedCounter()
+  {
+    if (_refresh_pending) {
+      // Fetches of relaxed reads must complete before their buffers are
+      // released:
+      flush_fetches();
+    }
+  }
+
+  SharedCounter(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)       = delete;
+
   /**
    * Increment the shared counter value, atomic operation.
    */
@@ -45,7 +89,7 @@ public:
     /// Increment value
     ValueType increment)
   {
-    _local_counts[_myid] += increment;
+    shard_ref(shard_of(_myid)).add(increment);
   }
 
   /**
@@ -55,35 +99,140 @@ public:
     /// Decrement value
     ValueType increment)
   {
-    _local_counts[_myid] -= increment;
+    shard_ref(shard_of(_myid)).sub(increment);
   }
 
   /**
    * Read the current value of the shared counter.
-   * Accumulates increment/decrement values of every unit.
-   * Reading a shared is not atomic, use Team::barrier() to synchronize.
+   * Accumulates the values of all shards, every shard is read atomically.
+   * Increments completed before the read started are guaranteed to be
+   * included, use Team::barrier() to synchronize.
    *
-   * \complexity  O(u) for \c u units in the associated team
+   * \complexity  O(s) non-blocking atomic reads for \c s shards, completed
+   *              by a single flush
    */
   ValueType get() const
+  {
+    fetch_shards(_fetch_buf.data());
+    flush_fetches();
+    // Pending relaxed reads have been completed by the flush but are
+    // outdated by the result of this read:
+    _refresh_pending = false;
+    _cached          = accumulate_shards(_fetch_buf);
+    _cache_valid     = true;
+    return _cached;
+  }
+
+  /**
+   * Read an approximate value of the shared counter.
+   * Returns the value obtained from the previous read and starts an
+   * asynchronous refresh of the cached value that is completed by the next
+   * read. The first read of a unit is not relaxed.
+   *
+   * \complexity  O(s) non-blocking atomic reads for \c s shards, the
+   *              refresh started by the previous read has usually
+   *              completed already
+   */
+  ValueType get_relaxed() const
+  {
+    if (!_cache_valid) {
+      get();
+    } else if (_refresh_pending) {
+      flush_fetches();
+      _cached = accumulate_shards(_refresh_buf);
+    }
+    fetch_shards(_refresh_buf.data());
+    _refresh_pending = true;
+    return _cached;
+  }
+
+  /**
+   * Number of shards of the counter.
+   */
+  size_t num_shards() const noexcept
+  {
+    return _num_shards;
+  }
+
+private:
+  /**
+   * Shard incremented by the specified unit.
+   */
+  inline size_t shard_of(team_unit_t unit) const noexcept
+  {
+    return (static_cast<size_t>(unit) * _num_shards) / _num_units;
+  }
+
+  /**
+   * Unit storing the specified shard, the first unit in the group of
+   * units incrementing the shard.
+   */
+  inline size_t shard_unit(size_t shard) const noexcept
+  {
+    return (shard * _num_units + _num_shards - 1) / _num_shards;
+  }
+
+  inline atomic_ref_t shard_ref(size_t shard) const
+  {
+    return atomic_ref_t(_local_counts[shard_unit(shard)].dart_gptr());
+  }
+
+  /**
+   * Starts non-blocking atomic reads of all shards to the given buffer.
+   */
+  void fetch_shards(ValueType * buf) const
+  {
+    ValueType nothing{};
+    for (size_t s = 0; s < _num_shards; ++s) {
+      DASH_ASSERT_RETURNS(
+        dart_fetch_and_op(
+          _local_counts[shard_unit(s)].dart_gptr(),
+          &nothing,
+          buf + s,
+          dash::dart_punned_datatype<ValueType>::value,
+          DART_OP_NO_OP),
+        DART_OK);
+    }
+  }
+
+  /**
+   * Completes all pending reads of shards.
+   */
+  void flush_fetches() const
+  {
+    DASH_ASSERT_RETURNS(
+      dart_flush_local_all(_local_counts.begin().dart_gptr()),
+      DART_OK);
+  }
+
+  static ValueType accumulate_shards(const std::vector<ValueType> & buf)
   {
     ValueType acc = 0;
-    for (team_unit_t i{0}; i < _num_units; ++i) {
-      // use local access on own counter value:
-      acc += (i == _myid
-                ? _local_counts.local[0]
-                : _local_counts[i]);
+    for (auto value : buf) {
+      acc += value;
     }
     return acc;
   }
 
 private:
   /// The number of units interacting with the counter
-  size_t                 _num_units;
+  size_t                         _num_units;
   /// The DART id of the unit that created this local counter intance
-  team_unit_t            _myid;
-  /// Buffer containing counter increments/decrements of every unit
-  dash::Array<ValueType> _local_counts;
+  team_unit_t                    _myid;
+  /// The number of shards of the counter
+  size_t                         _num_shards;
+  /// Buffer containing counter increments/decrements of every shard
+  dash::Array<ValueType>         _local_counts;
+  /// Target buffer of shard values fetched in get()
+  mutable std::vector<ValueType> _fetch_buf;
+  /// Target buffer of shard values fetched in relaxed reads
+  mutable std::vector<ValueType> _refresh_buf;
+  /// Counter value returned by relaxed reads
+  mutable ValueType              _cached          = 0;
+  /// Whether a counter value has been read before
+  mutable bool                   _cache_valid     = false;
+  /// Whether fetches to _refresh_buf have not been completed yet
+  mutable bool                   _refresh_pending = false;
 };
 
 } // namespace dash
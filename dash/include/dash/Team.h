@@ -8,6 +8,7 @@
 #include <dash/Exception.h>
 
 #include <dash/util/Locality.h>
+#include <dash/memory/WriteCombineBuffer.h>
 
 #include <dash/internal/Logging.h>
 
@@ -16,6 +17,7 @@
 #include <iostream>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 
 namespace dash {
@@ -468,12 +470,75 @@ public:
   inline void barrier() const
   {
     if (!is_null()) {
+      dash::WriteCombineBuffer::flush();
       DASH_ASSERT_RETURNS(
         dart_barrier(_dartid),
         DART_OK);
     }
   }
 
+  /**
+   * Exchanges \c nelem values between every pair of units in the team.
+   * The values in \c send at offset <tt>u * nelem</tt> are sent to unit
+   * \c u and values received from unit \c u are stored in \c recv at
+   * offset <tt>u * nelem</tt>.
+   */
+  template<typename T>
+  void alltoall(
+    const T * send,
+    T       * recv,
+    size_t    nelem) const
+  {
+    DASH_LOG_TRACE("Team.alltoall()", "nelem:", nelem);
+    dash::dart_storage<T> ds(nelem);
+    if (dart_alltoall(send, recv, ds.nelem, ds.dtype, _dartid) != DART_OK) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Team.alltoall: dart_alltoall failed in team " << _dartid);
+    }
+  }
+
+  /**
+   * Exchanges a variable number of values between every pair of units in
+   * the team.
+   * Counts and displacements are specified in number of values of type
+   * \c T for every unit in the team.
+   */
+  template<typename T>
+  void alltoallv(
+    const T      * send,
+    const size_t * sendcounts,
+    const size_t * senddispls,
+    T            * recv,
+    const size_t * recvcounts,
+    const size_t * recvdispls) const
+  {
+    DASH_LOG_TRACE("Team.alltoallv()");
+    dash::dart_storage<T> ds(1);
+    dart_ret_t ret;
+    if (ds.nelem == 1) {
+      ret = dart_alltoallv(send, sendcounts, senddispls, ds.dtype,
+                           recv, recvcounts, recvdispls, _dartid);
+    } else {
+      // Values are transferred as bytes, scale counts and displacements:
+      std::vector<size_t> args(4 * _size);
+      for (size_t u = 0; u < _size; ++u) {
+        args[u]             = sendcounts[u] * ds.nelem;
+        args[_size + u]     = senddispls[u] * ds.nelem;
+        args[2 * _size + u] = recvcounts[u] * ds.nelem;
+        args[3 * _size + u] = recvdispls[u] * ds.nelem;
+      }
+      ret = dart_alltoallv(send, args.data(), args.data() + _size, ds.dtype,
+                           recv, args.data() + 2 * _size,
+                           args.data() + 3 * _size, _dartid);
+    }
+    if (ret != DART_OK) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Team.alltoallv: dart_alltoallv failed in team " << _dartid);
+    }
+  }
+
   inline team_unit_t myid() const
   {
     return _myid;
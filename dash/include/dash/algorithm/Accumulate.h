@@ -6,6 +6,13 @@
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/CollectiveFuture.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Segments.h>
+
+#include <memory>
+#include <numeric>
+#include <type_traits>
 
 
 namespace dash {
@@ -38,9 +45,145 @@ namespace internal {
       }
     }
   }
+
+  /**
+   * Buffers and reduction operation of an asynchronous accumulation which
+   * have to remain valid until the reduction completed.
+   */
+  template<typename ValueType, typename BinaryOperation>
+  struct accumulate_state {
+    using local_result_t = struct local_result<ValueType>;
+
+    local_result_t   l_result;
+    local_result_t   g_result;
+    ValueType        init;
+    BinaryOperation  binary_op;
+    dart_operation_t dop    = DART_OP_UNDEFINED;
+    dart_datatype_t  dtype  = DART_TYPE_UNDEFINED;
+    bool             custom = false;
+
+    accumulate_state(const ValueType & init_, BinaryOperation op)
+    : init(init_),
+      binary_op(op)
+    { }
+
+    ~accumulate_state() {
+      if (custom) {
+        dart_op_destroy(&dop);
+        dart_type_destroy(&dtype);
+      }
+    }
+  };
+
+  /**
+   * Reduces the local results of an accumulation across all units in
+   * \c team.
+   */
+  template<typename ValueType, typename BinaryOperation>
+  dash::Future<ValueType> accumulate_reduce_async(
+    std::shared_ptr<accumulate_state<ValueType, BinaryOperation>> state,
+    bool                                                        non_empty,
+    dash::Team                                                & team)
+  {
+    using state_t = accumulate_state<ValueType, BinaryOperation>;
+
+    state->dop   = dart_reduce_operation<BinaryOperation>::value;
+    state->dtype = dash::dart_storage<ValueType>::dtype;
+
+    dart_handle_t handle;
+    if (!non_empty || state->dop   == DART_OP_UNDEFINED
+                   || state->dtype == DART_TYPE_UNDEFINED)
+    {
+      dart_type_create_custom(sizeof(typename state_t::local_result_t),
+                              &(state->dtype));
+
+      // we need a custom reduction operation because not every unit
+      // may have valid values
+      dart_op_create(
+        &accumulate_custom_fn<ValueType, BinaryOperation>,
+        &(state->binary_op), true, state->dtype, true, &(state->dop));
+      state->custom = true;
+      DASH_ASSERT_RETURNS(
+        dart_allreduce_handle(&(state->l_result), &(state->g_result), 1,
+                              state->dtype, state->dop, team.dart_id(),
+                              &handle),
+        DART_OK);
+    } else {
+      // ideal case: we can use DART predefined reductions
+      DASH_ASSERT_RETURNS(
+        dart_allreduce_handle(&(state->l_result.value),
+                              &(state->g_result.value), 1,
+                              state->dtype, state->dop, team.dart_id(),
+                              &handle),
+        DART_OK);
+      state->g_result.valid = true;
+    }
+
+    return collective_future<ValueType>(
+        handle, state,
+        [](state_t & st) {
+          if (!st.g_result.valid) {
+            DASH_LOG_ERROR("Found invalid reduction value!");
+          }
+          return st.binary_op(st.init, st.g_result.value);
+        });
+  }
 } // namespace internal
 
 
+/**
+ * Asynchronous variant of \c dash::accumulate for local ranges.
+ *
+ * The local range is accumulated before the function returns, the
+ * reduction of the local results is not completed before the returned
+ * future is waited for.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Local iterator describing the beginning of the range to
+ *                  accumulate.
+ * \param in_last   Local iterator describing the end of the range to accumualte
+ * \param init      The initial element to use in the accumulation.
+ * \param binary_op The binary operation to apply to accumulate two elements
+ *                  (default: using \c operator+)
+ * \param non_empty Whether all units are guaranteed to provide a non-empty local
+ *                  range (default \c false).
+ * \param team      The team to use for the collective operation.
+ *
+ * \see dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class LocalInputIter,
+  class ValueType,
+  class BinaryOperation,
+  typename = typename std::enable_if<
+                        !dash::detail::is_global_iterator<LocalInputIter>::value
+                      >::type>
+dash::Future<ValueType> accumulate_async(
+  const LocalInputIter   in_first,
+  const LocalInputIter   in_last,
+  const ValueType      & init,
+  BinaryOperation        binary_op,
+  bool                   non_empty = true,
+  dash::Team           & team = dash::Team::All())
+{
+  using state_t = dash::internal::accumulate_state<ValueType, BinaryOperation>;
+
+  auto state   = std::make_shared<state_t>(init, binary_op);
+  auto l_first = in_first;
+  auto l_last  = in_last;
+
+  if (l_first != l_last) {
+    state->l_result.value = std::accumulate(std::next(l_first),
+                                            l_last, *l_first,
+                                            binary_op);
+    state->l_result.valid = true;
+  }
+  return dash::internal::accumulate_reduce_async(state, non_empty, team);
+}
+
 /**
  * Accumulate values in each process' range [\ref in_first, \ref in_last) using
  * the provided binary reduce function \c binary_op, which must be commutative
@@ -84,48 +227,8 @@ ValueType accumulate(
   bool                   non_empty = true,
   dash::Team           & team = dash::Team::All())
 {
-  using local_result_t = struct dash::internal::local_result<ValueType>;
-  auto myid        = team.myid();
-  auto l_first     = in_first;
-  auto l_last      = in_last;
-
-  local_result_t l_result;
-  local_result_t g_result;
-  if (l_first != l_last) {
-    l_result.value = std::accumulate(std::next(l_first),
-                                     l_last, *l_first,
-                                     binary_op);
-    l_result.valid = true;
-  }
-  dart_operation_t dop =
-                  dash::internal::dart_reduce_operation<BinaryOperation>::value;
-  dart_datatype_t  dtype = dash::dart_storage<ValueType>::dtype;
-
-  if (!non_empty || dop == DART_OP_UNDEFINED || dtype == DART_TYPE_UNDEFINED)
-  {
-    dart_type_create_custom(sizeof(local_result_t), &dtype);
-
-    // we need a custom reduction operation because not every unit
-    // may have valid values
-    dart_op_create(
-      &dash::internal::accumulate_custom_fn<ValueType, BinaryOperation>,
-      &binary_op, true, dtype, true, &dop);
-    dart_allreduce(&l_result, &g_result, 1, dtype, dop, team.dart_id());
-    dart_op_destroy(&dop);
-    dart_type_destroy(&dtype);
-  } else {
-    // ideal case: we can use DART predefined reductions
-    dart_allreduce(&l_result.value, &g_result.value, 1, dtype, dop, team.dart_id());
-    g_result.valid = true;
-  }
-  if (!g_result.valid) {
-    DASH_LOG_ERROR("Found invalid reduction value!");
-  }
-  auto result = g_result.value;
-
-  result = binary_op(init, result);
-
-  return result;
+  return dash::accumulate_async(
+            in_first, in_last, init, binary_op, non_empty, team).get();
 }
 
 /**
@@ -172,6 +275,138 @@ ValueType accumulate(
             team);
 }
 
+/**
+ * Asynchronous variant of \c dash::accumulate for global ranges.
+ *
+ * The local range of every unit is accumulated as specified by the
+ * execution policy before the function returns, the reduction of the
+ * local results is not completed before the returned future is waited
+ * for.
+ * Parallel policies accumulate contiguous chunks of local elements
+ * concurrently and combine the partial results in the order of the
+ * chunks, so \c binary_op must be associative.
+ *
+ * Collective operation.
+ *
+ * \see dash::accumulate
+ * \see dash::execution
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType>,
+  typename = typename std::enable_if<
+                        dash::is_execution_policy<
+                          typename std::decay<ExecutionPolicy>::type
+                        >::value &&
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+dash::Future<ValueType> accumulate_async(
+        ExecutionPolicy && policy,
+        GlobInputIt        in_first,
+        GlobInputIt        in_last,
+  const ValueType        & init,
+  BinaryOperation          binary_op = dash::plus<ValueType>())
+{
+  using state_t = dash::internal::accumulate_state<ValueType, BinaryOperation>;
+  using local_result_t = typename state_t::local_result_t;
+  using local_pointer = typename GlobInputIt::local_pointer;
+
+  auto & team  = in_first.team();
+  auto   state = std::make_shared<state_t>(init, binary_op);
+  // Accumulate the local elements of the global range, runs are never
+  // empty:
+  state->l_result = dash::internal::reduce_local_runs(
+    dash::internal::execution_threads(policy), in_first, in_last,
+    local_result_t(),
+    [&](local_result_t & res, local_pointer lbegin, local_pointer lend) {
+      if (!res.valid) {
+        res.value = *lbegin++;
+        res.valid = true;
+      }
+      res.value = std::accumulate(lbegin, lend, res.value, binary_op);
+    },
+    [&](local_result_t & res, const local_result_t & chunk_res) {
+      if (chunk_res.valid) {
+        res.value = res.valid
+                    ? binary_op(res.value, chunk_res.value)
+                    : chunk_res.value;
+        res.valid = true;
+      }
+    });
+
+  // TODO: can we figure out whether or not units are empty?
+  static constexpr bool units_non_empty = false;
+  return dash::internal::accumulate_reduce_async(
+           state, units_non_empty, team);
+}
+
+/**
+ * Asynchronous variant of \c dash::accumulate for global ranges, local
+ * elements are accumulated sequentially.
+ *
+ * Collective operation.
+ *
+ * \see dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+dash::Future<ValueType> accumulate_async(
+        GlobInputIt   in_first,
+        GlobInputIt   in_last,
+  const ValueType   & init,
+  BinaryOperation     binary_op = dash::plus<ValueType>())
+{
+  return dash::accumulate_async(
+           dash::execution::seq, in_first, in_last, init, binary_op);
+}
+
+/**
+ * Accumulate values in the global range [\ref in_first, \ref in_last) using
+ * the provided binary reduce function \c binary_op, which must be commutative
+ * and linear.
+ *
+ * Local elements are accumulated as specified by the execution policy.
+ *
+ * Collective operation.
+ *
+ * \see dash::accumulate_async
+ * \see dash::execution
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType>,
+  typename = typename std::enable_if<
+                        dash::is_execution_policy<
+                          typename std::decay<ExecutionPolicy>::type
+                        >::value &&
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+ValueType accumulate(
+        ExecutionPolicy && policy,
+        GlobInputIt        in_first,
+        GlobInputIt        in_last,
+  const ValueType        & init,
+  BinaryOperation          binary_op = dash::plus<ValueType>())
+{
+  return dash::accumulate_async(
+           policy, in_first, in_last, init, binary_op).get();
+}
+
 /**
  * Accumulate values in the global range [\ref in_first, \ref in_last) using
  * the provided binary reduce function \c binary_op, which must be commutative
@@ -208,19 +443,8 @@ ValueType accumulate(
   const ValueType   & init,
   BinaryOperation     binary_op = dash::plus<ValueType>())
 {
-  auto & team      = in_first.team();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-
-  // TODO: can we figure out whether or not units are empty?
-  static constexpr bool units_non_empty = false;
-  return dash::accumulate(l_first,
-                          l_last,
-                          init,
-                          binary_op,
-                          units_non_empty,
-                          team);
+  return dash::accumulate_async(
+           dash::execution::seq, in_first, in_last, init, binary_op).get();
 }
 
 } // namespace dash
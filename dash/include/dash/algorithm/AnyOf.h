@@ -4,6 +4,8 @@
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/Find.h>
 
+#include <type_traits>
+
 
 namespace dash {
 
@@ -32,6 +34,40 @@ bool any_of(
   return find_if(first, last, p) != last;
 }
 
+/**
+ * Check whether any element in the range satisfies predicate \c p.
+ * Local elements are tested as specified by the execution policy.
+ *
+ * \returns \c true if at least one element satisfies \c p, \c false otherwise.
+ *
+ * \see dash::find_if
+ * \see dash::find_if_not
+ * \see dash::execution
+ * \ingroup DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
+bool any_of(
+  /// Execution policy of the test of local elements
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
+{
+  return find_if(policy, first, last, p) != last;
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__ANY_OF_H__
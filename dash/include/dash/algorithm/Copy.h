@@ -5,6 +5,7 @@
 #include <dash/Iterator.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Segments.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -93,13 +94,202 @@ dash::Future<ValueType *> copy_async(
 
 namespace internal {
 
+// =========================================================================
+// Run Groups
+// =========================================================================
+
+/**
+ * Runs of elements pending for transfer between a single remote unit and
+ * the calling unit.
+ * Runs are consecutive in the remote unit's local memory and in ascending
+ * order in the local buffer, so they can be transferred in a single
+ * operation with a contiguous remote type and a strided or indexed local
+ * type.
+ */
+template <typename ValueType>
+struct copy_run_group {
+  /// Global pointer to the first element of the first run
+  dart_gptr_t                 gptr;
+  /// Local buffer address of the first run
+  ValueType                 * lbegin;
+  /// Local index of the element following the last run at the remote unit
+  dash::default_index_t       next;
+  /// Offsets of the runs from \c lbegin
+  std::vector<size_t>         offsets;
+  /// Number of elements in the runs
+  std::vector<size_t>         lengths;
+  /// Total number of elements in all runs
+  size_t                      nelem;
+};
+
+/**
+ * Starts a new group with a single run.
+ */
+template <typename ValueType>
+void copy_run_group_start(
+  copy_run_group<ValueType> & group,
+  dart_gptr_t                 gptr,
+  dash::default_index_t       l_index,
+  ValueType                 * lptr,
+  size_t                      len)
+{
+  group.gptr   = gptr;
+  group.lbegin = lptr;
+  group.next   = l_index + len;
+  group.nelem  = len;
+  group.offsets.clear();
+  group.lengths.clear();
+  group.offsets.push_back(0);
+  group.lengths.push_back(len);
+}
+
+/**
+ * Appends a run to the group if it continues the group's runs in the
+ * remote unit's local memory and follows them in the local buffer.
+ *
+ * \returns  \c false if the run could not be appended
+ */
+template <typename ValueType>
+bool copy_run_group_extend(
+  copy_run_group<ValueType> & group,
+  dash::default_index_t       l_index,
+  ValueType                 * lptr,
+  size_t                      len)
+{
+  if (group.lengths.empty() ||
+      group.next != l_index ||
+      lptr < group.lbegin + group.offsets.back() + group.lengths.back()) {
+    return false;
+  }
+  group.offsets.push_back(lptr - group.lbegin);
+  group.lengths.push_back(len);
+  group.next  += len;
+  group.nelem += len;
+  return true;
+}
+
+/**
+ * Creates the DART data type describing the runs of a group in the local
+ * buffer: a strided type if runs are of equal length and equally spaced,
+ * an indexed type otherwise.
+ * Must only be called for groups of more than one run.
+ */
+template <typename ValueType>
+dart_datatype_t copy_run_group_type(
+  const copy_run_group<ValueType> & group)
+{
+  // Number of DART elements per value, values of non-basic types are
+  // transferred as bytes:
+  dash::dart_storage<ValueType> ds(1);
+  const size_t nruns    = group.lengths.size();
+  const size_t run_len  = group.lengths[0];
+  const size_t stride   = group.offsets[1] - group.offsets[0];
+  bool         strided  = true;
+  for (size_t r = 1; r < nruns && strided; ++r) {
+    strided = group.lengths[r] == run_len &&
+              group.offsets[r] - group.offsets[r-1] == stride;
+  }
+  dart_datatype_t ltype;
+  if (strided) {
+    DASH_ASSERT_RETURNS(
+      dart_type_create_strided(
+        ds.dtype, stride * ds.nelem, run_len * ds.nelem, &ltype),
+      DART_OK);
+  } else {
+    std::vector<size_t> blocklen(nruns);
+    std::vector<size_t> offset(nruns);
+    for (size_t r = 0; r < nruns; ++r) {
+      blocklen[r] = group.lengths[r] * ds.nelem;
+      offset[r]   = group.offsets[r] * ds.nelem;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_type_create_indexed(
+        ds.dtype, nruns, blocklen.data(), offset.data(), &ltype),
+      DART_OK);
+  }
+  return ltype;
+}
+
+/**
+ * Issues a single non-blocking get operation for all runs of the group
+ * and clears the group.
+ */
+template <typename ValueType>
+void copy_run_group_get(
+  copy_run_group<ValueType>  & group,
+  std::vector<dart_handle_t> & handles)
+{
+  if (group.lengths.empty()) {
+    return;
+  }
+  dart_handle_t handle;
+  if (group.lengths.size() == 1) {
+    dash::internal::get_handle(
+      group.gptr, group.lbegin, group.nelem, &handle);
+  } else {
+    dash::dart_storage<ValueType> ds(group.nelem);
+    dart_datatype_t ltype = copy_run_group_type(group);
+    DASH_ASSERT_RETURNS(
+      dart_get_handle(
+        group.lbegin, group.gptr, ds.nelem, ds.dtype, ltype, &handle),
+      DART_OK);
+    // Types may be destroyed before pending operations complete:
+    DASH_ASSERT_RETURNS(
+      dart_type_destroy(&ltype),
+      DART_OK);
+  }
+  if (handle != DART_HANDLE_NULL) {
+    handles.push_back(handle);
+  }
+  group.lengths.clear();
+  group.offsets.clear();
+}
+
+/**
+ * Issues a single non-blocking put operation for all runs of the group
+ * and clears the group.
+ */
+template <typename ValueType>
+void copy_run_group_put(
+  copy_run_group<ValueType>  & group,
+  std::vector<dart_handle_t> & handles)
+{
+  if (group.lengths.empty()) {
+    return;
+  }
+  dart_handle_t handle;
+  if (group.lengths.size() == 1) {
+    dash::internal::put_handle(
+      group.gptr, group.lbegin, group.nelem, &handle);
+  } else {
+    dash::dart_storage<ValueType> ds(group.nelem);
+    dart_datatype_t ltype = copy_run_group_type(group);
+    DASH_ASSERT_RETURNS(
+      dart_put_handle(
+        group.gptr, group.lbegin, ds.nelem, ltype, ds.dtype, &handle),
+      DART_OK);
+    // Types may be destroyed before pending operations complete:
+    DASH_ASSERT_RETURNS(
+      dart_type_destroy(&ltype),
+      DART_OK);
+  }
+  if (handle != DART_HANDLE_NULL) {
+    handles.push_back(handle);
+  }
+  group.lengths.clear();
+  group.offsets.clear();
+}
+
 // =========================================================================
 // Global to Local
 // =========================================================================
 
 /**
- * Blocking implementation of \c dash::copy (global to local) without
- * optimization for local subrange.
+ * Blocking implementation of \c dash::copy (global to local).
+ *
+ * Decomposes the input range into segments contiguous in a block of the
+ * input pattern. Local segments are copied directly, segments at the same
+ * remote unit are gathered into a single get operation.
  */
 template <
   typename ValueType,
@@ -114,100 +304,33 @@ ValueType * copy_impl(
                  "in_first:",  in_first.pos(),
                  "in_last:",   in_last.pos(),
                  "out_first:", out_first);
-  auto pattern = in_first.pattern();
-  typedef typename decltype(pattern)::index_type index_type;
-  typedef typename decltype(pattern)::size_type  size_type;
-  size_type num_elem_total = dash::distance(in_first, in_last);
+  auto num_elem_total = dash::distance(in_first, in_last);
   if (num_elem_total <= 0) {
     DASH_LOG_TRACE("dash::copy_impl", "input range empty");
     return out_first;
   }
-  DASH_LOG_TRACE("dash::copy_impl",
-                 "total elements:",    num_elem_total,
-                 "expected out_last:", out_first + num_elem_total);
-  // Input iterators could be relative to a view. Map first input iterator
-  // to global index range and use it to resolve last input iterator.
-  // Do not use in_last.global() as this would span over the relative input
-  // range.
-  auto g_in_first      = in_first.global();
-  auto g_in_last       = g_in_first + num_elem_total;
-  DASH_LOG_TRACE("dash::copy_impl",
-                 "g_in_first:", g_in_first.pos(),
-                 "g_in_last:",  g_in_last.pos());
-  auto unit_first      = pattern.unit_at(g_in_first.pos());
-  DASH_LOG_TRACE_VAR("dash::copy_impl", unit_first);
-  auto unit_last       = pattern.unit_at(g_in_last.pos() - 1);
-  DASH_LOG_TRACE_VAR("dash::copy_impl", unit_last);
-
-  size_type num_elem_copied = 0;
-  if (unit_first == unit_last) {
-    // Input range is located at a single remote unit:
-    DASH_LOG_TRACE("dash::copy_impl", "input range at single unit");
-    DASH_LOG_TRACE("dash::copy_impl",
-                    "get elements:",   num_elem_total);
-    auto cur_in_first  = g_in_first;
-    auto cur_out_first = out_first;
-    dart_handle_t handle;
-    dash::internal::get_handle(
-      cur_in_first.dart_gptr(),
-      cur_out_first,
-      num_elem_total,
-      &handle);
-    if (handle != DART_HANDLE_NULL) {
-      handles.push_back(handle);
-    }
-    num_elem_copied = num_elem_total;
-  } else {
-    // Input range is spread over several remote units:
-    DASH_LOG_TRACE("dash::copy_impl", "input range spans multiple units");
-    //
-    // Copy elements from every unit:
-    //
-    while (num_elem_copied < num_elem_total) {
-      // Global iterator pointing at begin of current unit's input range:
-      auto cur_in_first    = g_in_first + num_elem_copied;
-      // unit and local index of first element in current range segment:
-      auto local_pos       = pattern.local(static_cast<index_type>(
-                                             cur_in_first.pos()));
-      // Number of elements located at current source unit:
-      size_type max_elem_per_unit = pattern.local_size(local_pos.unit);
-      // Local offset of first element in input range at current unit:
-      auto l_in_first_idx  = local_pos.index;
-      // Maximum number of elements to copy from current unit:
-      auto num_unit_elem   = max_elem_per_unit - l_in_first_idx;
-      // Number of elements left to copy:
-      auto total_elem_left = num_elem_total - num_elem_copied;
-      // Number of elements to copy in this iteration.
-      auto num_copy_elem   = num_unit_elem;
-      if (num_copy_elem > total_elem_left) {
-        num_copy_elem = total_elem_left;
+
+  const auto & pattern = in_first.pattern();
+  std::vector<copy_run_group<ValueType>> groups(pattern.team().size());
+
+  for_each_segment(in_first, in_last,
+    [&](const glob_segment<GlobInputIt> & seg) {
+      ValueType * dest = out_first + seg.offset;
+      if (seg.is_local()) {
+        std::copy(seg.lbegin, seg.lbegin + seg.size, dest);
+        return;
       }
-      DASH_ASSERT_GT(num_copy_elem, 0,
-                     "Number of element to copy is 0");
-      DASH_LOG_TRACE("dash::copy_impl",
-                     "start g_idx:",    cur_in_first.pos(),
-                     "->",
-                     "unit:",           local_pos.unit,
-                     "l_idx:",          l_in_first_idx,
-                     "->",
-                     "unit elements:",  num_unit_elem,
-                     "max elem/unit:",  max_elem_per_unit,
-                     "get elements:",   num_copy_elem,
-                     "total:",          num_elem_total,
-                     "copied:",         num_elem_copied,
-                     "left:",           total_elem_left);
-      auto dest_ptr = out_first + num_elem_copied;
-      auto src_gptr = cur_in_first.dart_gptr();
-      dart_handle_t handle;
-      dash::internal::get_handle(src_gptr, dest_ptr, num_copy_elem, &handle);
-      num_elem_copied += num_copy_elem;
-      if (handle != DART_HANDLE_NULL) {
-        handles.push_back(handle);
+      auto & group = groups[seg.unit.id];
+      if (!copy_run_group_extend(group, seg.lindex, dest, seg.size)) {
+        copy_run_group_get(group, handles);
+        copy_run_group_start(group, seg.gptr, seg.lindex, dest, seg.size);
       }
-    }
+    });
+  for (auto & group : groups) {
+    copy_run_group_get(group, handles);
   }
 
-  ValueType * out_last = out_first + num_elem_copied;
+  ValueType * out_last = out_first + num_elem_total;
   DASH_LOG_TRACE_VAR("dash::copy_impl >", out_last);
   return out_last;
 }
@@ -217,12 +340,70 @@ ValueType * copy_impl(
 // =========================================================================
 
 /**
- * Blocking implementation of \c dash::copy (local to global) without
- * optimization for local subrange.
+ * Blocking implementation of \c dash::copy (local to global).
+ *
+ * Decomposes the output range into segments contiguous in a block of the
+ * output pattern. Local segments are copied directly, segments at the
+ * same remote unit are scattered in a single put operation.
  */
 template <
   typename ValueType,
-  class GlobOutputIt >
+  class GlobOutputIt,
+  typename std::enable_if<
+             dash::detail::is_global_iterator<GlobOutputIt>::value,
+             int >::type = 0 >
+GlobOutputIt copy_impl(
+  ValueType                  * in_first,
+  ValueType                  * in_last,
+  GlobOutputIt                 out_first,
+  std::vector<dart_handle_t> & handles)
+{
+  DASH_LOG_TRACE("dash::copy_impl()",
+                 "l_in_first:",  in_first,
+                 "l_in_last:",   in_last,
+                 "g_out_first:", out_first.pos());
+  auto num_elem_total = std::distance(in_first, in_last);
+  if (num_elem_total <= 0) {
+    return out_first;
+  }
+
+  const auto & pattern = out_first.pattern();
+  std::vector<copy_run_group<ValueType>> groups(pattern.team().size());
+
+  for_each_segment(out_first, out_first + num_elem_total,
+    [&](const glob_segment<GlobOutputIt> & seg) {
+      ValueType * src = in_first + seg.offset;
+      if (seg.is_local()) {
+        std::copy(src, src + seg.size, seg.lbegin);
+        return;
+      }
+      auto & group = groups[seg.unit.id];
+      if (!copy_run_group_extend(group, seg.lindex, src, seg.size)) {
+        copy_run_group_put(group, handles);
+        copy_run_group_start(group, seg.gptr, seg.lindex, src, seg.size);
+      }
+    });
+  for (auto & group : groups) {
+    copy_run_group_put(group, handles);
+  }
+
+  auto out_last = out_first + num_elem_total;
+  DASH_LOG_TRACE("dash::copy_impl >",
+                 "g_out_last:", out_last.dart_gptr());
+  return out_last;
+}
+
+/**
+ * Blocking implementation of \c dash::copy (local to global) for output
+ * ranges referenced by global pointers, which are contiguous at a single
+ * unit.
+ */
+template <
+  typename ValueType,
+  class GlobOutputIt,
+  typename std::enable_if<
+             !dash::detail::is_global_iterator<GlobOutputIt>::value,
+             int >::type = 0 >
 GlobOutputIt copy_impl(
   ValueType                  * in_first,
   ValueType                  * in_last,
@@ -257,6 +438,7 @@ GlobOutputIt copy_impl(
 
 
 
+
 // =========================================================================
 // Global to Local, Distributed Range
 // =========================================================================
@@ -288,39 +470,33 @@ dash::Future<ValueType *> copy_async(
   bool use_memcpy   = ((in_last - in_first) * sizeof(ValueType))
                       <= l2_line_size;
 
-  ValueType * dest_first = out_first;
   // Return value, initialize with begin of output range, indicating no values
   // have been copied:
   ValueType * out_last   = out_first;
-  // Check if part of the input range is local:
   DASH_LOG_TRACE_VAR("dash::copy_async", in_first.dart_gptr());
   DASH_LOG_TRACE_VAR("dash::copy_async", in_last.dart_gptr());
   DASH_LOG_TRACE_VAR("dash::copy_async", out_first);
-  auto li_range_in     = local_index_range(in_first, in_last);
-  // Number of elements in the local subrange:
-  auto num_local_elem  = li_range_in.end - li_range_in.begin;
   // Total number of elements to be copied:
   auto total_copy_elem = in_last - in_first;
 
-  // Instead of testing in_first.local() and in_last.local(), this test for a
-  // local-only range only requires one call to in_first.local() which increases
-  // throughput by ~10% for local ranges.
-  if (num_local_elem == total_copy_elem) {
+  // Test for an input range that is a single run in local memory first,
+  // this is the common case of copying from a local block:
+  if (in_first.is_local() &&
+      dash::internal::segment_length(
+        in_first, decltype(total_copy_elem)(0), total_copy_elem)
+      == total_copy_elem) {
     // Entire input range is local:
     DASH_LOG_TRACE("dash::copy_async", "entire input range is local");
-    ValueType * l_out_last = out_first + total_copy_elem;
     ValueType * l_in_first = in_first.local();
     ValueType * l_in_last  = l_in_first + total_copy_elem;
 
     // Use memcpy for data ranges below 64 KB
     if (use_memcpy) {
-      std::memcpy(out_first,        // destination
-                  in_first.local(), // source
-                  num_local_elem * sizeof(ValueType));
-      out_last = out_first + num_local_elem;
+      std::memcpy(out_first,  // destination
+                  l_in_first, // source
+                  total_copy_elem * sizeof(ValueType));
+      out_last = out_first + total_copy_elem;
     } else {
-      ValueType * l_in_first = in_first.local();
-      ValueType * l_in_last  = l_in_first + num_local_elem;
       out_last = std::copy(l_in_first,
                            l_in_last,
                            out_first);
@@ -331,130 +507,12 @@ dash::Future<ValueType *> copy_async(
   }
 
   auto handles = std::make_shared<std::vector<dart_handle_t>>();
-
-  DASH_LOG_TRACE("dash::copy_async", "local range:",
-                 li_range_in.begin,
-                 li_range_in.end,
-                 "in_first.is_local:", in_first.is_local());
-  // Check if global input range is partially local:
-  if (num_local_elem > 0) {
-    // Part of the input range is local, copy local input subrange to local
-    // output range directly.
-    auto pattern          = in_first.pattern();
-    // Map input iterators to global index domain:
-    auto g_in_first       = in_first.global();
-    auto g_in_last        = g_in_first + total_copy_elem;
-    DASH_LOG_TRACE("dash::copy_async", "resolving local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy_async", num_local_elem);
-    // Local index range to global input index range:
-    // Global index of local range begin index:
-    auto g_l_offset_begin = pattern.global(li_range_in.begin);
-    // Global index of local range end index:
-    auto g_l_offset_end   = pattern.global(li_range_in.end-1)
-                            + 1; // pat.global(l_end) would be out of range
-    DASH_LOG_TRACE("dash::copy_async",
-                   "global index range of local subrange:",
-                   "begin:", g_l_offset_begin, "end:", g_l_offset_end);
-    // Global position of input start iterator:
-    auto g_offset_begin   = g_in_first.pos();
-    // Convert local subrange to global iterators:
-    auto g_l_in_first     = g_in_first + (g_l_offset_begin - g_offset_begin);
-    auto g_l_in_last      = g_in_first + (g_l_offset_end   - g_offset_begin);
-    DASH_LOG_TRACE("dash::copy_async", "global it. range of local subrange:",
-                   "begin:", g_l_in_first.pos(), "end:", g_l_in_last.pos());
-    DASH_LOG_TRACE_VAR("dash::copy_async", g_l_in_last.pos());
-    //
-    // -----------------------------------------------------------------------
-    // Copy remote elements preceding the local subrange:
-    //
-    auto num_prelocal_elem = g_l_in_first.pos() - g_in_first.pos();
-    DASH_LOG_TRACE_VAR("dash::copy_async", num_prelocal_elem);
-    if (num_prelocal_elem > 0) {
-      DASH_LOG_TRACE("dash::copy_async",
-                     "copy global range preceding local subrange",
-                     "g_in_first:", g_in_first.pos(),
-                     "g_in_last:",  g_l_in_first.pos());
-      // ... [ --- copy --- | ... l ... | ........ ]
-      //     ^              ^           ^          ^
-      //     in_first       l_in_first  l_in_last  in_last
-      dash::internal::copy_impl(g_in_first,
-                                g_l_in_first,
-                                dest_first,
-                                *handles);
-      // Advance output pointers:
-      out_last   += num_prelocal_elem;
-      dest_first  = out_last;
-    }
-    //
-    // -----------------------------------------------------------------------
-    // Copy remote elements succeeding the local subrange:
-    //
-    auto num_postlocal_elem = in_last.pos() - g_l_offset_end;
-    DASH_LOG_TRACE_VAR("dash::copy_async", num_postlocal_elem);
-    if (num_postlocal_elem > 0) {
-      dest_first += num_local_elem;
-      DASH_LOG_TRACE("dash::copy_async",
-                     "copy global range succeeding local subrange",
-                     "in_first:", g_l_in_last.pos(),
-                     "in_last:",  g_in_last.pos());
-      // ... [ ........ | ... l ... | --- copy --- ]
-      //     ^          ^           ^              ^
-      //     in_first   l_in_first  l_in_last      in_last
-      dash::internal::copy_impl(g_l_in_last,
-                                g_in_last,
-                                dest_first,
-                                *handles);
-      out_last += num_postlocal_elem;
-    }
-    //
-    // -----------------------------------------------------------------------
-    // Copy local subrange:
-    //
-    // Convert local subrange of global input to native pointers:
-    //
-    // ... [ ........ | --- l --- | ........ ]
-    //     ^          ^           ^          ^
-    //     in_first   l_in_first  l_in_last  in_last
-    //
-    ValueType * l_in_first = g_l_in_first.local();
-    ValueType * l_in_last  = l_in_first + num_local_elem;
-    DASH_LOG_TRACE_VAR("dash::copy_async", l_in_first);
-    DASH_LOG_TRACE_VAR("dash::copy_async", l_in_last);
-    // Verify conversion of global input iterators to local pointers:
-    DASH_ASSERT_MSG(l_in_first != nullptr,
-                    "dash::copy_async: first index in global input (" <<
-                    g_l_in_first.pos() << ") is not local");
-
-    DASH_LOG_TRACE("dash::copy_async", "copy local subrange",
-                   "num_copy_elem:", l_in_last - l_in_first);
-    ValueType * local_out_first = out_first + num_prelocal_elem;
-    ValueType * local_out_last  = local_out_first + num_local_elem;
-
-    // Use memcpy for data ranges below 64 KB
-    if (use_memcpy) {
-      std::memcpy(local_out_first, // destination
-                  l_in_first,      // source
-                  num_local_elem * sizeof(ValueType));
-      local_out_last = local_out_first + num_local_elem;
-    } else {
-      local_out_last = std::copy(l_in_first,
-                                 l_in_last,
-                                 local_out_first);
-    }
-    DASH_LOG_TRACE("dash::copy_async", "<< std::shared_future >>",
-                   "finished local copy of",
-                   (local_out_last - local_out_first),
-                   "elements");
-    out_last += (local_out_last - local_out_first);
-  } else {
-    DASH_LOG_TRACE("dash::copy_async", "no local subrange");
-    // All elements in input range are remote
-    dash::internal::copy_impl(in_first,
-                              in_last,
-                              dest_first,
-                              *handles);
-    out_last = out_first + total_copy_elem;
-  }
+  // Local runs in the input range are copied immediately, remote runs are
+  // requested by one get operation per unit:
+  out_last = dash::internal::copy_impl(in_first,
+                                       in_last,
+                                       out_first,
+                                       *handles);
   DASH_LOG_TRACE("dash::copy_async", "preparing future");
   if (handles->empty()) {
     DASH_LOG_TRACE("dash::copy_async >", "finished (no pending handles), ",
@@ -534,36 +592,35 @@ ValueType * copy(
 
   DASH_LOG_TRACE("dash::copy()", "blocking, global to local");
 
-  ValueType * dest_first = out_first;
   // Return value, initialize with begin of output range, indicating no
   // values have been copied:
   ValueType * out_last   = out_first;
-  // Check if part of the input range is local:
   DASH_LOG_TRACE_VAR("dash::copy", in_first.dart_gptr());
   DASH_LOG_TRACE_VAR("dash::copy", in_last.dart_gptr());
   DASH_LOG_TRACE_VAR("dash::copy", out_first);
-  auto li_range_in     = local_index_range(in_first, in_last);
-  // Number of elements in the local subrange:
-  auto num_local_elem  = li_range_in.end - li_range_in.begin;
   // Total number of elements to be copied:
   auto total_copy_elem = in_last - in_first;
+  if (total_copy_elem <= 0) {
+    return out_first;
+  }
 
-  // Instead of testing in_first.local() and in_last.local(), this test for
-  // a local-only range only requires one call to in_first.local() which
-  // increases throughput by ~10% for local ranges.
-  if (num_local_elem == total_copy_elem) {
+  // Test for an input range that is a single run in local memory first,
+  // this is the common case of copying from a local block:
+  if (in_first.is_local() &&
+      dash::internal::segment_length(
+        in_first, decltype(total_copy_elem)(0), total_copy_elem)
+      == total_copy_elem) {
     // Entire input range is local:
     DASH_LOG_TRACE("dash::copy", "entire input range is local");
-    ValueType * out_last = out_first + total_copy_elem;
+    ValueType * l_in_first = in_first.local();
+    ValueType * l_in_last  = l_in_first + total_copy_elem;
     // Use memcpy for data ranges below 64 KB
     if (use_memcpy) {
-      std::memcpy(out_first,        // destination
-                  in_first.local(), // source
-                  num_local_elem * sizeof(ValueType));
-      out_last = out_first + num_local_elem;
+      std::memcpy(out_first,  // destination
+                  l_in_first, // source
+                  total_copy_elem * sizeof(ValueType));
+      out_last = out_first + total_copy_elem;
     } else {
-      ValueType * l_in_first = in_first.local();
-      ValueType * l_in_last  = l_in_first + num_local_elem;
       out_last = std::copy(l_in_first,
                            l_in_last,
                            out_first);
@@ -574,129 +631,12 @@ ValueType * copy(
   }
 
   std::vector<dart_handle_t> handles;
-
-  DASH_LOG_TRACE("dash::copy", "local range:",
-                 li_range_in.begin,
-                 li_range_in.end,
-                 "in_first.is_local:", in_first.is_local());
-  // Check if global input range is partially local:
-  if (num_local_elem > 0) {
-    // Part of the input range is local, copy local input subrange to local
-    // output range directly.
-    auto pattern          = in_first.pattern();
-    // Map input iterators to global index domain:
-    auto g_in_first       = in_first.global();
-    auto g_in_last        = g_in_first + total_copy_elem;
-    DASH_LOG_TRACE("dash::copy", "resolving local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy", num_local_elem);
-    // Local index range to global input index range:
-    // Global index of local range begin index:
-    auto g_l_offset_begin = pattern.global(li_range_in.begin);
-    // Global index of local range end index:
-    auto g_l_offset_end   = pattern.global(li_range_in.end-1)
-                            + 1; // pat.global(l_end) would be out of range
-    DASH_LOG_TRACE("dash::copy",
-                   "global index range of local subrange:",
-                   "begin:", g_l_offset_begin, "end:", g_l_offset_end);
-
-    // Global position of input start iterator:
-    auto g_offset_begin   = g_in_first.pos();
-    // Convert local subrange to global iterators:
-    auto g_l_in_first     = g_in_first + (g_l_offset_begin - g_offset_begin);
-    auto g_l_in_last      = g_in_first + (g_l_offset_end   - g_offset_begin);
-    DASH_LOG_TRACE("dash::copy", "global it. range of local subrange:",
-                   "begin:", g_l_in_first.pos(), "end:", g_l_in_last.pos());
-    DASH_LOG_TRACE_VAR("dash::copy", g_l_in_last.pos());
-
-    auto num_prelocal_elem  = g_l_in_first.pos() - g_in_first.pos();
-    auto num_postlocal_elem = in_last.pos() - g_l_offset_end;
-    DASH_LOG_TRACE_VAR("dash::copy", num_prelocal_elem);
-    DASH_LOG_TRACE_VAR("dash::copy", num_postlocal_elem);
-
-    //
-    // -----------------------------------------------------------------------
-    // Copy remote elements preceding the local subrange:
-    //
-    if (num_prelocal_elem > 0) {
-      DASH_LOG_TRACE("dash::copy",
-                     "copy global range preceding local subrange",
-                     "g_in_first:", g_in_first.pos(),
-                     "g_in_last:",  g_l_in_first.pos());
-      // ... [ --- copy --- | ... l ... | ........ ]
-      //     ^              ^           ^          ^
-      //     in_first       l_in_first  l_in_last  in_last
-      out_last = dash::internal::copy_impl(g_in_first,
-                                           g_l_in_first,
-                                           dest_first,
-                                           handles);
-      // Advance output pointers:
-      dest_first = out_last;
-    }
-    //
-    // -----------------------------------------------------------------------
-    // Copy local subrange:
-    //
-    // Convert local subrange of global input to native pointers:
-    //
-    // ... [ ........ | --- l --- | ........ ]
-    //     ^          ^           ^          ^
-    //     in_first   l_in_first  l_in_last  in_last
-    //
-    ValueType * l_in_first = g_l_in_first.local();
-    ValueType * l_in_last  = l_in_first + num_local_elem;
-    DASH_LOG_TRACE_VAR("dash::copy", l_in_first);
-    DASH_LOG_TRACE_VAR("dash::copy", l_in_last);
-    // Verify conversion of global input iterators to local pointers:
-    DASH_ASSERT_MSG(l_in_first != nullptr,
-                    "dash::copy: first index in global input (" <<
-                    g_l_in_first.pos() << ") is not local");
-
-    DASH_LOG_TRACE("dash::copy", "copy local subrange",
-                   "num_copy_elem:", l_in_last - l_in_first);
-    // Use memcpy for data ranges below 64 KB
-    if (use_memcpy) {
-      std::memcpy(dest_first, // destination
-                  l_in_first, // source
-                  num_local_elem * sizeof(ValueType));
-      out_last = dest_first + num_local_elem;
-    } else {
-      out_last = std::copy(l_in_first,
-                           l_in_last,
-                           dest_first);
-    }
-    // Assert that all elements in local range have been copied:
-    DASH_ASSERT_EQ(out_last, dest_first + num_local_elem,
-                   "Expected to copy " << num_local_elem << " local elements "
-                   "but copied " << (out_last - dest_first));
-    DASH_LOG_TRACE("dash::copy", "finished local copy of",
-                   (out_last - dest_first), "elements");
-    // Advance output pointers:
-    dest_first = out_last;
-    //
-    // -----------------------------------------------------------------------
-    // Copy remote elements succeeding the local subrange:
-    //
-    if (num_postlocal_elem > 0) {
-      DASH_LOG_TRACE("dash::copy",
-                     "copy global range succeeding local subrange",
-                     "in_first:", g_l_in_last.pos(),
-                     "in_last:",  g_in_last.pos());
-      // ... [ ........ | ... l ... | --- copy --- ]
-      //     ^          ^           ^              ^
-      //     in_first   l_in_first  l_in_last      in_last
-      out_last = dash::internal::copy_impl(g_l_in_last,
-                                           g_in_last,
-                                           dest_first,
-                                           handles);
-    }
-  } else {
-    DASH_LOG_TRACE("dash::copy", "no local subrange");
-    // All elements in input range are remote
-    out_last = dash::internal::copy_impl(in_first,
-                                         in_last,
-                                         dest_first,
-                                         handles);
-  }
+  // Local runs in the input range are copied immediately, remote runs are
+  // requested by one get operation per unit:
+  out_last = dash::internal::copy_impl(in_first,
+                                       in_last,
+                                       out_first,
+                                       handles);
 
   if (!handles.empty()) {
     DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
@@ -799,84 +739,15 @@ GlobOutputIt copy(
   GlobOutputIt   out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, local to global");
-  // Return value, initialize with begin of output range, indicating no values
-  // have been copied:
-  GlobOutputIt out_last   = out_first;
-  // Number of elements to copy in total:
-  auto num_elements       = std::distance(in_first, in_last);
-  DASH_LOG_TRACE_VAR("dash::copy", num_elements);
-  // Global iterator pointing at hypothetical end of output range:
-  GlobOutputIt out_h_last = out_first + num_elements;
-  DASH_LOG_TRACE_VAR("dash::copy", out_first.pos());
-  DASH_LOG_TRACE_VAR("dash::copy", out_h_last.pos());
-  // Test if a subrange of global output range is local:
-  auto li_range_out       = local_index_range(out_first, out_h_last);
-  DASH_LOG_TRACE_VAR("dash::copy", li_range_out.begin);
-  DASH_LOG_TRACE_VAR("dash::copy", li_range_out.end);
-  // Number of elements in the local subrange:
-  auto num_local_elem     = li_range_out.end - li_range_out.begin;
   // handles to wait on at the end
   std::vector<dart_handle_t> handles;
-  // Check if part of the output range is local:
-  if (num_local_elem > 0) {
-    // Part of the output range is local
-    // Copy local input subrange to local output range directly:
-    const auto &pattern = out_first.pattern();
-    DASH_LOG_TRACE("dash::copy", "resolving local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy", num_local_elem);
-    // Local index range to global output index range:
-    auto g_l_offset_begin   = pattern.global(li_range_out.begin);
-    DASH_LOG_TRACE_VAR("dash::copy", g_l_offset_begin);
-    auto g_l_offset_end     = pattern.global(li_range_out.end-1)
-                              + 1; // pat.global(l_end) would be out of range
-    DASH_LOG_TRACE_VAR("dash::copy", g_l_offset_end);
-    // Offset of local subrange in output range
-    auto l_elem_offset      = g_l_offset_begin - out_first.pos();
-    DASH_LOG_TRACE_VAR("dash::copy",l_elem_offset);
-    // Convert local subrange of global output to native pointers:
-    ValueType * l_out_first = (out_first + l_elem_offset).local();
-    DASH_LOG_TRACE_VAR("dash::copy", l_out_first);
-    ValueType * l_out_last  = l_out_first + num_local_elem;
-    DASH_LOG_TRACE_VAR("dash::copy", l_out_last);
-    // ... [ ........ | ---- l ---- | ......... ] ...
-    //     ^          ^             ^           ^
-    //     out_first  l_out_first   l_out_last  out_last
-    out_last                = out_first + num_local_elem;
-    // Assert that all elements in local range have been copied:
-    DASH_LOG_TRACE("dash::copy", "copying local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy", in_first);
-    DASH_ASSERT_RETURNS(
-      std::copy(in_first + l_elem_offset,
-                in_first + l_elem_offset + num_local_elem,
-                l_out_first),
-      l_out_last);
-    // Copy to remote elements preceding the local subrange:
-    if (g_l_offset_begin > out_first.pos()) {
-      DASH_LOG_TRACE("dash::copy", "copy to global preceding local subrange");
-      out_last = dash::internal::copy_impl(
-                   in_first,
-                   in_first + l_elem_offset,
-                   out_first,
-                   handles);
-    }
-    // Copy to remote elements succeeding the local subrange:
-    if (g_l_offset_end < out_h_last.pos()) {
-      DASH_LOG_TRACE("dash::copy", "copy to global succeeding local subrange");
-      out_last = dash::internal::copy_impl(
-                   in_first + l_elem_offset + num_local_elem,
-                   in_last,
-                   out_first + num_local_elem,
-                   handles);
-    }
-  } else {
-    // All elements in output range are remote
-    DASH_LOG_TRACE("dash::copy", "no local subrange");
-    out_last = dash::internal::copy_impl(
-                 in_first,
-                 in_last,
-                 out_first,
-                 handles);
-  }
+  // Runs in the local subrange of the output range are copied immediately,
+  // remote runs are written by one put operation per unit:
+  GlobOutputIt out_last = dash::internal::copy_impl(
+                            in_first,
+                            in_last,
+                            out_first,
+                            handles);
 
   if (!handles.empty()) {
     DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
@@ -937,25 +808,208 @@ copy_async(
 }
 #endif
 
+// =========================================================================
+// Global to Global, Distributed Range
+// =========================================================================
+
+namespace internal {
+
+/**
+ * Implementation of \c dash::copy (global to global) for the elements of
+ * the output range that are local to the calling unit.
+ *
+ * Every unit walks the segments of the output range in its local memory
+ * and splits them into segments of the input range. Local input segments
+ * are copied directly, remote input segments are pulled with non-blocking
+ * get operations, coalescing segments of the same source unit.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+GlobOutputIt copy_glob_impl(
+  GlobInputIt                  in_first,
+  GlobInputIt                  in_last,
+  GlobOutputIt                 out_first,
+  std::vector<dart_handle_t> & handles)
+{
+  typedef typename GlobOutputIt::value_type value_type;
+
+  auto num_elem_total = dash::distance(in_first, in_last);
+  DASH_LOG_TRACE("dash::copy_glob_impl()",
+                 "in_first:",  in_first.pos(),
+                 "in_last:",   in_last.pos(),
+                 "out_first:", out_first.pos(),
+                 "elements:",  num_elem_total);
+  if (num_elem_total <= 0) {
+    return out_first;
+  }
+
+  const auto & in_pattern = in_first.pattern();
+  std::vector<copy_run_group<value_type>> groups(in_pattern.team().size());
+
+  // Local segments of the output range, each is assembled from the
+  // segments of the corresponding input subrange:
+  for_each_local_segment(out_first, out_first + num_elem_total,
+    [&](const glob_segment<GlobOutputIt> & out_seg) {
+      auto in_seg_first = in_first + out_seg.offset;
+      for_each_segment(in_seg_first, in_seg_first + out_seg.size,
+        [&](const glob_segment<GlobInputIt> & in_seg) {
+          value_type * dest = out_seg.lbegin + in_seg.offset;
+          if (in_seg.is_local()) {
+            std::copy(in_seg.lbegin, in_seg.lbegin + in_seg.size, dest);
+            return;
+          }
+          auto & group = groups[in_seg.unit.id];
+          if (!copy_run_group_extend(
+                 group, in_seg.lindex, dest, in_seg.size)) {
+            copy_run_group_get(group, handles);
+            copy_run_group_start(
+              group, in_seg.gptr, in_seg.lindex, dest, in_seg.size);
+          }
+        });
+    });
+  for (auto & group : groups) {
+    copy_run_group_get(group, handles);
+  }
+  return out_first + num_elem_total;
+}
+
+} // namespace internal
+
+/**
+ * Variant of \c dash::copy as asynchronous global-to-global copy
+ * operation.
+ *
+ * Collective operation on the team of the output range. Every unit
+ * copies the elements of the output range that are local to it, input
+ * elements must not be modified until all units completed the copy
+ * operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value &&
+                        dash::detail::is_global_iterator<GlobOutputIt>::value
+                      >::type >
+dash::Future<GlobOutputIt> copy_async(
+  GlobInputIt    in_first,
+  GlobInputIt    in_last,
+  GlobOutputIt   out_first)
+{
+  DASH_LOG_TRACE("dash::copy_async()", "async, global to global");
+  auto handles  = std::make_shared<std::vector<dart_handle_t>>();
+  auto out_last = dash::internal::copy_glob_impl(in_first,
+                                                 in_last,
+                                                 out_first,
+                                                 *handles);
+  if (handles->empty()) {
+    return dash::Future<GlobOutputIt>(out_last);
+  }
+  dash::Future<GlobOutputIt> fut_result(
+    // get
+    [=]() mutable {
+      DASH_LOG_TRACE("dash::copy_async [Future]()",
+                    "  wait for", handles->size(), "async get request");
+      if (!handles->empty()) {
+        if (dart_waitall_local(handles->data(), handles->size())
+            != DART_OK) {
+          DASH_LOG_ERROR("dash::copy_async [Future]",
+                        "  dart_waitall_local failed");
+          DASH_THROW(
+            dash::exception::RuntimeError,
+            "dash::copy_async [Future]: dart_waitall_local failed");
+        }
+      }
+      handles->clear();
+      return out_last;
+    },
+    // test
+    [=](GlobOutputIt *out) mutable {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        DART_OK,
+        dart_testall_local(handles->data(), handles->size(), &flag));
+      if (flag) {
+        handles->clear();
+        *out = out_last;
+      }
+      return (flag != 0);
+    },
+    // destroy
+    [=]() mutable {
+      for (auto& handle : *handles) {
+        DASH_ASSERT_RETURNS(
+          DART_OK,
+          dart_handle_free(&handle));
+      }
+    }
+  );
+  return fut_result;
+}
+
 /**
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
  *
+ * Collective operation on the team of the output range, returns after
+ * all units completed the copy operation.
+ *
+ * \see dash::copy_async
+ *
  * \ingroup  DashAlgorithms
  */
-template <typename ValueType, class GlobInputIt, class GlobOutputIt>
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value &&
+                        dash::detail::is_global_iterator<GlobOutputIt>::value
+                      >::type >
 GlobOutputIt copy(
-    GlobInputIt /*in_first*/,
-    GlobInputIt /*in_last*/,
-    GlobOutputIt /*out_first*/)
+  GlobInputIt    in_first,
+  GlobInputIt    in_last,
+  GlobOutputIt   out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
+  std::vector<dart_handle_t> handles;
+  auto out_last = dash::internal::copy_glob_impl(in_first,
+                                                 in_last,
+                                                 out_first,
+                                                 handles);
+  if (!handles.empty()) {
+    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
+                  "num_handles: ", handles.size());
+    dart_waitall_local(handles.data(), handles.size());
+  }
+  out_first.pattern().team().barrier();
+  DASH_LOG_TRACE("dash::copy >", "finished,",
+                 "out_last:", out_last.pos());
+  return out_last;
+}
 
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
-
-  return GlobOutputIt();
+/**
+ * Specialization of \c dash::copy as global-to-global blocking copy
+ * operation with explicitly specified value type.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType,
+  class GlobInputIt,
+  class GlobOutputIt,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value &&
+                        dash::detail::is_global_iterator<GlobOutputIt>::value
+                      >::type >
+GlobOutputIt copy(
+  GlobInputIt    in_first,
+  GlobInputIt    in_last,
+  GlobOutputIt   out_first)
+{
+  return dash::copy(in_first, in_last, out_first);
 }
 
 #endif // DOXYGEN
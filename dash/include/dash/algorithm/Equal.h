@@ -3,9 +3,12 @@
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/CollectiveFuture.h>
 #include <dash/dart/if/dart_communication.h>
 #include <dash/iterator/GlobIter.h>
 
+#include <memory>
+
 namespace dash {
 namespace internal {
   template<typename Ptr>
@@ -39,16 +42,49 @@ namespace internal {
     // KNOWN ISSUE
     return std::equal(glfirst_1, glfirst_1+dist, first_2+offset);
   }
+
+  /**
+   * Starts the reduction of the local results of \c dash::equal and
+   * returns a future for the global result.
+   */
+  inline dash::Future<bool> equal_reduce_async(
+      char               l_result,
+      const dash::Team & team){
+    struct equal_state {
+      char l_result;
+      char r_result;
+    };
+    auto state      = std::make_shared<equal_state>();
+    state->l_result = l_result;
+    state->r_result = 0;
+
+    dart_handle_t handle;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce_handle(&(state->l_result), &(state->r_result), 1,
+        DART_TYPE_BYTE, DART_OP_BAND, team.dart_id(), &handle),
+      DART_OK);
+
+    return dash::internal::collective_future<bool>(
+        handle, state,
+        [](const equal_state & st) { return st.r_result != 0; });
+  }
   }  // namespace internal
 
   /**
-   * Returns true if the range \c [first1, last1) is equal to the range
-   * \c [first2, first2 + (last1 - first1)), and false otherwise.
+   * Asynchronous variant of \c dash::equal.
+   * Returns a future for the result of the comparison of the range
+   * \c [first1, last1) with the range \c [first2, first2 + (last1 - first1)).
+   *
+   * The local ranges are compared before the function returns, the
+   * reduction of the local results is not completed before the future is
+   * waited for.
+   *
+   * \see dash::equal
    *
    * \ingroup     DashAlgorithms
    */
   template <typename GlobIter>
-  bool equal(
+  dash::Future<bool> equal_async(
       /// Iterator to the initial position in the sequence
       GlobIter first_1,
       /// Iterator to the final position in the sequence
@@ -80,24 +116,36 @@ namespace internal {
         first_1, last_1, first_2);
   }
 
-  char r_result         = 0;
-
-  DASH_ASSERT_RETURNS(
-    dart_allreduce(&l_result, &r_result, 1,
-      DART_TYPE_BYTE, DART_OP_BAND, team.dart_id()),
-    DART_OK);
-  return r_result;
+  return ::dash::internal::equal_reduce_async(l_result, team);
 }
 
 /**
  * Returns true if the range \c [first1, last1) is equal to the range
- * \c [first2, first2 + (last1 - first1)) with respect to a specified
- * predicate, and false otherwise.
+ * \c [first2, first2 + (last1 - first1)), and false otherwise.
  *
  * \ingroup     DashAlgorithms
  */
-template <typename GlobIter, class BinaryPredicate>
+template <typename GlobIter>
 bool equal(
+    /// Iterator to the initial position in the sequence
+    GlobIter first_1,
+    /// Iterator to the final position in the sequence
+    GlobIter last_1,
+    GlobIter first_2)
+{
+  return dash::equal_async(first_1, last_1, first_2).get();
+}
+
+/**
+ * Asynchronous variant of \c dash::equal with respect to a specified
+ * predicate.
+ *
+ * \see dash::equal_async
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIter, class BinaryPredicate>
+dash::Future<bool> equal_async(
     /// Iterator to the initial position in the sequence
     GlobIter first_1,
     /// Iterator to the final position in the sequence
@@ -128,13 +176,26 @@ bool equal(
         first_1, last_1, first_2);
   }
 
-  char r_result      = 0;
+  return ::dash::internal::equal_reduce_async(l_result, team);
+}
 
-  DASH_ASSERT_RETURNS(
-    dart_allreduce(&l_result, &r_result, 1,
-      DART_TYPE_BYTE, DART_OP_BAND, team.dart_id()),
-    DART_OK);
-  return r_result;
+/**
+ * Returns true if the range \c [first1, last1) is equal to the range
+ * \c [first2, first2 + (last1 - first1)) with respect to a specified
+ * predicate, and false otherwise.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIter, class BinaryPredicate>
+bool equal(
+    /// Iterator to the initial position in the sequence
+    GlobIter first_1,
+    /// Iterator to the final position in the sequence
+    GlobIter last_1,
+    GlobIter first_2,
+    BinaryPredicate pred)
+{
+  return dash::equal_async(first_1, last_1, first_2, pred).get();
 }
 
 } // namespace dash
@@ -7,14 +7,13 @@
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
-
-#include <dash/util/UnitLocality.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Segments.h>
 
 #include <dash/dart/if/dart_communication.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <algorithm>
+#include <type_traits>
 
 
 namespace dash {
@@ -24,15 +23,27 @@ namespace dash {
  *
  * Being a collaborative operation, each unit will assign the value to
  * its local elements only.
+ * Local elements are assigned as specified by the execution policy.
  *
  * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(d * ns) + O(nl), with \c d dimensions in the global
+ *              iterators' pattern, \c ns contiguous segments and \c nl
+ *              local elements within the global range
  *
+ * \see         dash::execution
  * \ingroup     DashAlgorithms
  */
-template <typename GlobIterType>
+template <
+  class    ExecutionPolicy,
+  typename GlobIterType,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
 void fill(
+  /// Execution policy of the assignment of local elements
+  ExecutionPolicy  && policy,
   /// Iterator to the initial position in the sequence
   GlobIterType        first,
   /// Iterator to the final position in the sequence
@@ -40,27 +51,33 @@ void fill(
   /// Value which will be assigned to the elements in range [first, last)
   const typename GlobIterType::value_type & value)
 {
-  typedef typename GlobIterType::index_type index_t;
-  typedef typename GlobIterType::value_type value_t;
-
-  // Global iterators to local range:
-  auto      index_range = dash::local_range(first, last);
-  value_t * lfirst      = index_range.begin;
-  value_t * llast       = index_range.end;
+  typedef typename GlobIterType::local_pointer local_pointer;
 
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  auto nlocal    = llast - lfirst;
-  DASH_LOG_DEBUG("dash::fill", "thread capacity:",  n_threads);
-  #pragma omp parallel for num_threads(n_threads)
-  for (index_t lt = 0; lt < nlocal; ++lt) {
-    lfirst[lt] = value;
-  }
+  // Local elements of the global range to native pointers:
+  dash::internal::for_each_local_run(
+    dash::internal::execution_threads(policy), first, last,
+    [&](local_pointer lbegin, local_pointer lend) {
+      std::fill(lbegin, lend, value);
+    });
+}
 
-#else
-  std::fill(lfirst, llast, value);
-#endif
+/**
+ * Assigns the given value to the elements in the range [first, last)
+ * using the threads available to the unit.
+ *
+ * \see         dash::execution::par
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIterType>
+void fill(
+  /// Iterator to the initial position in the sequence
+  GlobIterType        first,
+  /// Iterator to the final position in the sequence
+  GlobIterType        last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const typename GlobIterType::value_type & value)
+{
+  dash::fill(dash::execution::par, first, last, value);
 }
 
 } // namespace dash
@@ -4,22 +4,91 @@
 #include <dash/Array.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/CollectiveFuture.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Segments.h>
 #include <dash/dart/if/dart_communication.h>
 #include <dash/iterator/GlobIter.h>
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
 namespace dash {
 
+namespace internal {
+
 /**
- * Returns an iterator to the first element in the range \c [first,last) that
- * compares equal to \c val.
- * If no such element is found, the function returns \c last.
+ * Offset in the range \c [first,last) of the first element in local
+ * memory of the calling unit that satisfies the predicate, or the maximum
+ * value of the index type if no such element is found.
+ * Local elements are searched as specified by the execution policy.
+ */
+template <
+  class    ExecutionPolicy,
+  typename GlobIter,
+  typename UnaryPredicate>
+typename dash::iterator_traits<GlobIter>::index_type find_if_local(
+  const ExecutionPolicy & policy,
+  const GlobIter        & first,
+  const GlobIter        & last,
+  UnaryPredicate          predicate)
+{
+  using index_t = typename dash::iterator_traits<GlobIter>::index_type;
+
+  // Offset of the first local match in the range, segments are not
+  // necessarily visited in the order of the range:
+  index_t l_offset = dash::internal::reduce_local_segments(
+    dash::internal::execution_threads(policy), first, last,
+    std::numeric_limits<index_t>::max(),
+    [&](index_t & hit,
+        const dash::internal::glob_segment<GlobIter> & seg) {
+      if (seg.offset >= hit) {
+        return;
+      }
+      auto l_hit = std::find_if(seg.lbegin, seg.lbegin + seg.size,
+                                predicate);
+      if (l_hit != seg.lbegin + seg.size) {
+        hit = seg.offset + (l_hit - seg.lbegin);
+      }
+    },
+    [](index_t & hit, index_t chunk_hit) {
+      hit = std::min(hit, chunk_hit);
+    });
+  DASH_LOG_DEBUG("dash::find_if_local", "local hit offset:", l_offset);
+  return l_offset;
+}
+
+} // namespace internal
+
+/**
+ * Asynchronous variant of \c dash::find.
+ * Returns a future for an iterator to the first element in the range
+ * \c [first,last) that compares equal to \c val, or \c last if no such
+ * element is found.
+ *
+ * The local range is searched as specified by the execution policy
+ * before the function returns, the reduction of the local results is not
+ * completed before the future is waited for.
+ *
+ * \see dash::find
+ * \see dash::execution
  *
  * \ingroup     DashAlgorithms
  */
 template<
+  class    ExecutionPolicy,
   typename GlobIter,
-  typename ElementType>
-GlobIter find(
+  typename ElementType,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
+dash::Future<GlobIter> find_async(
+  /// Execution policy of the search in local elements
+  ExecutionPolicy && policy,
   /// Iterator to the initial position in the sequence
   GlobIter   first,
   /// Iterator to the final position in the sequence
@@ -32,61 +101,122 @@ GlobIter find(
   using iterator_traits = dash::iterator_traits<GlobIter>;
 
   using p_index_t = typename iterator_traits::index_type;
+  using value_t   = typename iterator_traits::value_type;
 
   if(first >= last) {
-    return last;
+    return dash::Future<GlobIter>(last);
   }
 
-  p_index_t g_index;
-  auto & pattern     = first.pattern();
-  auto & team        = pattern.team();
-  auto index_range   = dash::local_index_range(first, last);
-  auto l_begin_index = index_range.begin;
-  auto l_end_index   = index_range.end;
-  auto first_offset  = first.pos();
-  if(l_begin_index == l_end_index){
-    g_index = std::numeric_limits<p_index_t>::max();
-  } else {
-   auto g_begin_index = pattern.global(l_begin_index);
-
-    // Pointer to first element in local memory:
-    const ElementType * lbegin        = first.globmem().lbegin();
-    // Pointers to first / final element in local range:
-    const ElementType * l_range_begin = lbegin + l_begin_index;
-    const ElementType * l_range_end   = lbegin + l_end_index;
-
-    DASH_LOG_DEBUG("local index range", l_begin_index, l_end_index);
-
-    auto l_result = std::find(l_range_begin, l_range_end, value);
-    if(l_result == l_range_end){
-      DASH_LOG_DEBUG("Not found in local range");
-      g_index = std::numeric_limits<p_index_t>::max();
-    } else {
-      auto l_hit_index = l_result - lbegin;
-      g_index = pattern.global(l_hit_index);
-    }
-  }
-  team.barrier();
+  auto & team = first.pattern().team();
 
-  // receive buffer for global maximal index
-  p_index_t g_hit_idx;
+  struct find_state {
+    p_index_t g_index;
+    // receive buffer for global minimal index
+    p_index_t g_hit_idx;
+  };
+  auto state = std::make_shared<find_state>();
+  state->g_index = dash::internal::find_if_local(policy, first, last,
+                     [&value](const value_t & elem) {
+                       return elem == value;
+                     });
 
+  dart_handle_t handle;
   DASH_ASSERT_RETURNS(
-      dart_allreduce(
-        &g_index,
-        &g_hit_idx,
+      dart_allreduce_handle(
+        &(state->g_index),
+        &(state->g_hit_idx),
         1,
         dart_datatype<p_index_t>::value,
         DART_OP_MIN,
-        team.dart_id()),
+        team.dart_id(),
+        &handle),
       DART_OK);
 
-  if (g_hit_idx == std::numeric_limits<p_index_t>::max()) {
-    DASH_LOG_DEBUG("element not found");
-  } else {
-    return first + g_hit_idx;
-  }
-  return last;
+  return dash::internal::collective_future<GlobIter>(
+      handle, state,
+      [first, last](const find_state & st) {
+        if (st.g_hit_idx == std::numeric_limits<p_index_t>::max()) {
+          DASH_LOG_DEBUG("element not found");
+          return last;
+        }
+        return first + st.g_hit_idx;
+      });
+}
+
+/**
+ * Asynchronous variant of \c dash::find, local elements are searched
+ * sequentially.
+ *
+ * \see dash::find
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename GlobIter,
+  typename ElementType>
+dash::Future<GlobIter> find_async(
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Value which is searched for using operator==
+  const ElementType & value)
+{
+  return dash::find_async(dash::execution::seq, first, last, value);
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ *
+ * Local elements are searched as specified by the execution policy.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename GlobIter,
+  typename ElementType,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
+GlobIter find(
+  /// Execution policy of the search in local elements
+  ExecutionPolicy && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Value which is searched for using operator==
+  const ElementType & value)
+{
+  return dash::find_async(policy, first, last, value).get();
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename GlobIter,
+  typename ElementType>
+GlobIter find(
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Value which is searched for using operator==
+  const ElementType & value)
+{
+  return dash::find_async(dash::execution::seq, first, last, value).get();
 }
 
 /**
@@ -94,13 +224,26 @@ GlobIter find(
  * satisfies the predicate \c p.
  * If no such element is found, the function returns \c last.
  *
+ * Local elements are searched as specified by the execution policy.
+ *
  * \see dash::find
  * \see dash::find_if_not
+ * \see dash::execution
  *
  * \ingroup     DashAlgorithms
  */
-template <typename GlobIter, typename UnaryPredicate>
+template <
+  class    ExecutionPolicy,
+  typename GlobIter,
+  typename UnaryPredicate,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
 GlobIter find_if(
+    /// Execution policy of the search in local elements
+    ExecutionPolicy && policy,
     /// Iterator to the initial position in the sequence
     GlobIter first,
     /// Iterator to the final position in the sequence
@@ -112,35 +255,87 @@ GlobIter find_if(
 
   using index_t = typename iterator_traits::index_type;
 
-  auto& team = first.pattern().team();
-  auto  myid = team.myid();
-  /// Global iterators to local range:
-  auto index_range = dash::local_range(first, last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-
-  auto l_result = std::find_if(l_first, l_last, predicate);
-  auto l_offset = l_result == l_last ? -1 : std::distance(l_first, l_result);
-
-  dash::Array<index_t> l_results(team.size(), team);
-
-  l_results.local[0] = l_offset;
+  if (first >= last) {
+    return last;
+  }
 
-  team.barrier();
+  auto & team = first.pattern().team();
+  // Offset of the first local match in the range:
+  index_t l_offset = dash::internal::find_if_local(
+                       policy, first, last, predicate);
 
-  // All local offsets stored in l_results
-  auto result = last;
+  index_t g_offset;
+  DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &l_offset,
+        &g_offset,
+        1,
+        dart_datatype<index_t>::value,
+        DART_OP_MIN,
+        team.dart_id()),
+      DART_OK);
 
-  for (auto u = 0; u < team.size(); u++) {
-    if (l_results[u] >= 0) {
-      auto g_offset = first.pattern().global_index(u, {l_results[u]});
-      result        = first + g_offset - first.pos();
-      break;
-    }
+  if (g_offset == std::numeric_limits<index_t>::max()) {
+    return last;
   }
+  return first + g_offset;
+}
 
-  team.barrier();
-  return result;
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * satisfies the predicate \c p.
+ * If no such element is found, the function returns \c last.
+ *
+ * \see dash::find
+ * \see dash::find_if_not
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIter, typename UnaryPredicate>
+GlobIter find_if(
+    /// Iterator to the initial position in the sequence
+    GlobIter first,
+    /// Iterator to the final position in the sequence
+    GlobIter last,
+    /// Predicate which will be applied to the elements in range [first, last)
+    UnaryPredicate predicate)
+{
+  return dash::find_if(dash::execution::seq, first, last, predicate);
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * does not satisfy the predicate \c p.
+ * If no such element is found, the function returns \c last.
+ *
+ * Local elements are searched as specified by the execution policy.
+ *
+ * \see dash::find
+ * \see dash::find_if_not
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    class    ExecutionPolicy,
+    typename GlobIter,
+    class    UnaryPredicate,
+    typename = typename std::enable_if<
+                 dash::is_execution_policy<
+                   typename std::decay<ExecutionPolicy>::type
+                 >::value
+               >::type >
+GlobIter find_if_not(
+    /// Execution policy of the search in local elements
+    ExecutionPolicy && policy,
+    /// Iterator to the initial position in the sequence
+    GlobIter first,
+    /// Iterator to the final position in the sequence
+    GlobIter last,
+    /// Predicate which will be applied to the elements in range [first, last)
+    UnaryPredicate predicate)
+{
+  return dash::find_if(policy, first, last, std::not1(predicate));
 }
 
 /**
@@ -164,7 +359,7 @@ GlobIter find_if_not(
     /// Predicate which will be applied to the elements in range [first, last)
     UnaryPredicate predicate)
 {
-  return find_if(first, last, std::not1(predicate));
+  return dash::find_if_not(dash::execution::seq, first, last, predicate);
 }
 
 } // namespace dash
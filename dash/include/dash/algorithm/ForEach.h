@@ -2,9 +2,13 @@
 #define DASH__ALGORITHM__FOR_EACH_H__
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Segments.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <algorithm>
+#include <functional>
+#include <type_traits>
 
 
 namespace dash {
@@ -14,7 +18,7 @@ namespace dash {
  * This function has the same signature as \c std::for_each but
  * Being a collaborative operation, each unit will invoke the given
  * function on its local elements only.
- * To support compiler optimization, this const version is provided
+ * Local elements are processed as specified by the execution policy.
  *
  * \tparam      ElementType   Type of the elements in the sequence
  * \tparam      UnaryFunction Function to invoke for each element
@@ -23,13 +27,25 @@ namespace dash {
  *                            Signature does not need to have \c (const &)
  *                            but must be compatible to \c std::for_each.
  *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(d * ns) + O(nl), with \c d dimensions in the global
+ *              iterators' pattern, \c ns contiguous segments and \c nl
+ *              local elements within the global range
  *
+ * \see         dash::execution
  * \ingroup     DashAlgorithms
  */
-template <typename GlobInputIt, class UnaryFunction>
+template <
+  class    ExecutionPolicy,
+  typename GlobInputIt,
+  class    UnaryFunction,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
 void for_each(
+    /// Execution policy of the invocations on local elements
+    ExecutionPolicy && policy,
     /// Iterator to the initial position in the sequence
     const GlobInputIt& first,
     /// Iterator to the final position in the sequence
@@ -38,30 +54,45 @@ void for_each(
     UnaryFunction func)
 {
   using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  using local_pointer   = typename GlobInputIt::local_pointer;
   static_assert(
       iterator_traits::is_global_iterator::value,
       "must be a global iterator");
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto & pattern    = first.pattern();
-    // Local range to native pointers:
-    auto lrange_begin = (first + pattern.global(lbegin_index)).local();
-    auto lrange_end   = lrange_begin + lend_index;
-    std::for_each(lrange_begin, lrange_end, func);
-  }
+  // Local elements of the global range to native pointers:
+  dash::internal::for_each_local_run(
+    dash::internal::execution_threads(policy), first, last,
+    [&](local_pointer lbegin, local_pointer lend) {
+      std::for_each(lbegin, lend, std::ref(func));
+    });
+  auto & team = first.pattern().team();
   team.barrier();
 }
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Local elements are processed sequentially.
+ *
+ * \see         dash::execution::seq
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunction>
+void for_each(
+    /// Iterator to the initial position in the sequence
+    const GlobInputIt& first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt& last,
+    /// Function to invoke on every index in the range
+    UnaryFunction func)
+{
+  dash::for_each(dash::execution::seq, first, last, func);
+}
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * Being a collaborative operation, each unit will invoke the given
  * function on its local elements only. The index passed to the function is
  * a global index.
+ * Local elements are processed as specified by the execution policy.
  *
  * \tparam      ElementType            Type of the elements in the sequence
  * \tparam      UnaryFunctionWithIndex Function to invoke for each element
@@ -71,13 +102,25 @@ void for_each(
  *                                     \c (const &) but must be compatible
  *                                     to \c std::for_each.
  *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(d * ns) + O(nl), with \c d dimensions in the global
+ *              iterators' pattern, \c ns contiguous segments and \c nl
+ *              local elements within the global range
  *
+ * \see         dash::execution
  * \ingroup     DashAlgorithms
  */
-template <typename GlobInputIt, class UnaryFunctionWithIndex>
+template <
+  class    ExecutionPolicy,
+  typename GlobInputIt,
+  class    UnaryFunctionWithIndex,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
 void for_each_with_index(
+    /// Execution policy of the invocations on local elements
+    ExecutionPolicy && policy,
     /// Iterator to the initial position in the sequence
     const GlobInputIt& first,
     /// Iterator to the final position in the sequence
@@ -86,31 +129,43 @@ void for_each_with_index(
     UnaryFunctionWithIndex func)
 {
   using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  using index_t         = typename iterator_traits::index_type;
   static_assert(
       iterator_traits::is_global_iterator::value,
       "must be a global iterator");
 
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto & pattern    = first.pattern();
-    auto first_offset = first.pos();
-    // Iterate local index range:
-    for (auto lindex = lbegin_index;
-         lindex != lend_index;
-         ++lindex) {
-      auto gindex       = pattern.global(lindex);
-      auto element_it   = first + (gindex - first_offset);
-      func(*(element_it.local()), gindex);
-    }
-  }
+  // Local segments of the global range to native pointers:
+  dash::internal::for_each_local_segment(
+    dash::internal::execution_threads(policy), first, last,
+    [&](const dash::internal::glob_segment<GlobInputIt> & seg) {
+      for (index_t i = 0; i < seg.size; ++i) {
+        func(seg.lbegin[i], seg.gindex + i);
+      }
+    });
+  auto & team = first.pattern().team();
   team.barrier();
 }
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * The index passed to the function is a global index.
+ * Local elements are processed sequentially.
+ *
+ * \see         dash::execution::seq
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunctionWithIndex>
+void for_each_with_index(
+    /// Iterator to the initial position in the sequence
+    const GlobInputIt& first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt& last,
+    /// Function to invoke on every index in the range
+    UnaryFunctionWithIndex func)
+{
+  dash::for_each_with_index(dash::execution::seq, first, last, func);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__FOR_EACH_H__
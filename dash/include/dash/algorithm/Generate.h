@@ -3,11 +3,15 @@
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Segments.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/dart/if/dart_communication.h>
 
 #include <algorithm>
+#include <functional>
+#include <type_traits>
 
 namespace dash {
 
@@ -17,19 +21,32 @@ namespace dash {
  *
  * Being a collaborative operation, each unit will invoke the given
  * function on its local elements only.
+ * Local elements are assigned as specified by the execution policy.
  *
  * \tparam      ElementType    Type of the elements in the sequence
  *                             invoke, deduced from parameter \c gen
  * \tparam      UnaryFunction  Unary function with signature
  *                             \c ElementType(void)
  *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(d * ns) + O(nl), with \c d dimensions in the global
+ *              iterators' pattern, \c ns contiguous segments and \c nl
+ *              local elements within the global range
  *
+ * \see         dash::execution
  * \ingroup     DashAlgorithms
  */
-template <typename GlobInputIt, class UnaryFunction>
+template <
+  class    ExecutionPolicy,
+  typename GlobInputIt,
+  class    UnaryFunction,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
 void generate(
+    /// Execution policy of the assignment of local elements
+    ExecutionPolicy && policy,
     /// Iterator to the initial position in the sequence
     GlobInputIt first,
     /// Iterator to the final position in the sequence
@@ -38,15 +55,36 @@ void generate(
     UnaryFunction gen)
 {
   using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  using local_pointer   = typename GlobInputIt::local_pointer;
   static_assert(
       iterator_traits::is_global_iterator::value,
       "must be a global iterator");
-  /// Global iterators to local range:
-  auto lrange = dash::local_range(first, last);
-  auto lfirst = lrange.begin;
-  auto llast  = lrange.end;
+  // Local elements of the global range to native pointers:
+  dash::internal::for_each_local_run(
+    dash::internal::execution_threads(policy), first, last,
+    [&](local_pointer lbegin, local_pointer lend) {
+      std::generate(lbegin, lend, std::ref(gen));
+    });
+}
 
-  std::generate(lfirst, llast, gen);
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g.
+ * Local elements are assigned sequentially.
+ *
+ * \see         dash::execution::seq
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunction>
+void generate(
+    /// Iterator to the initial position in the sequence
+    GlobInputIt first,
+    /// Iterator to the final position in the sequence
+    GlobInputIt last,
+    /// Generator function
+    UnaryFunction gen)
+{
+  dash::generate(dash::execution::seq, first, last, gen);
 }
 
 /**
@@ -56,19 +94,32 @@ void generate(
  *
  * Being a collaborative operation, each unit will invoke the given
  * function on its local elements only.
+ * Local elements are assigned as specified by the execution policy.
  *
  * \tparam      ElementType    Type of the elements in the sequence
  *                             invoke, deduced from parameter \c gen
  * \tparam      UnaryFunction  Unary function with signature
  *                             \c ElementType(index_t)
  *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(d * ns) + O(nl), with \c d dimensions in the global
+ *              iterators' pattern, \c ns contiguous segments and \c nl
+ *              local elements within the global range
  *
+ * \see         dash::execution
  * \ingroup     DashAlgorithms
  */
-template <typename GlobInputIt, class UnaryFunction>
+template <
+  class    ExecutionPolicy,
+  typename GlobInputIt,
+  class    UnaryFunction,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
 void generate_with_index(
+    /// Execution policy of the assignment of local elements
+    ExecutionPolicy && policy,
     /// Iterator to the initial position in the sequence
     GlobInputIt first,
     /// Iterator to the final position in the sequence
@@ -77,25 +128,39 @@ void generate_with_index(
     UnaryFunction gen)
 {
   using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  using index_t         = typename iterator_traits::index_type;
   static_assert(
       iterator_traits::is_global_iterator::value,
       "must be a global iterator");
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
+  // Local segments of the global range to native pointers:
+  dash::internal::for_each_local_segment(
+    dash::internal::execution_threads(policy), first, last,
+    [&](const dash::internal::glob_segment<GlobInputIt> & seg) {
+      for (index_t i = 0; i < seg.size; ++i) {
+        seg.lbegin[i] = gen(seg.gindex + i);
+      }
+    });
+}
 
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto& pattern      = first.pattern();
-    auto  first_offset = first.pos();
-    // Iterate local index range:
-    for (auto lindex = lbegin_index; lindex != lend_index; ++lindex) {
-      auto gindex     = pattern.global(lindex);
-      auto element_it = first + (gindex - first_offset);
-      *element_it     = gen(gindex);
-    }
-  }
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g. The index passed to the function is
+ * a global index.
+ * Local elements are assigned sequentially.
+ *
+ * \see         dash::execution::seq
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunction>
+void generate_with_index(
+    /// Iterator to the initial position in the sequence
+    GlobInputIt first,
+    /// Iterator to the final position in the sequence
+    GlobInputIt last,
+    /// Generator function
+    UnaryFunction gen)
+{
+  dash::generate_with_index(dash::execution::seq, first, last, gen);
 }
 
 }  // namespace dash
@@ -9,25 +9,159 @@
 
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
-#include <dash/util/UnitLocality.h>
 
 #include <dash/internal/Logging.h>
 #include <dash/iterator/GlobIter.h>
 
+#include <dash/algorithm/internal/CollectiveFuture.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Segments.h>
+
 #include <algorithm>
 #include <memory>
-
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <type_traits>
+#include <vector>
 
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Pointer to the first minimum element of a global range in local memory
+ * of the calling unit and its position in the range, or \c nullptr and
+ * -1 if the range contains no local elements.
+ */
+template <typename ValueType, typename IndexType>
+struct local_min_element {
+  const ValueType * lmin;
+  IndexType         offset;
+};
+
+/**
+ * Whether the local elements of ranges of global iterators of type
+ * \c GlobIterType are stored in the order of the range, i.e. for ranges
+ * that are not relative to a view distributed by a one-dimensional
+ * pattern.
+ */
+template <class GlobIterType>
+struct local_order_is_range_order
+: std::integral_constant<
+    bool,
+    !GlobIterType::has_view::value &&
+    GlobIterType::pattern_type::ndim() == 1 >
+{ };
+
+/**
+ * Finds the first minimum element of the global range \c [first, last) in
+ * local memory of the calling unit using at most \c n_threads threads.
+ *
+ * Local elements are stored in the order of the range, so the first
+ * minimum in local memory is found in runs of local elements and its
+ * position in the range is resolved from its local index.
+ */
+template <class GlobInputIt, class Compare>
+local_min_element<
+  typename std::decay<typename GlobInputIt::value_type>::type,
+  typename GlobInputIt::index_type>
+min_element_local(
+  int                 n_threads,
+  const GlobInputIt & first,
+  const GlobInputIt & last,
+  Compare             compare,
+  std::true_type      /* local_order_is_range_order */)
+{
+  typedef typename GlobInputIt::index_type     index_t;
+  typedef typename GlobInputIt::local_pointer  local_pointer;
+  typedef typename std::decay<
+            typename GlobInputIt::value_type>::type value_t;
+  typedef local_min_element<value_t, index_t>   result_t;
+
+  // Runs and chunks are visited in the order of the range, prefer the
+  // first occurrence of equal values:
+  auto update_min = [&](result_t & res, const value_t * l_min) {
+    if (res.lmin == nullptr || compare(*l_min, *res.lmin)) {
+      res.lmin = l_min;
+    }
+  };
+  auto l_res = dash::internal::reduce_local_runs(
+    n_threads, first, last,
+    result_t { nullptr, -1 },
+    [&](result_t & res, local_pointer lbegin, local_pointer lend) {
+      update_min(res, ::std::min_element(lbegin, lend, compare));
+    },
+    [&](result_t & res, const result_t & chunk_res) {
+      if (chunk_res.lmin != nullptr) {
+        update_min(res, chunk_res.lmin);
+      }
+    });
+  if (l_res.lmin != nullptr) {
+    GlobInputIt first_it(first);
+    index_t l_index = l_res.lmin - first_it.globmem().lbegin();
+    l_res.offset    = first.pattern().global(l_index) - first.gpos();
+  }
+  return l_res;
+}
+
+/**
+ * Finds the first minimum element of the global range \c [first, last) in
+ * local memory of the calling unit using at most \c n_threads threads.
+ *
+ * Local elements are not stored in the order of the range, the minimum
+ * is found in local segments which provide the position of their
+ * elements in the range.
+ */
+template <class GlobInputIt, class Compare>
+local_min_element<
+  typename std::decay<typename GlobInputIt::value_type>::type,
+  typename GlobInputIt::index_type>
+min_element_local(
+  int                 n_threads,
+  const GlobInputIt & first,
+  const GlobInputIt & last,
+  Compare             compare,
+  std::false_type     /* local_order_is_range_order */)
+{
+  typedef typename GlobInputIt::index_type     index_t;
+  typedef typename std::decay<
+            typename GlobInputIt::value_type>::type value_t;
+  typedef local_min_element<value_t, index_t>   result_t;
+
+  // Segments are not necessarily visited in the order of the range,
+  // prefer the first occurrence of equal values:
+  auto update_min = [&](result_t & res,
+                        const value_t * l_min, index_t l_offset) {
+    if (res.lmin == nullptr ||
+        compare(*l_min, *res.lmin) ||
+        (!compare(*res.lmin, *l_min) && l_offset < res.offset)) {
+      res.lmin   = l_min;
+      res.offset = l_offset;
+    }
+  };
+  return dash::internal::reduce_local_segments(
+    n_threads, first, last,
+    result_t { nullptr, -1 },
+    [&](result_t & res,
+        const dash::internal::glob_segment<GlobInputIt> & seg) {
+      const value_t * l_seg_min = ::std::min_element(
+                                    seg.lbegin, seg.lbegin + seg.size,
+                                    compare);
+      update_min(res, l_seg_min, seg.offset + (l_seg_min - seg.lbegin));
+    },
+    [&](result_t & res, const result_t & chunk_res) {
+      if (chunk_res.lmin != nullptr) {
+        update_min(res, chunk_res.lmin, chunk_res.offset);
+      }
+    });
+}
+
+} // namespace internal
+
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
- * Specialization for local range, delegates to std::min_element.
+ * Specialization for local range, elements are compared as specified by
+ * the execution policy.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
@@ -36,15 +170,23 @@ namespace dash {
  * \tparam      Compare      Binary comparison function with signature
  *                           \c bool (const TypeA &a, const TypeB &b)
  *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(nl), with \c nl elements in the local range
  *
+ * \see         dash::execution
  * \ingroup     DashAlgorithms
  */
 template <
+  class ExecutionPolicy,
   class ElementType,
-  class Compare = std::less<const ElementType &> >
+  class Compare = std::less<const ElementType &>,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
 const ElementType * min_element(
+  /// Execution policy of the comparison of local elements
+  ExecutionPolicy  && policy,
   /// Iterator to the initial position in the sequence
   const ElementType * l_range_begin,
   /// Iterator to the final position in the sequence
@@ -53,105 +195,90 @@ const ElementType * min_element(
   Compare             compare
     = std::less<const ElementType &>())
 {
-#ifdef DASH_ENABLE_OPENMP
-  typedef typename std::decay<ElementType>::type      value_t;
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::min_element", "thread capacity:",  n_threads);
-
-  // TODO: Should also restrict on elements/units > ~10240.
-  //       Find a model for the minimum work laod.
-  if (n_threads > 1) {
-    auto          l_size     = l_range_end - l_range_begin;
-    int           min_idx_l  = 0;
-    ElementType   min_val_l  = *l_range_begin;
-
-    typedef struct min_pos_t { value_t val; size_t idx; } min_pos;
-
-    DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size);
-    int       align_bytes      = uloc.cache_line_size(0);
-    size_t    min_vals_t_size  = n_threads + 1 +
-                                 (align_bytes / sizeof(min_pos));
-    size_t    min_vals_t_bytes = min_vals_t_size * sizeof(min_pos);
-    auto *    min_vals_t_raw   = new min_pos[min_vals_t_size];
-    void    * min_vals_t_alg   = min_vals_t_raw;
-    auto *    min_vals_t       = static_cast<min_pos *>(dash::align(
-        align_bytes, sizeof(min_pos), min_vals_t_alg, min_vals_t_bytes));
-    DASH_LOG_TRACE("dash::min_element", "min * alloc:",   min_vals_t_raw);
-    DASH_LOG_TRACE("dash::min_element", "min * aligned:", min_vals_t);
-    DASH_LOG_TRACE("dash::min_element", "min * size:",    min_vals_t_bytes);
-    DASH_ASSERT_GE(min_vals_t_bytes, n_threads * sizeof(min_pos),
-                   "Aligned buffer of min_pos has insufficient size");
-    DASH_ASSERT_MSG(nullptr != min_vals_t,
-                    "Aligned allocation of min_pos returned nullptr");
-
-    // Cannot use user-defined reduction (OpenMP 4.0) as the compare
-    // predicate cannot be used in `omp declare reduction`.
-    // Avoid omp for + omp critical section by using array of
-    // thread-local minimum values, aligned to prevent false sharing:
-    int t_id;
-    #pragma omp parallel num_threads(n_threads) private(t_id)
-    {
-      // Documentation of Intel MIC intrinsics, see:
-      // https://software.intel.com/de-de/node/523533
-      // https://software.intel.com/de-de/node/523387
-      t_id = omp_get_thread_num();
-      DASH_LOG_TRACE("dash::min_element", "starting thread", t_id);
-      min_vals_t[t_id].idx = min_idx_l;
-      min_vals_t[t_id].val = min_val_l;
-      // Cannot use explicit private(min_val_t) as ElementType might
-      // not be default-constructible:
-      #pragma omp for schedule(static)
-      for (int i = 0; i < l_size; i++) {
-        const ElementType & val_t = *(l_range_begin + i);
-        if (compare(val_t, min_vals_t[t_id].val)) {
-          min_vals_t[t_id].val = val_t;
-          min_vals_t[t_id].idx = i;
-        }
-      }
-      DASH_LOG_TRACE("dash::min_element", "local minimum at thread", t_id,
-                     "idx:", min_vals_t[t_id].idx,
-                     "val:", min_vals_t[t_id].val);
-    }
-    min_pos min_pos_l = min_vals_t[0];
-    for (int t = 1; t < n_threads; t++) {
-      const min_pos & mpt = min_vals_t[t];
-      if (compare(mpt.val, min_pos_l.val)) {
-        min_pos_l = mpt;
-      }
+  auto l_size = l_range_end - l_range_begin;
+  DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size);
+  if (l_size <= 0) {
+    return l_range_end;
+  }
+  int n_chunks = dash::internal::execution_threads(
+                   dash::internal::execution_threads(policy), l_size);
+  if (n_chunks <= 1) {
+    return ::std::min_element(l_range_begin, l_range_end, compare);
+  }
+  // Minimum element in every chunk of the local range:
+  std::vector<const ElementType *> chunk_mins(n_chunks);
+  dash::internal::parallel_chunks(n_chunks, l_size,
+    [&](int c, decltype(l_size) begin, decltype(l_size) end) {
+      chunk_mins[c] = ::std::min_element(
+                        l_range_begin + begin, l_range_begin + end, compare);
+    });
+  // Chunks are ordered, prefer the first occurrence of equal values:
+  const ElementType * l_min = chunk_mins[0];
+  for (size_t c = 1; c < chunk_mins.size(); ++c) {
+    if (compare(*chunk_mins[c], *l_min)) {
+      l_min = chunk_mins[c];
     }
-    delete[] min_vals_t_raw;
-    return (l_range_begin + min_pos_l.idx);
   }
-#endif // DASH_ENABLE_OPENMP
-  return ::std::min_element(l_range_begin, l_range_end, compare);
+  return l_min;
 }
 
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
+ * Specialization for local range, elements are compared using the
+ * threads available to the unit.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
  *
- * \tparam      ElementType  Type of the elements in the sequence
- * \tparam      Compare      Binary comparison function with signature
- *                           \c bool (const TypeA &a, const TypeB &b)
+ * \see         dash::execution::par
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class Compare = std::less<const ElementType &> >
+const ElementType * min_element(
+  /// Iterator to the initial position in the sequence
+  const ElementType * l_range_begin,
+  /// Iterator to the final position in the sequence
+  const ElementType * l_range_end,
+  /// Element comparison function, defaults to std::less
+  Compare             compare
+    = std::less<const ElementType &>())
+{
+  return dash::min_element(
+           dash::execution::par, l_range_begin, l_range_end, compare);
+}
+
+/**
+ * Asynchronous variant of \c dash::min_element.
+ * Returns a future for an iterator pointing to the element with the
+ * smallest value in the range [first,last).
  *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * The local minimum is determined as specified by the execution policy
+ * before the function returns, the exchange of the local minima of all
+ * units is not completed before the future is waited for.
+ *
+ * \see dash::min_element
+ * \see dash::execution
  *
  * \ingroup     DashAlgorithms
  */
 template <
+    class ExecutionPolicy,
     typename GlobInputIt,
     class Compare = std::less<
-        const typename dash::iterator_traits<GlobInputIt>::value_type &> >
-GlobInputIt min_element(
+        const typename dash::iterator_traits<GlobInputIt>::value_type &>,
+    typename = typename std::enable_if<
+        dash::is_execution_policy<
+          typename std::decay<ExecutionPolicy>::type>::value &&
+        dash::iterator_traits<GlobInputIt>::is_global_iterator::value
+      >::type >
+dash::Future<GlobInputIt> min_element_async(
+    /// Execution policy of the comparison of local elements
+    ExecutionPolicy && policy,
     /// Iterator to the initial position in the sequence
-    const typename std::enable_if<
-        dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
-        GlobInputIt>::type &first,
+    const GlobInputIt &first,
     /// Iterator to the final position in the sequence
     const GlobInputIt &last,
     /// Element comparison function, defaults to std::less
@@ -166,135 +293,209 @@ GlobInputIt min_element(
   if (first == last) {
     DASH_LOG_DEBUG("dash::min_element >",
                    "empty range, returning last", last);
-    return last;
+    return dash::Future<GlobInputIt>(last);
   }
 
-  dash::util::Trace trace("min_element");
-
-  auto & pattern = first.pattern();
-  auto & team    = pattern.team();
-  DASH_LOG_DEBUG("dash::min_element()",
-                 "allocate minarr, size", team.size());
-  // Global position of end element in range:
-  auto    gi_last            = last.gpos();
-  // Find the local min. element in parallel
-  // Get local address range between global iterators:
-  auto    local_idx_range    = dash::local_index_range(first, last);
-  // Pointer to local minimum element:
-  const   value_t * lmin = nullptr;
-  // Local offset of local minimum element, or -1 if no element found:
-  index_t l_idx_lmin         = -1;
-  if (local_idx_range.begin == local_idx_range.end) {
-    // local range is empty
-    DASH_LOG_DEBUG("dash::min_element", "local range empty");
-  } else {
-    trace.enter_state("local");
-
-    // Pointer to first element in local memory:
-    const value_t * lbegin        = first.globmem().lbegin();
-    // Pointers to first / final element in local range:
-    const value_t * l_range_begin = lbegin + local_idx_range.begin;
-    const value_t * l_range_end   = lbegin + local_idx_range.end;
-
-    lmin = dash::min_element(l_range_begin, l_range_end, compare);
-
-    if (lmin != l_range_end) {
-      DASH_LOG_TRACE_VAR("dash::min_element", *lmin);
-      // Offset of local minimum in local memory:
-      l_idx_lmin = lmin - lbegin;
-    }
-
-    trace.exit_state("local");
-  }
+  static const auto trace_context = dash::util::Trace::state("min_element");
+  static const auto state_local = dash::util::Trace::state("local");
+  dash::util::Trace trace(trace_context);
+
+  auto & team = first.pattern().team();
+  // Find the local min. element in the local elements of the range:
+  trace.enter_state(state_local);
+  auto l_res = dash::internal::min_element_local(
+                 dash::internal::execution_threads(policy),
+                 first, last, compare,
+                 dash::internal::local_order_is_range_order<GlobInputIt>());
+  const value_t * lmin          = l_res.lmin;
+  index_t         l_offset_lmin = l_res.offset;
+  trace.exit_state(state_local);
   DASH_LOG_TRACE("dash::min_element",
-                 "local index of local minimum:", l_idx_lmin);
-  DASH_LOG_TRACE("dash::min_element",
-                 "waiting for local min of other units");
-
-  trace.enter_state("barrier");
-  team.barrier();
-  trace.exit_state("barrier");
+                 "range offset of local minimum:", l_offset_lmin);
 
   typedef struct {
     value_t  value;
-    index_t  g_index;
+    index_t  offset;
   } local_min_t;
 
-  std::vector<local_min_t> local_min_values(team.size());
+  struct min_element_state {
+    local_min_t              local_min;
+    std::vector<local_min_t> local_min_values;
+  };
+
+  auto state = std::make_shared<min_element_state>();
+  state->local_min_values.resize(team.size());
 
-  // Set global index of local minimum to -1 if no local minimum has been
+  // Set range offset of local minimum to -1 if no local minimum has been
   // found:
-  local_min_t local_min;
-  local_min.value   = l_idx_lmin < 0
-                      ? value_t()
-                      : *lmin;
-  local_min.g_index = l_idx_lmin < 0
-                      ? -1
-                      : pattern.global(l_idx_lmin);
+  local_min_t & local_min = state->local_min;
+  local_min.value  = l_offset_lmin < 0
+                     ? value_t()
+                     : *lmin;
+  local_min.offset = l_offset_lmin;
 
   DASH_LOG_TRACE("dash::min_element", "sending local minimum: {",
                  "value:",   local_min.value,
-                 "g.index:", local_min.g_index, "}");
+                 "offset:",  local_min.offset, "}");
 
-  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
-  trace.enter_state("allgather");
+  DASH_LOG_TRACE("dash::min_element", "dart_allgather_handle()");
+  dart_handle_t handle;
   DASH_ASSERT_RETURNS(
-    dart_allgather(
+    dart_allgather_handle(
       &local_min,
-      local_min_values.data(),
+      state->local_min_values.data(),
       sizeof(local_min_t),
       DART_TYPE_BYTE,
-      team.dart_id()),
+      team.dart_id(),
+      &handle),
     DART_OK);
-  trace.exit_state("allgather");
+
+  return dash::internal::collective_future<GlobInputIt>(
+      handle, state,
+      [first, last, compare](const min_element_state & st) {
+    auto const & local_min_values = st.local_min_values;
 
 #ifdef DASH_ENABLE_LOGGING
-  for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
-    auto lmin_entry = local_min_values[lmin_u];
-    DASH_LOG_TRACE("dash::min_element", "dart_allgather >",
-                   "unit:",    lmin_u,
-                   "value:",   lmin_entry.value,
-                   "g_index:", lmin_entry.g_index);
-  }
+    for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
+      auto lmin_entry = local_min_values[lmin_u];
+      DASH_LOG_TRACE("dash::min_element", "dart_allgather >",
+                     "unit:",    lmin_u,
+                     "value:",   lmin_entry.value,
+                     "offset:",  lmin_entry.offset);
+    }
 #endif
 
-  auto gmin_elem_it  = ::std::min_element(
-                           local_min_values.begin(),
-                           local_min_values.end(),
-                           [&](const local_min_t & a,
-                               const local_min_t & b) {
-                             // Ignore elements with global index -1 (no
-                             // element found):
-                             return (b.g_index < 0 ||
-                                     (a.g_index > 0 &&
-                                      compare(a.value, b.value)));
-                           });
-
-  if (gmin_elem_it == local_min_values.end()) {
-    DASH_LOG_DEBUG_VAR("dash::min_element >", last);
-    return last;
-  }
+    auto gmin_elem_it  = ::std::min_element(
+                             local_min_values.begin(),
+                             local_min_values.end(),
+                             [&](const local_min_t & a,
+                                 const local_min_t & b) {
+                               // Ignore elements with offset -1 (no
+                               // element found), prefer the first
+                               // occurrence of equal values:
+                               return (b.offset < 0 ||
+                                       (a.offset >= 0 &&
+                                        (compare(a.value, b.value) ||
+                                         (!compare(b.value, a.value) &&
+                                          a.offset < b.offset))));
+                             });
+
+    if (gmin_elem_it == local_min_values.end()) {
+      DASH_LOG_DEBUG_VAR("dash::min_element >", last);
+      return last;
+    }
 
-  auto gi_minimum    = gmin_elem_it->g_index;
+    auto offset_minimum = gmin_elem_it->offset;
 
-  DASH_LOG_TRACE("dash::min_element",
-                 "min. value:", gmin_elem_it->value,
-                 "at unit:",    (gmin_elem_it - local_min_values.begin()),
-                 "global idx:", gi_minimum);
-
-  DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
-  if (gi_minimum < 0 || gi_minimum == gi_last) {
-    DASH_LOG_DEBUG_VAR("dash::min_element >", last);
-    return last;
-  }
-  // iterator 'first' is relative to start of input range, convert to start
-  // of its referenced container (= container.begin()), then apply global
-  // offset of minimum element:
-  auto minimum = (first - first.gpos()) + gi_minimum;
-  DASH_LOG_DEBUG("dash::min_element >", minimum,
-                 "=", static_cast<value_t>(*minimum));
-
-  return minimum;
+    DASH_LOG_TRACE("dash::min_element",
+                   "min. value:", gmin_elem_it->value,
+                   "at unit:",    (gmin_elem_it - local_min_values.begin()),
+                   "range offset:", offset_minimum);
+
+    if (offset_minimum < 0) {
+      DASH_LOG_DEBUG_VAR("dash::min_element >", last);
+      return last;
+    }
+    auto minimum = first + offset_minimum;
+    DASH_LOG_DEBUG("dash::min_element >", minimum,
+                   "=", static_cast<value_t>(*minimum));
+
+    return minimum;
+  });
+}
+
+/**
+ * Asynchronous variant of \c dash::min_element, local elements are
+ * compared using the threads available to the unit.
+ *
+ * \see dash::min_element
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename GlobInputIt,
+    class Compare = std::less<
+        const typename dash::iterator_traits<GlobInputIt>::value_type &> >
+dash::Future<GlobInputIt> min_element_async(
+    /// Iterator to the initial position in the sequence
+    const typename std::enable_if<
+        dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
+        GlobInputIt>::type &first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt &last,
+    /// Element comparison function, defaults to std::less
+    Compare compare = Compare())
+{
+  return dash::min_element_async(dash::execution::par, first, last, compare);
+}
+
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d * ns) + O(nl), with \c d dimensions in the global
+ *              iterators' pattern, \c ns contiguous segments and \c nl
+ *              local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename GlobInputIt,
+    class Compare = std::less<
+        const typename dash::iterator_traits<GlobInputIt>::value_type &> >
+GlobInputIt min_element(
+    /// Iterator to the initial position in the sequence
+    const typename std::enable_if<
+        dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
+        GlobInputIt>::type &first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt &last,
+    /// Element comparison function, defaults to std::less
+    Compare compare = Compare())
+{
+  return dash::min_element_async(
+           dash::execution::par, first, last, compare).get();
+}
+
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ * Local elements are compared as specified by the execution policy.
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \see         dash::execution
+ * \ingroup     DashAlgorithms
+ */
+template <
+    class ExecutionPolicy,
+    typename GlobInputIt,
+    class Compare = std::less<
+        const typename dash::iterator_traits<GlobInputIt>::value_type &>,
+    typename = typename std::enable_if<
+        dash::is_execution_policy<
+          typename std::decay<ExecutionPolicy>::type>::value &&
+        dash::iterator_traits<GlobInputIt>::is_global_iterator::value
+      >::type >
+GlobInputIt min_element(
+    /// Execution policy of the comparison of local elements
+    ExecutionPolicy && policy,
+    /// Iterator to the initial position in the sequence
+    const GlobInputIt &first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt &last,
+    /// Element comparison function, defaults to std::less
+    Compare compare = Compare())
+{
+  return dash::min_element_async(policy, first, last, compare).get();
 }
 
 /**
@@ -333,7 +534,8 @@ GlobIter<ElementType, PatternType> max_element(
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
- * Specialization for local range, delegates to std::min_element.
+ * Specialization for local range, elements are compared using the
+ * threads available to the unit.
  *
  * \return      An iterator to the first occurrence of the greatest value
  *              in the range, or \c last if the range is empty.
@@ -363,6 +565,78 @@ const ElementType * max_element(
   return dash::min_element(first, last, compare);
 }
 
+/**
+ * Finds an iterator pointing to the element with the greatest value in
+ * the range [first,last).
+ * Local elements are compared as specified by the execution policy.
+ *
+ * \return      An iterator to the first occurrence of the greatest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \see         dash::execution
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class Compare = std::greater<const ElementType &>,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
+GlobIter<ElementType, PatternType> max_element(
+  /// Execution policy of the comparison of local elements
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::greater<const ElementType &>())
+{
+  // Same as min_element with different compare function
+  return dash::min_element(policy, first, last, compare);
+}
+
+/**
+ * Finds an iterator pointing to the element with the greatest value in
+ * the range [first,last).
+ * Specialization for local range, elements are compared as specified by
+ * the execution policy.
+ *
+ * \return      An iterator to the first occurrence of the greatest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \see         dash::execution
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class Compare = std::greater<ElementType &>,
+  typename = typename std::enable_if<
+               dash::is_execution_policy<
+                 typename std::decay<ExecutionPolicy>::type
+               >::value
+             >::type >
+const ElementType * max_element(
+  /// Execution policy of the comparison of local elements
+  ExecutionPolicy  && policy,
+  /// Iterator to the initial position in the sequence
+  const ElementType * first,
+  /// Iterator to the final position in the sequence
+  const ElementType * last,
+  /// Element comparison function, defaults to std::less
+  Compare             compare
+    = std::greater<ElementType &>())
+{
+  // Same as min_element with different compare function
+  return dash::min_element(policy, first, last, compare);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__MIN_MAX_H__
@@ -6,7 +6,9 @@
 #include <dash/Pattern.h>
 #include <dash/Types.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/internal/Gemm.h>
 #include <dash/util/Trace.h>
+#include <dash/util/UnitLocality.h>
 
 #include <utility>
 
@@ -31,11 +33,12 @@ namespace dash {
 
 namespace internal {
 
-#if defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 /**
- * Matrix multiplication for local multiplication of matrix blocks via MKL.
+ * Matrix multiplication for local multiplication of matrix blocks,
+ * computes C += A x B using the built-in cache-blocked kernel.
+ * Specialized for float and double values if MKL or BLAS are available.
  */
-template<typename  ValueType>
+template <typename ValueType>
 void mmult_local(
   /// Matrix to multiply, m rows by k columns.
   const ValueType * A,
@@ -46,47 +49,44 @@ void mmult_local(
   long long         m,
   long long         n,
   long long         k,
-  MemArrange        storage);
-#else
-/**
- * Naive matrix multiplication for local multiplication of matrix blocks,
- * used only for tests and where MKL is not available.
- */
-template <typename ValueType>
-void mmult_local(
-    /// Matrix to multiply, extents n x m
-    const ValueType *A,
-    /// Matrix to multiply, extents m x p
-    const ValueType *B,
-    /// Matrix to contain the multiplication result, extents n x p
-    ValueType *C,
-    long long  m,
-    long long  n,
-    long long  p,
-    MemArrange /*storage*/)
+  MemArrange        storage)
 {
-#ifndef DEBUG
-  DASH_THROW(
-    dash::exception::RuntimeError,
-    "Called fallback implementation of DGEMM (only enabled in Debug)");
+  int n_threads = 1;
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  n_threads = uloc.num_domain_threads();
 #endif
-  ValueType c_sum = 0;
-  for (auto i = 0; i < n; ++i) {
-    // row i = 0...n
-    for (auto j = 0; j < p; ++j) {
-      // column j = 0...p
-      c_sum = C[i * p + j]; // = C[j][i]
-      for (auto k = 0; k < m; ++k) {
-        // k = 0...m
-        auto ik     = i * m + k;
-        auto kj     = k * m + j;
-        auto value  = A[ik] * B[kj];
-        c_sum      += value;
-      }
-      C[i * p + j] = c_sum; // C[j][i] = c_sum
-    }
-  }
+  dash::internal::gemm(A, B, C, m, n, k, storage, n_threads);
 }
+
+#if defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
+/**
+ * Matrix multiplication for local multiplication of matrix blocks via MKL
+ * or BLAS.
+ */
+template<>
+void mmult_local<float>(
+  const float * A,
+  const float * B,
+  float       * C,
+  long long     m,
+  long long     n,
+  long long     k,
+  MemArrange    storage);
+
+/**
+ * Matrix multiplication for local multiplication of matrix blocks via MKL
+ * or BLAS.
+ */
+template<>
+void mmult_local<double>(
+  const double * A,
+  const double * B,
+  double       * C,
+  long long      m,
+  long long      n,
+  long long      k,
+  MemArrange     storage);
 #endif // defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 
 } // namespace internal
@@ -356,9 +356,13 @@ void summa(
                  "unit:",  block_a.begin().lpos().unit,
                  "view:",  block_a.begin().viewspec());
 
-  dash::util::Trace trace("SUMMA");
+  static const auto trace_context = dash::util::Trace::state("SUMMA");
+  static const auto state_prefetch = dash::util::Trace::state("prefetch");
+  static const auto state_multiply = dash::util::Trace::state("multiply");
+  static const auto state_barrier = dash::util::Trace::state("barrier");
+  dash::util::Trace trace(trace_context);
 
-  trace.enter_state("prefetch");
+  trace.enter_state(state_prefetch);
   if (block_a_lptr == nullptr) {
 #ifdef DASH_ALGORITHM_SUMMA_ASYNC_INIT_PREFETCH
     get_a = dash::copy_async(block_a.begin(), block_a.end(),
@@ -407,7 +411,7 @@ void summa(
     get_b.wait();
   }
 #endif
-  trace.exit_state("prefetch");
+  trace.exit_state(state_prefetch);
 
   DASH_LOG_TRACE("dash::summa", "summa.block",
                  "prefetching of blocks completed");
@@ -511,7 +515,7 @@ void summa(
                      "C.local.block.comp:", lb,
                      "view:", l_block_c_comp.begin().viewspec());
 
-      trace.enter_state("multiply");
+      trace.enter_state(state_multiply);
       dash::internal::mmult_local<value_type>(
           local_block_a_comp,
           local_block_b_comp,
@@ -520,7 +524,7 @@ void summa(
           block_size_n,
           block_size_p,
           memory_order);
-      trace.exit_state("multiply");
+      trace.exit_state(state_multiply);
 
       if (local_block_a_comp_bac != nullptr) {
         local_block_a_comp     = local_block_a_comp_bac;
@@ -534,7 +538,7 @@ void summa(
         // -------------------------------------------------------------------
         // Wait for local copies:
         // -------------------------------------------------------------------
-        trace.enter_state("prefetch");
+        trace.enter_state(state_prefetch);
         if (block_a_lptr == nullptr) {
           DASH_LOG_TRACE("dash::summa", "summa.prefetch.block.a.wait",
                          "waiting for prefetching of block A from unit",
@@ -549,7 +553,7 @@ void summa(
         }
         DASH_LOG_TRACE("dash::summa", "summa.prefetch.completed",
                        "local copies of next blocks received");
-        trace.exit_state("prefetch");
+        trace.exit_state(state_prefetch);
 
         // -----------------------------------------------------------------
         // Swap communication and computation buffers:
@@ -582,9 +586,9 @@ void summa(
 #endif
 
   DASH_LOG_TRACE("dash::summa", "waiting for other units");
-  trace.enter_state("barrier");
+  trace.enter_state(state_barrier);
   C.barrier();
-  trace.exit_state("barrier");
+  trace.exit_state(state_barrier);
 
   DASH_LOG_TRACE("dash::summa >", "finished");
 }
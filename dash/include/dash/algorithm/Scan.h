@@ -0,0 +1,520 @@
+#ifndef DASH__ALGORITHM__SCAN_H__
+#define DASH__ALGORITHM__SCAN_H__
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/iterator/IteratorTraits.h>
+
+#include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+
+#include <dash/Exception.h>
+#include <dash/util/Trace.h>
+#include <dash/util/UnitLocality.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+
+namespace internal {
+
+  /**
+   * Identity used as unary operation of scans without transformation.
+   */
+  struct scan_identity {
+    template<typename T>
+    inline const T & operator()(const T & value) const {
+      return value;
+    }
+  };
+
+  /**
+   * Valid partial result of a scan.
+   */
+  template<typename ValueType>
+  inline local_result<ValueType> scan_result(const ValueType & value)
+  {
+    local_result<ValueType> result;
+    result.value = value;
+    result.valid = true;
+    return result;
+  }
+
+  /**
+   * Combines two partial results in iteration order, invalid results are
+   * neutral.
+   */
+  template<typename ValueType, typename BinaryOperation>
+  inline local_result<ValueType> scan_combine(
+    const local_result<ValueType> & lhs,
+    const local_result<ValueType> & rhs,
+    BinaryOperation               & binary_op)
+  {
+    if (!lhs.valid) {
+      return rhs;
+    }
+    if (!rhs.valid) {
+      return lhs;
+    }
+    return scan_result<ValueType>(binary_op(lhs.value, rhs.value));
+  }
+
+  /**
+   * Distributed prefix scan of the global range \c [in_first, in_last)
+   * to the global range starting at \c out_first.
+   *
+   * The scan is performed in three phases:
+   *
+   * 1. Every unit scans its local range in chunks, one chunk per thread,
+   *    and obtains the total of every chunk.
+   * 2. The carry of every unit, the combined totals of all preceding units,
+   *    is obtained from an exclusive prefix reduction (\c dart_exscan) of
+   *    the local totals.
+   * 3. The carry of every chunk is applied to its elements.
+   *
+   * Input and output range must have identical distribution and every
+   * unit must not own more than a single block of the range, so local and
+   * global iteration order of the range are identical.
+   *
+   * The result of elements in the output range is
+   * <tt>binary_op(init, unary_op(in[0]), ..., unary_op(in[i]))</tt> for
+   * inclusive scans and ends at <tt>in[i-1]</tt> for exclusive scans.
+   * An invalid \c init is omitted.
+   */
+  template<
+    typename ValueType,
+    class    GlobInputIt,
+    class    GlobOutputIt,
+    class    BinaryOperation,
+    class    UnaryOperation >
+  GlobOutputIt scan(
+    GlobInputIt                     in_first,
+    GlobInputIt                     in_last,
+    GlobOutputIt                    out_first,
+    BinaryOperation                 binary_op,
+    UnaryOperation                  unary_op,
+    const local_result<ValueType> & init,
+    bool                            exclusive)
+  {
+    using local_result_t = struct local_result<ValueType>;
+
+    DASH_LOG_DEBUG("dash::internal::scan()", "exclusive:", exclusive);
+
+    const auto & pattern = in_first.pattern();
+    auto       & team    = pattern.team();
+
+    static_assert(
+      std::decay<decltype(pattern)>::type::ndim() == 1,
+      "dash::scan is only implemented for one-dimensional ranges");
+
+    if (pattern.blockspec().size() > team.size()) {
+      DASH_THROW(
+        dash::exception::NotImplemented,
+        "dash::scan is only implemented for distributions with at most "
+        "one block per unit");
+    }
+    if (!(pattern == out_first.pattern()) ||
+        in_first.pos() != out_first.pos()) {
+      DASH_THROW(
+        dash::exception::NotImplemented,
+        "dash::scan is only implemented for input- and output ranges with "
+        "identical distribution");
+    }
+
+    static const auto trace_context = dash::util::Trace::state("scan");
+    static const auto state_local_scan = dash::util::Trace::state("local_scan");
+    static const auto state_exscan = dash::util::Trace::state("exscan");
+    static const auto state_fixup = dash::util::Trace::state("fixup");
+    dash::util::Trace trace(trace_context);
+
+    auto const n_gvalues = dash::distance(in_first, in_last);
+    auto       out_last  = out_first + n_gvalues;
+
+    auto in_range   = dash::local_range(in_first, in_last);
+    auto out_range  = dash::local_range(out_first, out_last);
+    auto l_in       = in_range.begin;
+    auto l_out      = out_range.begin;
+    auto const l_size = static_cast<size_t>(in_range.end - in_range.begin);
+
+    DASH_LOG_TRACE("dash::internal::scan", "local elements:", l_size);
+
+    // Phase 1: scan of local chunks
+    //
+    int n_chunks = 1;
+#ifdef DASH_ENABLE_OPENMP
+    dash::util::UnitLocality uloc;
+    n_chunks = uloc.num_domain_threads();
+    // Parallel scan does not pay off for small ranges:
+    static const size_t min_elements_per_thread = 4096;
+    if (n_chunks > static_cast<int>(l_size / min_elements_per_thread)) {
+      n_chunks = static_cast<int>(l_size / min_elements_per_thread);
+    }
+    if (n_chunks < 1) {
+      n_chunks = 1;
+    }
+    DASH_LOG_TRACE("dash::internal::scan", "threads:", n_chunks);
+#endif
+    std::vector<local_result_t> chunk_totals(n_chunks);
+
+    trace.enter_state(state_local_scan);
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for num_threads(n_chunks) schedule(static, 1)
+#endif
+    for (int c = 0; c < n_chunks; ++c) {
+      auto const c_begin = (l_size * c) / n_chunks;
+      auto const c_end   = (l_size * (c + 1)) / n_chunks;
+      if (c_begin == c_end) {
+        continue;
+      }
+      ValueType acc = unary_op(l_in[c_begin]);
+      if (exclusive) {
+        // The first result of the chunk is its carry, assigned in the
+        // final phase. Input values are read before the output value is
+        // written to allow in-place scans:
+        for (auto i = c_begin + 1; i < c_end; ++i) {
+          ValueType value = unary_op(l_in[i]);
+          l_out[i] = acc;
+          acc      = binary_op(acc, value);
+        }
+      } else {
+        l_out[c_begin] = acc;
+        for (auto i = c_begin + 1; i < c_end; ++i) {
+          acc      = binary_op(acc, unary_op(l_in[i]));
+          l_out[i] = acc;
+        }
+      }
+      chunk_totals[c] = scan_result(acc);
+    }
+    trace.exit_state(state_local_scan);
+
+    // Phase 2: carry of units
+    //
+    local_result_t l_total;
+    for (auto const & chunk_total : chunk_totals) {
+      l_total = scan_combine(l_total, chunk_total, binary_op);
+    }
+
+    trace.enter_state(state_exscan);
+    dart_datatype_t  dtype;
+    dart_operation_t dop;
+    // Units with empty local range have no valid total, a custom reduction
+    // operation is required:
+    DASH_ASSERT_RETURNS(
+      dart_type_create_custom(sizeof(local_result_t), &dtype),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_op_create(
+        &dash::internal::accumulate_custom_fn<ValueType, BinaryOperation>,
+        &binary_op, false, dtype, true, &dop),
+      DART_OK);
+    local_result_t carry;
+    DASH_ASSERT_RETURNS(
+      dart_exscan(&l_total, &carry, 1, dtype, dop, team.dart_id()),
+      DART_OK);
+    dart_op_destroy(&dop);
+    dart_type_destroy(&dtype);
+    trace.exit_state(state_exscan);
+
+    if (team.myid() == 0) {
+      // Result of exclusive prefix reduction is undefined on first unit:
+      carry = local_result_t();
+    }
+    carry = scan_combine(init, carry, binary_op);
+
+    // Phase 3: apply carry of chunks
+    //
+    std::vector<local_result_t> chunk_carries(n_chunks);
+    for (int c = 0; c < n_chunks; ++c) {
+      chunk_carries[c] = carry;
+      carry            = scan_combine(carry, chunk_totals[c], binary_op);
+    }
+
+    trace.enter_state(state_fixup);
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for num_threads(n_chunks) schedule(static, 1)
+#endif
+    for (int c = 0; c < n_chunks; ++c) {
+      auto const c_begin = (l_size * c) / n_chunks;
+      auto const c_end   = (l_size * (c + 1)) / n_chunks;
+      auto const & c_carry = chunk_carries[c];
+      if (c_begin == c_end || !c_carry.valid) {
+        continue;
+      }
+      auto i = c_begin;
+      if (exclusive) {
+        l_out[i++] = c_carry.value;
+      }
+      for (; i < c_end; ++i) {
+        l_out[i] = binary_op(c_carry.value, l_out[i]);
+      }
+    }
+    trace.exit_state(state_fixup);
+
+    DASH_LOG_DEBUG("dash::internal::scan >");
+    return out_last;
+  }
+
+} // namespace internal
+
+/**
+ * Computes the inclusive prefix reduction of the global range
+ * \c [in_first, in_last) using the associative binary operation
+ * \c binary_op and writes the results to the global range starting at
+ * \c out_first.
+ *
+ * The i-th element in the output range is assigned
+ * <tt>binary_op(in[0], ..., in[i])</tt>. The binary operation is applied
+ * in iteration order and is not required to be commutative.
+ *
+ * Input and output range must have identical distribution, the output
+ * range may be identical to the input range.
+ * Distributions with more than a single block per unit are not supported.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Global iterator describing the beginning of the range
+ *                  to scan.
+ * \param in_last   Global iterator describing the end of the range to scan.
+ * \param out_first Global iterator describing the beginning of the output
+ *                  range.
+ * \param binary_op The associative binary operation to apply
+ *                  (default: using \c operator+).
+ *
+ * \returns  Global iterator past the last element in the output range.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation = dash::plus<
+                            typename dash::iterator_traits<
+                              GlobInputIt>::value_type>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+GlobOutputIt inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op = BinaryOperation())
+{
+  typedef typename dash::iterator_traits<GlobInputIt>::value_type
+    value_t;
+  return dash::internal::scan<value_t>(
+           in_first, in_last, out_first,
+           binary_op, dash::internal::scan_identity(),
+           dash::internal::local_result<value_t>(),
+           false);
+}
+
+/**
+ * Computes the inclusive prefix reduction of the global range
+ * \c [in_first, in_last) using the associative binary operation
+ * \c binary_op, starting from \c init.
+ *
+ * The i-th element in the output range is assigned
+ * <tt>binary_op(init, in[0], ..., in[i])</tt>.
+ *
+ * Collective operation.
+ *
+ * \see dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class ValueType,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+GlobOutputIt inclusive_scan(
+  GlobInputIt       in_first,
+  GlobInputIt       in_last,
+  GlobOutputIt      out_first,
+  BinaryOperation   binary_op,
+  const ValueType & init)
+{
+  return dash::internal::scan<ValueType>(
+           in_first, in_last, out_first,
+           binary_op, dash::internal::scan_identity(),
+           dash::internal::scan_result<ValueType>(init),
+           false);
+}
+
+/**
+ * Computes the exclusive prefix reduction of the global range
+ * \c [in_first, in_last) using the associative binary operation
+ * \c binary_op, starting from \c init, and writes the results to the
+ * global range starting at \c out_first.
+ *
+ * The i-th element in the output range is assigned
+ * <tt>binary_op(init, in[0], ..., in[i-1])</tt>, the first element is
+ * assigned \c init.
+ *
+ * Input and output range must have identical distribution, the output
+ * range may be identical to the input range.
+ * Distributions with more than a single block per unit are not supported.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Global iterator describing the beginning of the range
+ *                  to scan.
+ * \param in_last   Global iterator describing the end of the range to scan.
+ * \param out_first Global iterator describing the beginning of the output
+ *                  range.
+ * \param init      The initial value of the prefix reduction.
+ * \param binary_op The associative binary operation to apply
+ *                  (default: using \c operator+).
+ *
+ * \returns  Global iterator past the last element in the output range.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+GlobOutputIt exclusive_scan(
+  GlobInputIt       in_first,
+  GlobInputIt       in_last,
+  GlobOutputIt      out_first,
+  const ValueType & init,
+  BinaryOperation   binary_op = BinaryOperation())
+{
+  return dash::internal::scan<ValueType>(
+           in_first, in_last, out_first,
+           binary_op, dash::internal::scan_identity(),
+           dash::internal::scan_result<ValueType>(init),
+           true);
+}
+
+/**
+ * Computes the inclusive prefix reduction of the values obtained from
+ * applying \c unary_op to the elements in the global range
+ * \c [in_first, in_last).
+ *
+ * The i-th element in the output range is assigned
+ * <tt>binary_op(unary_op(in[0]), ..., unary_op(in[i]))</tt>.
+ *
+ * Collective operation.
+ *
+ * \see dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class UnaryOperation,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+GlobOutputIt transform_inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op,
+  UnaryOperation  unary_op)
+{
+  typedef typename dash::iterator_traits<GlobOutputIt>::value_type
+    value_t;
+  return dash::internal::scan<value_t>(
+           in_first, in_last, out_first,
+           binary_op, unary_op,
+           dash::internal::local_result<value_t>(),
+           false);
+}
+
+/**
+ * Computes the inclusive prefix reduction of the values obtained from
+ * applying \c unary_op to the elements in the global range
+ * \c [in_first, in_last), starting from \c init.
+ *
+ * Collective operation.
+ *
+ * \see dash::transform_inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class UnaryOperation,
+  class ValueType,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+GlobOutputIt transform_inclusive_scan(
+  GlobInputIt       in_first,
+  GlobInputIt       in_last,
+  GlobOutputIt      out_first,
+  BinaryOperation   binary_op,
+  UnaryOperation    unary_op,
+  const ValueType & init)
+{
+  return dash::internal::scan<ValueType>(
+           in_first, in_last, out_first,
+           binary_op, unary_op,
+           dash::internal::scan_result<ValueType>(init),
+           false);
+}
+
+/**
+ * Computes the exclusive prefix reduction of the values obtained from
+ * applying \c unary_op to the elements in the global range
+ * \c [in_first, in_last), starting from \c init.
+ *
+ * The i-th element in the output range is assigned
+ * <tt>binary_op(init, unary_op(in[0]), ..., unary_op(in[i-1]))</tt>.
+ *
+ * Collective operation.
+ *
+ * \see dash::exclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+GlobOutputIt transform_exclusive_scan(
+  GlobInputIt       in_first,
+  GlobInputIt       in_last,
+  GlobOutputIt      out_first,
+  const ValueType & init,
+  BinaryOperation   binary_op,
+  UnaryOperation    unary_op)
+{
+  return dash::internal::scan<ValueType>(
+           in_first, in_last, out_first,
+           binary_op, unary_op,
+           dash::internal::scan_result<ValueType>(init),
+           true);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__
@@ -19,9 +19,11 @@
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
+#include <dash/algorithm/internal/Merge.h>
 
 #include <dash/internal/Logging.h>
 #include <dash/util/Trace.h>
+#include <dash/util/UnitLocality.h>
 
 namespace dash {
 
@@ -87,13 +89,6 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
 
 #else
 
-#define IDX_DIST(nunits) ((nunits)*0)
-#define IDX_SUPP(nunits) ((nunits)*1)
-#define IDX_TARGET_DISP(nunits) ((nunits)*2)
-
-#define IDX_SEND_COUNT(nunits) IDX_DIST(nunits)
-#define IDX_TARGET_COUNT(nunits) IDX_SUPP(nunits)
-
 #define NLT_NLE_BLOCK 2
 
 namespace detail {
@@ -243,148 +238,69 @@ psort__local_histogram(
   return std::make_pair(std::move(n_lt), std::move(n_le));
 }
 
-template <typename GlobIter>
+/**
+ * Reduces the local histograms of all units to the global histogram.
+ *
+ * The number of elements less than and less than equals the partition
+ * border right of unit \c u are stored at offset <tt>u * NLT_NLE_BLOCK</tt>
+ * in \c g_nlt_nle.
+ */
 inline void psort__global_histogram(
     std::vector<size_t> const& l_nlt,
     std::vector<size_t> const& l_nle,
     std::vector<size_t> const& valid_partitions,
-    GlobIter                   it_nlt_nle)
+    std::vector<size_t>&       g_nlt_nle,
+    dash::Team const&          team)
 {
   DASH_LOG_TRACE("< psort__global_histogram ");
   DASH_ASSERT_EQ(l_nlt.size(), l_nle.size(), "Sizes must match");
 
-  auto const& team = it_nlt_nle.pattern().team();
-  auto const  myid = team.myid();
-
-  auto liter_begin = (it_nlt_nle + (myid.id * NLT_NLE_BLOCK)).local();
-
-  DASH_ASSERT_MSG(liter_begin, "pointer must not be NULL");
-
-  std::fill(liter_begin, liter_begin + NLT_NLE_BLOCK, 0);
-
-  team.barrier();
+  std::fill(g_nlt_nle.begin(), g_nlt_nle.end(), 0);
 
   auto const last_valid_border = *std::prev(valid_partitions.cend());
 
-  // TODO(kowalewski): implement dash::transform_async
   // We have to add 2
   // --> +1 because we start at idx 1
   // --> +1 to get the last idx
+  //
+  // Histogram values right of the last valid border are not required.
+  auto const nvalues = (last_valid_border + 1) * NLT_NLE_BLOCK;
 
-  bool has_pending_op = false;
+  std::vector<size_t> l_nlt_nle(nvalues);
 
   for (std::size_t idx = 1; idx < last_valid_border + 2; ++idx) {
-    // we communicate only non-zero values
-    if (l_nlt[idx] == 0 && l_nle[idx] == 0) {
-      continue;
-    }
-
-    std::array<size_t, NLT_NLE_BLOCK> vals{{l_nlt[idx], l_nle[idx]}};
-    auto const                        g_idx_nlt = (idx - 1) * NLT_NLE_BLOCK;
-
-    DASH_ASSERT_RETURNS(
-        dart_accumulate(
-            // dart pointer to first element in target range
-            (it_nlt_nle + g_idx_nlt).dart_gptr(),
-            // values
-            &*(std::begin(vals)),
-            // nvalues
-            NLT_NLE_BLOCK,
-            // dart type
-            dash::dart_datatype<size_t>::value,
-            // dart op
-            dash::plus<size_t>().dart_operation()),
-        DART_OK);
-
-    has_pending_op = true;
+    auto const g_idx_nlt     = (idx - 1) * NLT_NLE_BLOCK;
+    l_nlt_nle[g_idx_nlt]     = l_nlt[idx];
+    l_nlt_nle[g_idx_nlt + 1] = l_nle[idx];
   }
 
-  // flush all outstanding dart_accumulate operations...
-  if (has_pending_op) {
-    DASH_ASSERT_RETURNS(dart_flush_all(it_nlt_nle.dart_gptr()), DART_OK);
-  }
+  DASH_ASSERT_RETURNS(
+      dart_allreduce(
+          l_nlt_nle.data(),
+          g_nlt_nle.data(),
+          nvalues,
+          dash::dart_datatype<size_t>::value,
+          DART_OP_SUM,
+          team.dart_id()),
+      DART_OK);
 
-  team.barrier();
   DASH_LOG_TRACE("psort__global_histogram >");
 }
 
-template <typename ElementType, typename GlobIter>
+template <typename ElementType>
 bool psort__validate_partitions(
     UnitInfo const&                 p_unit_info,
     std::vector<ElementType> const& partitions,
     std::vector<size_t> const&      valid_partitions,
     PartitionBorder<ElementType>&   p_borders,
-    GlobIter                        it_g_nlt_nle)
+    std::vector<size_t> const&      g_nlt_nle)
 {
   DASH_LOG_TRACE("< psort__validate_partitions");
-  using value_t = typename GlobIter::value_type;
-  using index_t = typename GlobIter::index_type;
 
   if (valid_partitions.empty()) {
     return true;
   }
 
-  auto const nunits = it_g_nlt_nle.pattern().team().size();
-  auto const myid   = it_g_nlt_nle.pattern().team().myid();
-
-  //
-  // The first two elements are always 0
-  std::vector<value_t> l_nlt_nle(NLT_NLE_BLOCK * nunits, 0);
-  auto                 l_nlt_nle_data = l_nlt_nle.data();
-
-  // TODO(kowalewski): dash::copy does not work with BLOCKCYCLIC patterns.
-  // TODO(kowalewski): add unit test and create issue
-  //
-  // For this reason we explicitly use handles instead of dash::copy_async.
-  // Moreover it is faster since dash::copy makes a lot of pattern stuff and
-  // we definitely know what we are doing here.
-  std::vector<dart_handle_t> handles{};
-
-  std::transform(
-      p_unit_info.valid_remote_partitions.begin(),
-      p_unit_info.valid_remote_partitions.end(),
-      std::back_inserter(handles),
-      [it_g_nlt_nle, l_nlt_nle_data](std::size_t p) {
-        // All elements in input range are remote
-        index_t lidx      = p * NLT_NLE_BLOCK;
-        auto    src_begin = it_g_nlt_nle + lidx;
-
-        dart_handle_t handle;
-        dash::internal::get_handle(
-            src_begin.dart_gptr(),
-            l_nlt_nle_data + lidx,
-            NLT_NLE_BLOCK,
-            &handle);
-        return handle;
-      });
-
-  DASH_ASSERT_EQ(
-      handles.size(),
-      p_unit_info.valid_remote_partitions.size(),
-      "invalid size of handles vector");
-
-  auto const last_p   = p_unit_info.valid_remote_partitions.back();
-  auto       out_last = l_nlt_nle_data + last_p * NLT_NLE_BLOCK;
-
-  // copy local portion
-  index_t lidx      = myid * NLT_NLE_BLOCK;
-  auto    cpy_begin = it_g_nlt_nle + lidx;
-  auto    lbegin    = cpy_begin.local();
-  std::copy(lbegin, lbegin + NLT_NLE_BLOCK, l_nlt_nle_data + lidx);
-
-  // wait for all copies
-  if (!handles.empty()) {
-    if (dart_waitall_local(handles.data(), handles.size()) != DART_OK) {
-      DASH_LOG_ERROR(
-          "dash::detail::psort_validate_partitions [Future]",
-          "  dart_waitall_local failed");
-      DASH_THROW(
-          dash::exception::RuntimeError,
-          "dash::detail::psort_validate_partitions [Future]: "
-          "dart_waitall_local failed");
-    }
-  }
-
   auto const& acc_partition_count = p_unit_info.acc_partition_count;
 
   for (auto const& border_idx : valid_partitions) {
@@ -393,12 +309,12 @@ bool psort__validate_partitions(
 
     auto const peer_idx = p_left + 1;
 
-    if (l_nlt_nle[nlt_idx] < acc_partition_count[peer_idx] &&
-        acc_partition_count[peer_idx] <= l_nlt_nle[nlt_idx + 1]) {
+    if (g_nlt_nle[nlt_idx] < acc_partition_count[peer_idx] &&
+        acc_partition_count[peer_idx] <= g_nlt_nle[nlt_idx + 1]) {
       p_borders.is_stable[border_idx] = true;
     }
     else {
-      if (l_nlt_nle[nlt_idx] >= acc_partition_count[peer_idx]) {
+      if (g_nlt_nle[nlt_idx] >= acc_partition_count[peer_idx]) {
         p_borders.upper_bound[border_idx] = partitions[border_idx];
       }
       else {
@@ -416,10 +332,11 @@ bool psort__validate_partitions(
   return nonstable_it == p_borders.is_stable.cend();
 }
 
-template <class LocalArrayT>
 inline void psort__calc_final_partition_dist(
     std::vector<size_t> const& acc_partition_count,
-    LocalArrayT&               l_partition_dist)
+    dash::team_unit_t          myid,
+    std::vector<size_t> const& l_partition_supp,
+    std::vector<size_t>&       l_partition_dist)
 {
   /* Calculate number of elements to receive for each partition:
    * We first assume that we we receive exactly the number of elements which
@@ -428,10 +345,9 @@ inline void psort__calc_final_partition_dist(
    */
   DASH_LOG_TRACE("< psort__calc_final_partition_dist");
 
-  auto const myid       = l_partition_dist.pattern().team().myid();
-  auto const nunits     = l_partition_dist.pattern().team().size();
-  auto const supp_begin = l_partition_dist.begin() + IDX_SUPP(nunits);
-  auto       dist_begin = l_partition_dist.begin() + IDX_DIST(nunits);
+  auto const nunits     = l_partition_dist.size();
+  auto const supp_begin = l_partition_supp.begin();
+  auto       dist_begin = l_partition_dist.begin();
 
   auto const n_my_elements = std::accumulate(
       dist_begin, dist_begin + nunits, static_cast<size_t>(0));
@@ -458,22 +374,27 @@ inline void psort__calc_final_partition_dist(
   DASH_LOG_TRACE("psort__calc_final_partition_dist >");
 }
 
-template <typename LocalArrayT, typename ElementType>
+/**
+ * Calculates the number of elements to send to every unit from the end
+ * offsets of the partitions in the local range.
+ */
+template <typename ElementType>
 inline void psort__calc_send_count(
     PartitionBorder<ElementType> const& p_borders,
     std::vector<size_t> const&          valid_partitions,
-    LocalArrayT&                        partition_dist)
+    std::vector<size_t>&                target_count,
+    std::vector<size_t>&                send_count)
 {
-  using value_t = typename LocalArrayT::value_type;
+  using value_t = size_t;
   DASH_LOG_TRACE("< psort__calc_send_count");
 
-  auto const           nunits = partition_dist.pattern().team().size();
+  auto const           nunits = target_count.size();
   std::vector<value_t> tmp_target_count(nunits + 1);
 
   tmp_target_count[0] = 0;
 
-  auto l_target_count = &(partition_dist[IDX_TARGET_COUNT(nunits)]);
-  auto l_send_count   = &(partition_dist[IDX_SEND_COUNT(nunits)]);
+  auto l_target_count = target_count.data();
+  auto l_send_count   = send_count.data();
 
   auto const last_skipped = p_borders.is_skipped.cend();
   auto       it_skipped =
@@ -515,52 +436,57 @@ inline void psort__calc_send_count(
   DASH_LOG_TRACE("psort__calc_send_count >");
 }
 
-template <typename ElementType>
-inline void psort__calc_target_displs(
-    PartitionBorder<ElementType> const& p_borders,
-    std::vector<size_t> const&          valid_partitions,
-    dash::Array<size_t>&                g_partition_data)
+template <typename ElementType, typename SortCompT>
+inline void psort__merge_local_sequences(
+    ElementType*               lbegin,
+    ElementType*               lend,
+    std::vector<size_t> const& recv_displs,
+    std::vector<ElementType>&  buffer,
+    SortCompT                  sort_comp)
 {
-  DASH_LOG_TRACE("< psort__calc_target_displs");
-  auto const nunits = g_partition_data.team().size();
-  auto const myid   = g_partition_data.team().myid();
+  DASH_LOG_TRACE("< psort__merge_local_sequences");
 
-  auto l_target_displs = &(g_partition_data.local[IDX_TARGET_DISP(nunits)]);
+  auto const n_l_elem = static_cast<size_t>(std::distance(lbegin, lend));
 
-  if (0 == myid) {
-    // Unit 0 always writes to target offset 0
-    std::fill(l_target_displs, l_target_displs + nunits, 0);
-  }
+  // Units send their partitions in ascending order of their unit ids, so
+  // the received sequences are adjacent and sorted by their displacements.
+  // Units which do not send anything have an empty sequence.
+  std::vector<size_t> seq_borders(recv_displs);
+  seq_borders.push_back(0);
+  seq_borders.push_back(n_l_elem);
+  std::sort(seq_borders.begin(), seq_borders.end());
+  seq_borders.erase(
+      std::unique(seq_borders.begin(), seq_borders.end()), seq_borders.end());
 
-  std::vector<size_t> target_displs(nunits, 0);
+  std::vector<std::pair<ElementType*, ElementType*>> seqs;
+  seqs.reserve(seq_borders.size() - 1);
 
-  auto const u_blocksize = g_partition_data.lsize();
+  for (std::size_t idx = 1; idx < seq_borders.size(); ++idx) {
+    seqs.emplace_back(lbegin + seq_borders[idx - 1], lbegin + seq_borders[idx]);
+  }
 
-  for (auto const& border_idx : valid_partitions) {
-    auto const     left_u  = p_borders.left_partition[border_idx];
-    auto const     right_u = border_idx + 1;
-    size_t const val =
-        (left_u == myid)
-            ? g_partition_data.local[left_u + IDX_SEND_COUNT(nunits)]
-            : g_partition_data
-                  [left_u * u_blocksize + myid + IDX_SEND_COUNT(nunits)];
-    target_displs[right_u] = val + target_displs[left_u];
-
-    if (right_u == myid) {
-      // we are local
-      g_partition_data.local[IDX_TARGET_DISP(nunits) + myid] =
-          target_displs[right_u];
-    }
-    else {
-      auto const target_offset =
-          right_u * u_blocksize + myid + IDX_TARGET_DISP(nunits);
+  DASH_LOG_TRACE_VAR("psort__merge_local_sequences", seqs.size());
 
-      g_partition_data.async[target_offset].set(&(target_displs[right_u]));
-    }
+  if (seqs.size() < 2) {
+    DASH_LOG_TRACE("psort__merge_local_sequences >");
+    return;
   }
 
-  DASH_LOG_TRACE("psort__calc_target_displs >");
-  g_partition_data.async.flush();
+  DASH_ASSERT_GE(buffer.size(), n_l_elem, "merge buffer too small");
+
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  auto const n_threads = uloc.num_domain_threads();
+#else
+  auto const n_threads = 1;
+#endif
+
+  dash::internal::merge_sorted_runs(
+      seqs, buffer.begin(), sort_comp, n_threads);
+
+  std::move(buffer.begin(), buffer.begin() + n_l_elem, lbegin);
+
+  DASH_LOG_TRACE("psort__merge_local_sequences >");
 }
 
 template <typename GlobIterT>
@@ -747,7 +673,38 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   auto pattern = begin.pattern();
 
-  dash::util::Trace trace("Sort");
+  static const auto trace_context = dash::util::Trace::state("Sort");
+  static const auto state_final_local_sort =
+    dash::util::Trace::state("final_local_sort");
+  static const auto state_empty_range_barrier =
+    dash::util::Trace::state("final_barrier");
+  static const auto state_initial_local_sort =
+    dash::util::Trace::state("1:initial_local_sort");
+  static const auto state_init_temporary_global_data =
+    dash::util::Trace::state("2:init_temporary_global_data");
+  static const auto state_init_temporary_local_data =
+    dash::util::Trace::state("3:init_temporary_local_data");
+  static const auto state_find_global_partition_borders =
+    dash::util::Trace::state("4:find_global_partition_borders");
+  static const auto state_final_local_histogram =
+    dash::util::Trace::state("5:final_local_histogram");
+  static const auto state_transpose_local_histograms =
+    dash::util::Trace::state("6:transpose_local_histograms (all-to-all)");
+  static const auto state_calc_final_partition_dist =
+    dash::util::Trace::state("7:calc_final_partition_dist");
+  static const auto state_transpose_final_partition_dist =
+    dash::util::Trace::state("8:transpose_final_partition_dist (all-to-all)");
+  static const auto state_calc_final_send_count =
+    dash::util::Trace::state("9:calc_final_send_count");
+  static const auto state_calc_final_recv_displs =
+    dash::util::Trace::state("10:calc_final_recv_displs (all-to-all)");
+  static const auto state_exchange_data =
+    dash::util::Trace::state("11:exchange_data (all-to-all)");
+  static const auto state_merge_local_sequences =
+    dash::util::Trace::state("12:merge_local_sequences");
+  static const auto state_final_barrier =
+    dash::util::Trace::state("13:final_barrier");
+  dash::util::Trace trace(trace_context);
 
   if (pattern.team() == dash::Team::Null()) {
     DASH_LOG_TRACE("dash::sort", "Sorting on dash::Team::Null()");
@@ -755,17 +712,17 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   }
   if (pattern.team().size() == 1) {
     DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
-    trace.enter_state("final_local_sort");
+    trace.enter_state(state_final_local_sort);
     std::sort(begin.local(), end.local());
-    trace.exit_state("final_local_sort");
+    trace.exit_state(state_final_local_sort);
     return;
   }
 
   if (begin >= end) {
     DASH_LOG_TRACE("dash::sort", "empty range");
-    trace.enter_state("final_barrier");
+    trace.enter_state(state_empty_range_barrier);
     pattern.team().barrier();
-    trace.exit_state("final_barrier");
+    trace.exit_state(state_empty_range_barrier);
     return;
   }
 
@@ -773,8 +730,6 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   auto const  nunits = team.size();
   auto const  myid   = team.myid();
 
-  auto const unit_at_begin = pattern.unit_at(begin.pos());
-
   // local distance
   auto const l_range = dash::local_index_range(begin, end);
 
@@ -791,28 +746,17 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   };
 
   // initial local_sort
-  trace.enter_state("1:initial_local_sort");
+  trace.enter_state(state_initial_local_sort);
   std::sort(lbegin, lend, sort_comp);
-  trace.exit_state("1:initial_local_sort");
+  trace.exit_state(state_initial_local_sort);
 
-  trace.enter_state("2:init_temporary_global_data");
+  trace.enter_state(state_init_temporary_global_data);
 
   auto const lmin = (n_l_elem > 0) ? sortable_hash(*lbegin)
                                    : std::numeric_limits<mapped_type>::max();
   auto const lmax = (n_l_elem > 0) ? sortable_hash(*(lend - 1))
                                    : std::numeric_limits<mapped_type>::min();
 
-  using array_t = dash::Array<std::size_t>;
-
-  std::size_t gsize = nunits * NLT_NLE_BLOCK * 2;
-
-  // implicit barrier...
-  array_t g_nlt_nle(gsize, dash::BLOCKCYCLIC(NLT_NLE_BLOCK), team);
-
-  // another implicit barrier...
-  array_t g_partition_data(nunits * nunits * 3, dash::BLOCKED, team);
-  std::fill(g_partition_data.lbegin(), g_partition_data.lend(), 0);
-
   mapped_type min, max;
 
   DASH_ASSERT_RETURNS(
@@ -844,9 +788,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     return;
   }
 
-  trace.exit_state("2:init_temporary_global_data");
+  trace.exit_state(state_init_temporary_global_data);
 
-  trace.enter_state("3:init_temporary_local_data");
+  trace.enter_state(state_init_temporary_local_data);
 
   auto const p_unit_info =
       detail::psort__find_partition_borders(pattern, begin, end);
@@ -868,8 +812,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   bool done = false;
 
-  auto it_global_histo  = g_nlt_nle.begin();
-  auto tmp_global_histo = it_global_histo + NLT_NLE_BLOCK * nunits;
+  // Global histogram of the number of elements less than and less than
+  // equals the partition borders
+  std::vector<size_t> g_nlt_nle(NLT_NLE_BLOCK * nunits, 0);
 
   // collect all valid partitions in a temporary vector
   std::vector<size_t> valid_partitions;
@@ -896,12 +841,13 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     return;
   }
 
-  // Temporary local buffer (sorted);
-  std::vector<value_type> const lcopy(lbegin, lend);
+  // Temporary local buffer (sorted), reused as merge buffer after the data
+  // exchange
+  std::vector<value_type> lcopy(lbegin, lend);
 
-  trace.exit_state("3:init_temporary_local_data");
+  trace.exit_state(state_init_temporary_local_data);
 
-  trace.enter_state("4:find_global_partition_borders");
+  trace.enter_state(state_find_global_partition_borders);
 
   size_t iter = 0;
 
@@ -926,35 +872,24 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     DASH_LOG_TRACE_RANGE("local histogram nle", l_nle.begin(), l_nle.end());
 
     detail::psort__global_histogram(
-        l_nlt, l_nle, valid_partitions, it_global_histo);
+        l_nlt, l_nle, valid_partitions, g_nlt_nle, team);
 
     DASH_LOG_TRACE_RANGE(
-        "global histogram",
-        (it_global_histo + (myid * NLT_NLE_BLOCK)).local(),
-        (it_global_histo + (myid * NLT_NLE_BLOCK)).local() + NLT_NLE_BLOCK);
+        "global histogram", g_nlt_nle.begin(), g_nlt_nle.end());
 
     done = detail::psort__validate_partitions(
-        p_unit_info,
-        partitions,
-        valid_partitions,
-        p_borders,
-        it_global_histo);
-
-    // This swap eliminates a barrier as, otherwise, some units may be one
-    // iteration ahead and modify shared data while the others are still not
-    // done
-    std::swap(it_global_histo, tmp_global_histo);
+        p_unit_info, partitions, valid_partitions, p_borders, g_nlt_nle);
 
   } while (!done);
 
-  trace.exit_state("4:find_global_partition_borders");
+  trace.exit_state(state_find_global_partition_borders);
 
   DASH_LOG_TRACE_VAR("partition borders found after N iterations", iter);
 
-  trace.enter_state("5:final_local_histogram");
+  trace.enter_state(state_final_local_histogram);
   auto histograms = detail::psort__local_histogram(
       partitions, valid_partitions, p_borders, lbegin, lend, sortable_hash);
-  trace.exit_state("5:final_local_histogram");
+  trace.exit_state(state_final_local_histogram);
 
   /* How many elements are less than P
    * or less than equals P */
@@ -971,149 +906,90 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   DASH_LOG_TRACE_RANGE("final histograms: l_nlt", l_nlt.begin(), l_nlt.end());
   DASH_LOG_TRACE_RANGE("final histograms: l_nle", l_nle.begin(), l_nle.end());
 
-  trace.enter_state("6:transpose_local_histograms (all-to-all)");
-  if (n_l_elem > 0) {
-    // TODO(kowalewski): minimize communication to copy only until the last
-    // valid border
-    /*
-     * Transpose (Shuffle) the final histograms to communicate
-     * the partition distribution
-     */
-    for (std::size_t idx = 1; idx < l_nlt.size(); ++idx) {
-      auto const transposed_unit = idx - 1;
-
-      if (transposed_unit != myid) {
-        auto const offset = transposed_unit * g_partition_data.lsize() + myid;
-        // We communicate only non-zero values
-        if (l_nlt[idx] > 0) {
-          g_partition_data.async[offset + IDX_DIST(nunits)].set(
-              &(l_nlt[idx]));
-        }
-
-        if (l_nle[idx] > 0) {
-          g_partition_data.async[offset + IDX_SUPP(nunits)].set(
-              &(l_nle[idx]));
-        }
-      }
-      else {
-        g_partition_data.local[myid + IDX_DIST(nunits)] = l_nlt[idx];
-        g_partition_data.local[myid + IDX_SUPP(nunits)] = l_nle[idx];
-      }
-    }
-    // complete outstanding requests...
-    g_partition_data.async.flush();
+  trace.enter_state(state_transpose_local_histograms);
+  /*
+   * Transpose (Shuffle) the final histograms to communicate
+   * the partition distribution
+   */
+  std::vector<size_t> l_nlt_nle(NLT_NLE_BLOCK * nunits);
+  std::vector<size_t> g_nlt_nle_t(NLT_NLE_BLOCK * nunits);
+
+  for (std::size_t idx = 1; idx < l_nlt.size(); ++idx) {
+    auto const transposed_unit = idx - 1;
+    l_nlt_nle[transposed_unit * NLT_NLE_BLOCK]     = l_nlt[idx];
+    l_nlt_nle[transposed_unit * NLT_NLE_BLOCK + 1] = l_nle[idx];
   }
-  trace.exit_state("6:transpose_local_histograms (all-to-all)");
 
-  trace.enter_state("7:barrier");
-  team.barrier();
-  trace.exit_state("7:barrier");
+  team.alltoall(l_nlt_nle.data(), g_nlt_nle_t.data(), NLT_NLE_BLOCK);
+
+  // Number of elements in the local range of every unit which are less than
+  // (distribution) and less than equals (supply) the partition border right
+  // of this unit
+  std::vector<size_t> l_partition_dist(nunits);
+  std::vector<size_t> l_partition_supp(nunits);
+
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    l_partition_dist[unit] = g_nlt_nle_t[unit * NLT_NLE_BLOCK];
+    l_partition_supp[unit] = g_nlt_nle_t[unit * NLT_NLE_BLOCK + 1];
+  }
+  trace.exit_state(state_transpose_local_histograms);
 
   DASH_LOG_TRACE_RANGE(
       "initial partition distribution:",
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits) + nunits));
+      l_partition_dist.begin(),
+      l_partition_dist.end());
 
   DASH_LOG_TRACE_RANGE(
-      "initial partition distribution:",
-      std::next(g_partition_data.lbegin(), IDX_SUPP(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_SUPP(nunits) + nunits));
+      "initial partition supply:",
+      l_partition_supp.begin(),
+      l_partition_supp.end());
 
   /* Calculate final distribution per partition. Each unit calculates their
    * local distribution independently.
    * All accesses are only to local memory
    */
 
-  trace.enter_state("8:calc_final_partition_dist");
+  trace.enter_state(state_calc_final_partition_dist);
 
   detail::psort__calc_final_partition_dist(
-      acc_partition_count, g_partition_data.local);
+      acc_partition_count, myid, l_partition_supp, l_partition_dist);
 
   DASH_LOG_TRACE_RANGE(
       "final partition distribution",
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits) + nunits));
-
-  // Reset local elements to 0 since the following matrix transpose
-  // communicates only non-zero values and writes to exactly these offsets.
-  std::fill(
-      &(g_partition_data.local[IDX_TARGET_COUNT(nunits)]),
-      &(g_partition_data.local[IDX_TARGET_COUNT(nunits) + nunits]),
-      0);
+      l_partition_dist.begin(),
+      l_partition_dist.end());
 
-  trace.exit_state("8:calc_final_partition_dist");
+  trace.exit_state(state_calc_final_partition_dist);
 
-  trace.enter_state("9:barrier");
-  team.barrier();
-  trace.exit_state("9:barrier");
-
-  trace.enter_state("10:transpose_final_partition_dist (all-to-all)");
+  trace.enter_state(state_transpose_final_partition_dist);
   /*
    * Transpose the final distribution again to obtain the end offsets
    */
-  dash::team_unit_t unit{0};
-  auto const        last = static_cast<dash::team_unit_t>(nunits);
-
-  for (; unit < last; ++unit) {
-    if (g_partition_data.local[IDX_DIST(nunits) + unit] == 0) {
-      continue;
-    }
+  std::vector<size_t> l_target_count(nunits);
 
-    if (unit != myid) {
-      // We communicate only non-zero values
-      auto const offset = unit * g_partition_data.lsize() + myid;
-      g_partition_data.async[offset + IDX_TARGET_COUNT(nunits)].set(
-          &(g_partition_data.local[IDX_DIST(nunits) + unit]));
-    }
-    else {
-      g_partition_data.local[IDX_TARGET_COUNT(nunits) + myid] =
-          g_partition_data.local[IDX_DIST(nunits) + unit];
-    }
-  }
+  team.alltoall(l_partition_dist.data(), l_target_count.data(), 1);
 
-  g_partition_data.async.flush();
-
-  trace.exit_state("10:transpose_final_partition_dist (all-to-all)");
-
-  trace.enter_state("11:barrier");
-  team.barrier();
-  trace.exit_state("11:barrier");
+  trace.exit_state(state_transpose_final_partition_dist);
 
   DASH_LOG_TRACE_RANGE(
-      "final target count",
-      std::next(g_partition_data.lbegin(), IDX_TARGET_COUNT(nunits)),
-      std::next(
-          g_partition_data.lbegin(), IDX_TARGET_COUNT(nunits) + nunits));
+      "final target count", l_target_count.begin(), l_target_count.end());
 
-  trace.enter_state("12:calc_final_send_count");
+  trace.enter_state(state_calc_final_send_count);
 
+  std::vector<std::size_t> l_send_count(nunits, 0);
   std::vector<std::size_t> l_send_displs(nunits, 0);
 
   if (n_l_elem > 0) {
     detail::psort__calc_send_count(
-        p_borders, valid_partitions, g_partition_data.local);
+        p_borders, valid_partitions, l_target_count, l_send_count);
 
     // Obtain the final send displs which is just an exclusive scan based on
     // the send count
-    auto l_send_count = &(g_partition_data.local[IDX_SEND_COUNT(nunits)]);
-    std::copy(l_send_count, l_send_count + nunits, std::begin(l_send_displs));
-
     std::partial_sum(
-        std::begin(l_send_displs),
-        std::end(l_send_displs),
-        std::begin(l_send_displs),
+        std::begin(l_send_count),
+        std::prev(std::end(l_send_count)),
+        std::next(std::begin(l_send_displs)),
         std::plus<size_t>());
-
-    // Shift by 1 and fill leading element with 0 to obtain the exclusive scan
-    // character
-    l_send_displs.insert(std::begin(l_send_displs), 0);
-    l_send_displs.pop_back();
-  }
-  else {
-    std::fill(
-        std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
-        std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits) + nunits),
-        0);
   }
 
 #if defined(DASH_ENABLE_ASSERTIONS) && defined(DASH_ENABLE_TRACE_LOGGING)
@@ -1122,7 +998,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
     DASH_ASSERT_RETURNS(
         dart_allreduce(
-            std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
+            l_send_count.data(),
             chksum.data(),
             nunits,
             dart_datatype<size_t>::value,
@@ -1138,107 +1014,61 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 #endif
 
   DASH_LOG_TRACE_RANGE(
-      "send count",
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits) + nunits));
+      "send count", l_send_count.begin(), l_send_count.end());
 
   DASH_LOG_TRACE_RANGE(
       "send displs", l_send_displs.begin(), l_send_displs.end());
 
-  trace.exit_state("12:calc_final_send_count");
+  trace.exit_state(state_calc_final_send_count);
 
-  trace.enter_state("13:barrier");
-  team.barrier();
-  trace.exit_state("13:barrier");
+  trace.enter_state(state_calc_final_recv_displs);
 
-  trace.enter_state("14:calc_final_target_displs");
+  std::vector<std::size_t> l_recv_count(nunits, 0);
 
-  if (n_l_elem > 0) {
-    detail::psort__calc_target_displs(
-        p_borders, valid_partitions, g_partition_data);
-  }
+  team.alltoall(l_send_count.data(), l_recv_count.data(), 1);
 
-  trace.exit_state("14:calc_final_target_displs");
+  // Units receive the sequences in ascending order of the sending units,
+  // so the displacements are an exclusive scan of the receive counts
+  std::vector<std::size_t> l_recv_displs(nunits, 0);
 
-  trace.enter_state("15:barrier");
-  team.barrier();
-  trace.exit_state("15:barrier");
+  std::partial_sum(
+      std::begin(l_recv_count),
+      std::prev(std::end(l_recv_count)),
+      std::next(std::begin(l_recv_displs)),
+      std::plus<size_t>());
 
   DASH_LOG_TRACE_RANGE(
-      "target displs",
-      &(g_partition_data.local[IDX_TARGET_DISP(nunits)]),
-      &(g_partition_data.local[IDX_TARGET_DISP(nunits) + nunits]));
+      "recv displs", l_recv_displs.begin(), l_recv_displs.end());
 
-  trace.enter_state("16:exchange_data (all-to-all)");
+  trace.exit_state(state_calc_final_recv_displs);
 
-  std::vector<dash::Future<iter_type>> async_copies{};
-  async_copies.reserve(p_unit_info.valid_remote_partitions.size());
+  trace.enter_state(state_exchange_data);
 
   DASH_LOG_TRACE_RANGE("before final sort round", lbegin, lend);
 
-  auto const l_partition_data = g_partition_data.local;
-
-  auto const get_send_info = [l_partition_data, &l_send_displs, nunits](
-                                 dash::default_index_t const p_idx) {
-    auto const send_count = l_partition_data[p_idx + IDX_SEND_COUNT(nunits)];
-    auto const target_disp =
-        l_partition_data[p_idx + IDX_TARGET_DISP(nunits)];
-    auto const send_disp = l_send_displs[p_idx];
-    return std::make_tuple(send_count, send_disp, target_disp);
-  };
-
-  std::size_t send_count, send_disp, target_disp;
-
-  for (auto const& unit : p_unit_info.valid_remote_partitions) {
-    std::tie(send_count, send_disp, target_disp) = get_send_info(unit);
+  team.alltoallv(
+      lcopy.data(),
+      l_send_count.data(),
+      l_send_displs.data(),
+      lbegin,
+      l_recv_count.data(),
+      l_recv_displs.data());
 
-    iter_type it_copy{};
-    if (unit == unit_at_begin) {
-      it_copy = begin;
-    }
-    else {
-      // The array passed to global_index is 0 initialized
-      auto gidx =
-          pattern.global_index(static_cast<dash::team_unit_t>(unit), {});
-      it_copy = iter_type{&(begin.globmem()), pattern, gidx};
-    }
-
-    auto&& fut = dash::copy_async(
-        &(*(lcopy.begin() + send_disp)),
-        &(*(lcopy.begin() + send_disp + send_count)),
-        it_copy + target_disp);
-
-    async_copies.emplace_back(std::move(fut));
-  }
-
-  std::tie(send_count, send_disp, target_disp) = get_send_info(myid);
+  trace.exit_state(state_exchange_data);
 
-  if (send_count) {
-    std::copy(
-        lcopy.begin() + send_disp,
-        lcopy.begin() + send_disp + send_count,
-        lbegin + target_disp);
+  // All received sequences are already sorted, so a k-way merge suffices
+  // instead of sorting the local range once again
+  trace.enter_state(state_merge_local_sequences);
+  if (n_l_elem > 0) {
+    detail::psort__merge_local_sequences(
+        lbegin, lend, l_recv_displs, lcopy, sort_comp);
   }
-
-  std::for_each(
-      std::begin(async_copies),
-      std::end(async_copies),
-      [](dash::Future<iter_type>& fut) { fut.wait(); });
-
-  trace.exit_state("16:exchange_data (all-to-all)");
-
-  trace.enter_state("17:barrier");
-  team.barrier();
-  trace.exit_state("17:barrier");
-
-  trace.enter_state("18:final_local_sort");
-  std::sort(lbegin, lend, sort_comp);
-  trace.exit_state("18:final_local_sort");
+  trace.exit_state(state_merge_local_sequences);
   DASH_LOG_TRACE_RANGE("finally sorted range", lbegin, lend);
 
-  trace.enter_state("19:final_barrier");
+  trace.enter_state(state_final_barrier);
   team.barrier();
-  trace.exit_state("19:final_barrier");
+  trace.exit_state(state_final_barrier);
 }
 
 namespace detail {
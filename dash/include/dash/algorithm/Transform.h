@@ -5,8 +5,11 @@
 #include <dash/GlobRef.h>
 
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/Copy.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Segments.h>
 
 #include <dash/Iterator.h>
 
@@ -15,9 +18,9 @@
 
 #include <dash/dart/if/dart_communication.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <algorithm>
+#include <type_traits>
+#include <vector>
 
 namespace dash {
 
@@ -61,14 +64,24 @@ OutputIt transform(
  * Apply a given function to pairs of elements from two ranges and store the
  * result in another range, beginning at \c out_first.
  *
- * Corresponding to \c MPI_Accumulate, the binary operation is executed
- * atomically on single elements.
+ * If the output range is the second input range and the operation is a
+ * DART reduce operation like \c dash::plus, corresponding to
+ * \c MPI_Accumulate, the binary operation is executed atomically on single
+ * elements.
  *
  * Precondition: All elements in the input range are contained in a single
  * block so that
  *
  *   g_out_last == g_out_first + (l_in_last - l_in_first)
  *
+ * Otherwise, the result is computed out of place with arbitrary binary
+ * functions. For global input ranges, every unit of the team computes the
+ * output elements in its local memory; remote input elements are
+ * prefetched in chunks while preceding chunks are computed. The output
+ * range must not overlap with the input ranges unless it is identical to
+ * the second input range, and a barrier is required before reading
+ * output elements computed by other units.
+ *
  * Semantics:
  *
  *   binary_op(in_a[0], in_b[0]),
@@ -116,6 +129,38 @@ GlobOutputIt transform(
   /// Reduce operation
   BinaryOperation binary_op);
 
+/**
+ * Apply a given function to pairs of elements from two ranges and store the
+ * result in another range, beginning at \c out_first.
+ *
+ * Output elements in local memory are computed as specified by the
+ * execution policy. The variant without execution policy uses
+ * \c dash::execution::seq.
+ *
+ * \see      dash::execution
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class InputIt1,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+GlobOutputIt transform(
+  /// Execution policy of the operation on local elements
+  ExecutionPolicy && policy,
+  /// Iterator on begin of first local range
+  InputIt1         in_a_first,
+  /// Iterator after last element of local range
+  InputIt1         in_a_last,
+  /// Iterator on begin of second local range
+  GlobInputIt     in_b_first,
+  /// Iterator on first element of global output range
+  GlobOutputIt    out_first,
+  /// Reduce operation
+  BinaryOperation binary_op);
+
 #else
 
 namespace internal {
@@ -169,6 +214,31 @@ dart_ret_t transform_impl(
 struct transform_impl_local_input_it{};
 struct transform_impl_glob_input_it{};
 
+/**
+ * Applies the binary operation to elements in local memory using at most
+ * \c n_threads threads.
+ */
+template <
+    typename ValueAType,
+    typename ValueBType,
+    typename ValueOutType,
+    class BinaryOperation>
+inline void transform_kernel(
+    int                     n_threads,
+    const ValueAType      * in_a,
+    const ValueBType      * in_b,
+    ValueOutType          * out,
+    size_t                  nelem,
+    BinaryOperation         binary_op)
+{
+  dash::internal::parallel_chunks(
+    dash::internal::execution_threads(n_threads, nelem), nelem,
+    [&](int, size_t begin, size_t end) {
+      std::transform(in_a + begin, in_a + end, in_b + begin, out + begin,
+                     binary_op);
+    });
+}
+
 /**
  * Transform operation on ranges with identical distribution and start
  * offset.
@@ -187,6 +257,9 @@ struct transform_impl_glob_input_it{};
  *              =    =    =    ...
  *   output:  [ u0 | u1 | u2 | ... ]
  * </pre>
+ *
+ * Precondition: the ranges span the entire pattern, so the local range of
+ * every unit is its complete local memory.
  */
 template <
     typename ValueType,
@@ -195,6 +268,7 @@ template <
     class GlobOutputIt,
     class BinaryOperation>
 GlobOutputIt transform_local(
+    int             n_threads,
     InputAIt        in_a_first,
     InputAIt        in_a_last,
     InputBIt        in_b_first,
@@ -208,125 +282,298 @@ GlobOutputIt transform_local(
   DASH_ASSERT_MSG(in_a_first.pattern() == out_first.pattern(),
                   "dash::transform_local: "
                   "distributions of input- and output ranges differ");
-  // Local subrange of input range a:
-  auto local_range_a   = dash::local_range(in_a_first, in_a_last);
-  ValueType * lbegin_a = local_range_a.begin;
-  ValueType * lend_a   = local_range_a.end;
-  if (lbegin_a == lend_a) {
-    // Local input range is empty, return initial output iterator to indicate
-    // that no values have been transformed:
-    DASH_LOG_DEBUG("dash::transform_local", "local range empty");
-    return out_first;
-  }
-  // Global offset of first local element:
-  auto g_offset_first    = in_a_first.pattern().global(0);
+  const auto & pattern = in_a_first.pattern();
   // Number of elements in global ranges:
-  auto num_gvalues       = dash::distance(in_a_first, in_b_first);
+  auto num_gvalues       = dash::distance(in_a_first, in_a_last);
   DASH_LOG_TRACE_VAR("dash::transform_local", num_gvalues);
   // Number of local elements:
-  DASH_LOG_TRACE("dash::transform_local", "local elements:", lend_a-lbegin_a);
-  // Local subrange of input range b:
-  ValueType * lbegin_b   = (in_b_first + g_offset_first).local();
-  // Local pointer of initial output element:
-  ValueType * lbegin_out = (out_first  + g_offset_first).local();
-  // Generate output values:
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::transform_local", "thread capacity:",  n_threads);
-  if (n_threads > 1) {
-    auto l_size = lend_a - lbegin_a;
-    // TODO: Vectorize.
-    // Documentation of Intel MIC intrinsics, see:
-    // https://software.intel.com/de-de/node/523533
-    // https://software.intel.com/de-de/node/523387
-    #pragma omp parallel for num_threads(n_threads) schedule(static)
-    for (int i = 0; i < l_size; i++) {
-      lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
-    }
+  auto l_size            = pattern.local_size();
+  if (l_size == 0) {
+    // Local input range is empty:
+    DASH_LOG_DEBUG("dash::transform_local", "local range empty");
     return out_first + num_gvalues;
   }
-#endif
-  // No OpenMP or insufficient number of threads for parallelization:
-  for (; lbegin_a != lend_a; ++lbegin_a, ++lbegin_b, ++lbegin_out) {
-    *lbegin_out = binary_op(*lbegin_a, *lbegin_b);
-  }
+  DASH_LOG_TRACE("dash::transform_local", "local elements:", l_size);
+  // Global offset of first local element:
+  auto g_offset_first    = pattern.global(0);
+  // Local pointers to first local element in the ranges:
+  const auto * lbegin_a  = (in_a_first + g_offset_first).local();
+  const auto * lbegin_b  = (in_b_first + g_offset_first).local();
+  auto       * lbegin_out = (out_first + g_offset_first).local();
+  // Generate output values:
+  transform_kernel(n_threads, lbegin_a, lbegin_b, lbegin_out, l_size,
+                   binary_op);
   // Return out_end iterator past final transformed element;
   return out_first + num_gvalues;
 }
 
+/**
+ * Number of output elements transformed in a stage of
+ * \c dash::internal::transform_pipelined, remote input elements of a
+ * stage are prefetched while the previous stage is computed.
+ */
+template <typename ValueType>
+constexpr size_t transform_chunk_size()
+{
+  return ((64 * 1024) / sizeof(ValueType)) > 0
+         ? ((64 * 1024) / sizeof(ValueType))
+         : 1;
+}
+
+/**
+ * Whether two patterns of possibly different type specify the same
+ * distribution.
+ */
+template <class PatternT>
+inline bool transform_identical(const PatternT & lhs, const PatternT & rhs)
+{
+  return lhs == rhs;
+}
+
+template <class PatternT, class PatternU>
+inline bool transform_identical(const PatternT &, const PatternU &)
+{
+  return false;
+}
+
+/**
+ * Whether two global iterators of possibly different type refer to the
+ * same element. Global iterators only compare their positions, so the
+ * global pointers are compared to tell apart ranges in different
+ * containers.
+ */
+template <class GlobIterT>
+inline bool transform_same_element(
+  const GlobIterT & lhs,
+  const GlobIterT & rhs)
+{
+  return lhs == rhs && DART_GPTR_EQUAL(lhs.dart_gptr(), rhs.dart_gptr());
+}
+
+template <class GlobIterT, class GlobIterU>
+inline bool transform_same_element(const GlobIterT &, const GlobIterU &)
+{
+  return false;
+}
+
+/**
+ * Provides the elements at positions <tt>[offset, offset + nelem)</tt> of
+ * a global input range in local memory.
+ * Returns a native pointer to the elements if they are contiguous in
+ * local memory of the calling unit, otherwise starts copying them to the
+ * given staging buffer.
+ */
 template <
-    class InputIt,
     class GlobInputIt,
+    typename ValueType,
+    typename SizeType>
+const ValueType * transform_stage(
+    const GlobInputIt          & in_first,
+    SizeType                     offset,
+    SizeType                     nelem,
+    std::vector<ValueType>     & buffer,
+    std::vector<dart_handle_t> & handles)
+{
+  auto in_it = in_first + offset;
+  if (in_it.is_local() &&
+      dash::internal::segment_length(in_first, offset, nelem) == nelem) {
+    return in_it.local();
+  }
+  if (buffer.size() < static_cast<size_t>(nelem)) {
+    buffer.resize(nelem);
+  }
+  dash::internal::copy_impl(in_it, in_it + nelem, buffer.data(), handles);
+  return buffer.data();
+}
+
+/**
+ * Out-of-place transform operation <tt>C = op(A, B)</tt> on global ranges
+ * with arbitrary distributions.
+ *
+ * Every unit computes the elements of the output range in its local
+ * memory. Input elements that are not in local memory are copied to
+ * staging buffers in chunks; the next chunk is requested before the
+ * current chunk is computed so communication overlaps with computation.
+ */
+template <
+    class GlobInputAIt,
+    class GlobInputBIt,
     class GlobOutputIt,
     class BinaryOperation>
-GlobOutputIt transform(
-    /// Iterator on begin of first local range
-    InputIt in_a_first,
-    /// Iterator after last element of local range
-    InputIt in_a_last,
-    /// Iterator on begin of second local range
-    GlobInputIt in_b_first,
-    /// Iterator on first element of global output range
-    GlobOutputIt out_first,
-    /// Reduce operation
-    BinaryOperation binary_op,
-    /// Specialization for a global input iterator
-    transform_impl_glob_input_it /*unused*/)
+GlobOutputIt transform_pipelined(
+    int             n_threads,
+    GlobInputAIt    in_a_first,
+    GlobInputAIt    in_a_last,
+    GlobInputBIt    in_b_first,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op)
 {
-  using iterator_traits = dash::iterator_traits<InputIt>;
-  DASH_LOG_DEBUG("dash::transform(gaf, gal, gbf, goutf, binop)");
-  auto in_first = in_a_first;
-  auto in_last  = in_a_last;
+  typedef typename std::remove_const<
+            typename GlobInputAIt::value_type>::type value_a_t;
+  typedef typename std::remove_const<
+            typename GlobInputBIt::value_type>::type value_b_t;
+  typedef typename GlobOutputIt::value_type        value_out_t;
+
+  auto num_elem_total = dash::distance(in_a_first, in_a_last);
+  DASH_LOG_DEBUG("dash::transform_pipelined()", "elements:", num_elem_total);
+  if (num_elem_total <= 0) {
+    return out_first;
+  }
+  typedef decltype(num_elem_total) size_type;
+
+  struct chunk_t {
+    size_type     offset;
+    size_type     nelem;
+    value_out_t * dest;
+  };
+
+  const size_type chunk_size = transform_chunk_size<value_out_t>();
+
+  // Split the local segments of the output range into chunks:
+  std::vector<chunk_t> chunks;
+  dash::internal::for_each_local_segment(
+    out_first, out_first + num_elem_total,
+    [&](const dash::internal::glob_segment<GlobOutputIt> & seg) {
+      size_type seg_size = seg.size;
+      for (size_type c = 0; c < seg_size; c += chunk_size) {
+        chunks.push_back(
+          chunk_t { seg.offset + c,
+                    std::min(chunk_size, seg_size - c),
+                    seg.lbegin + c });
+      }
+    });
+  DASH_LOG_TRACE_VAR("dash::transform_pipelined", chunks.size());
+
+  // Double-buffered staging of input chunks:
+  std::vector<value_a_t>     buffer_a[2];
+  std::vector<value_b_t>     buffer_b[2];
+  std::vector<dart_handle_t> handles[2];
+  const value_a_t          * src_a[2];
+  const value_b_t          * src_b[2];
+
+  auto fetch = [&](size_t c, int s) {
+    src_a[s] = transform_stage(in_a_first, chunks[c].offset, chunks[c].nelem,
+                               buffer_a[s], handles[s]);
+    src_b[s] = transform_stage(in_b_first, chunks[c].offset, chunks[c].nelem,
+                               buffer_b[s], handles[s]);
+  };
+
+  if (!chunks.empty()) {
+    fetch(0, 0);
+  }
+  for (size_t c = 0; c < chunks.size(); ++c) {
+    int s = c % 2;
+    if (c + 1 < chunks.size()) {
+      fetch(c + 1, 1 - s);
+    }
+    if (!handles[s].empty()) {
+      if (dart_waitall_local(handles[s].data(), handles[s].size())
+          != DART_OK) {
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "dash::transform: dart_waitall_local failed");
+      }
+      handles[s].clear();
+    }
+    transform_kernel(n_threads, src_a[s], src_b[s], chunks[c].dest,
+                     chunks[c].nelem, binary_op);
+  }
+  return out_first + num_elem_total;
+}
 
-  if (in_b_first == out_first) {
-    // Output range is rhs input range: C += A
-    // Input is (in_a_first, in_a_last).
-  } else {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::transform is only implemented for out = op(in,out)");
-    // Output range different from rhs input range: C = A+B
-    // Input is (in_a_first, in_a_last) + (in_b_first, in_b_last):
-
-    // TODO:
-    // in_range.allocate(...);
-    // in_first = in_range.begin();
-    // in_last  = in_range.end();
+/**
+ * Out-of-place transform operation <tt>C = op(A, B)</tt> on global ranges.
+ */
+template <
+    class ExecutionPolicy,
+    class GlobInputAIt,
+    class GlobInputBIt,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_out_of_place(
+    const ExecutionPolicy & policy,
+    GlobInputAIt    in_a_first,
+    GlobInputAIt    in_a_last,
+    GlobInputBIt    in_b_first,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op)
+{
+  typedef typename GlobOutputIt::value_type value_out_t;
+
+  static const auto trace_context = dash::util::Trace::state("transform");
+  static const auto state_local = dash::util::Trace::state("local");
+  static const auto state_pipelined = dash::util::Trace::state("pipelined");
+  dash::util::Trace trace(trace_context);
+
+  const auto & pattern_in_a = in_a_first.pattern();
+  const auto & pattern_in_b = in_b_first.pattern();
+  const auto & pattern_out  = out_first.pattern();
+  int          n_threads    = dash::internal::execution_threads(policy);
+  DASH_ASSERT_MSG(
+    pattern_in_a.team() == pattern_in_b.team(),
+    "dash::transform: Different teams in input ranges");
+  DASH_ASSERT_MSG(
+    pattern_in_a.team() == pattern_out.team(),
+    "dash::transform: Different teams in input- and output ranges");
+
+  // Fast path: identical distribution of all ranges spanning the entire
+  // pattern, output values only depend on input values in local memory:
+  if (transform_identical(pattern_in_a, pattern_in_b) &&
+      transform_identical(pattern_in_a, pattern_out) &&
+      in_a_first.gpos() == 0 &&
+      in_b_first.gpos() == 0 &&
+      out_first.gpos()  == 0 &&
+      static_cast<size_t>(dash::distance(in_a_first, in_a_last))
+        == pattern_in_a.size()) {
+    trace.enter_state(state_local);
+    auto out_last = transform_local<value_out_t>(
+                      n_threads,
+                      in_a_first,
+                      in_a_last,
+                      in_b_first,
+                      out_first,
+                      binary_op);
+    trace.exit_state(state_local);
+    return out_last;
   }
+  trace.enter_state(state_pipelined);
+  auto out_last = transform_pipelined(
+                    n_threads,
+                    in_a_first,
+                    in_a_last,
+                    in_b_first,
+                    out_first,
+                    binary_op);
+  trace.exit_state(state_pipelined);
+  return out_last;
+}
 
-  dash::util::Trace trace("transform");
+/**
+ * Accumulates the local subrange of input range a to the output range
+ * using the DART reduce operation of \c binary_op.
+ */
+template <
+    class InputIt,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_accumulate(
+    InputIt         in_a_first,
+    InputIt         in_a_last,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op,
+    std::true_type  /* DART operation */)
+{
+  static const auto trace_context = dash::util::Trace::state("transform");
+  static const auto state_transform_blocking =
+    dash::util::Trace::state("transform_blocking");
+  dash::util::Trace trace(trace_context);
 
-  // Pattern of input ranges a and b, and output range:
+  // Pattern of input range a and output range:
   const auto& pattern_in_a = in_a_first.pattern();
-  const auto& pattern_in_b = in_b_first.pattern();
   const auto& pattern_out  = out_first.pattern();
 
-#if __NON_ATOMIC__
-  // Fast path: check if transform operation is local-only:
-  if (pattern_in_a == pattern_in_b &&
-      pattern_in_a == pattern_out) {
-    // Identical pattern in all ranges
-    if (in_a_first.pos() == in_b_first.pos() &&
-        in_a_first.pos() == out_first.pos()) {
-      trace.enter_state("local");
-      // All units operate on local ranges that have identical distribution:
-      auto out_last = dash::transform_local<iterator_traits::value_type>(
-                        in_a_first,
-                        in_a_last,
-                        in_b_first,
-                        out_first,
-                        binary_op);
-      trace.exit_state("local");
-      return out_last;
-    }
-  }
-#endif
   // Resolve teams from global iterators:
   dash::Team & team_in_a        = pattern_in_a.team();
-  DASH_ASSERT_MSG(
-    team_in_a == pattern_in_b.team(),
-    "dash::transform: Different teams in input ranges");
   DASH_ASSERT_MSG(
     team_in_a == pattern_out.team(),
     "dash::transform: Different teams in input- and output ranges");
@@ -347,24 +594,43 @@ GlobOutputIt transform(
   // Native pointer to local sub-range:
   auto l_values          = (in_a_first + global_offset).local();
   // Send accumulate message:
-  trace.enter_state("transform_blocking");
+  trace.enter_state(state_transform_blocking);
   dash::internal::transform_blocking_impl(
       dest_gptr,
       l_values,
       num_local_elements,
       binary_op.dart_operation());
-  trace.exit_state("transform_blocking");
+  trace.exit_state(state_transform_blocking);
 
   return out_first + global_offset + num_local_elements;
+}
 
+template <
+    class InputIt,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_accumulate(
+    InputIt,
+    InputIt,
+    GlobOutputIt    out_first,
+    BinaryOperation,
+    std::false_type /* DART operation */)
+{
+  DASH_THROW(
+    dash::exception::InvalidArgument,
+    "dash::transform: operation cannot be applied by accumulate");
+  return out_first;
 }
 
 template <
+    class ExecutionPolicy,
     class InputIt,
     class GlobInputIt,
     class GlobOutputIt,
     class BinaryOperation>
 GlobOutputIt transform(
+    /// Execution policy of the operation on local elements
+    const ExecutionPolicy & policy,
     /// Iterator on begin of first local range
     InputIt in_a_first,
     /// Iterator after last element of local range
@@ -375,31 +641,56 @@ GlobOutputIt transform(
     GlobOutputIt out_first,
     /// Reduce operation
     BinaryOperation binary_op,
-    transform_impl_local_input_it /*unused*/)
+    /// Specialization for a global input iterator
+    transform_impl_glob_input_it /*unused*/)
 {
-  DASH_LOG_DEBUG("dash::transform(af, al, bf, outf, binop)");
-  // Outut range different from rhs input range is not supported yet
-  auto in_first = in_a_first;
-  auto in_last  = in_a_last;
-
-  using value_type = typename dash::iterator_traits<InputIt>::value_type;
-  std::vector<value_type> in_range;
-  if (in_b_first == out_first) {
-    // Output range is rhs input range: C += A
-    // Input is (in_a_first, in_a_last).
-  } else {
-    // Output range different from rhs input range: C = A+B
-    // Input is (in_a_first, in_a_last) + (in_b_first, in_b_last):
-    std::transform(
-      in_a_first, in_a_last,
-      in_b_first,
-      std::back_inserter(in_range),
-      binary_op);
-    in_first = in_range.data();
-    in_last  = in_first + in_range.size();
+  DASH_LOG_DEBUG("dash::transform(gaf, gal, gbf, goutf, binop)");
+  typedef std::integral_constant<
+            bool,
+            dash::internal::dart_reduce_operation<BinaryOperation>::value
+              != DART_OP_UNDEFINED > is_dart_op;
+
+  if (!transform_same_element(in_b_first, out_first) || !is_dart_op::value) {
+    // Output range different from rhs input range: C = op(A,B)
+    // Operations that are not supported by DART are applied out of place,
+    // also if the output range is the rhs input range:
+    return transform_out_of_place(
+             policy,
+             in_a_first,
+             in_a_last,
+             in_b_first,
+             out_first,
+             binary_op);
   }
+  // Output range is rhs input range: C += A
+  // Input is (in_a_first, in_a_last).
+  return transform_accumulate(
+           in_a_first,
+           in_a_last,
+           out_first,
+           binary_op,
+           is_dart_op());
+}
 
-  dash::util::Trace trace("transform");
+/**
+ * Accumulates a local input range to the output range using the DART
+ * reduce operation of \c binary_op.
+ */
+template <
+    class InputIt,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_accumulate_local(
+    InputIt         in_first,
+    InputIt         in_last,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op,
+    std::true_type  /* DART operation */)
+{
+  static const auto trace_context = dash::util::Trace::state("transform");
+  static const auto state_transform_blocking =
+    dash::util::Trace::state("transform_blocking");
+  dash::util::Trace trace(trace_context);
 
   // Resolve local range from global range:
   // Number of elements in local range:
@@ -407,13 +698,13 @@ GlobOutputIt transform(
   // Global iterator to dart_gptr_t:
   dart_gptr_t dest_gptr         = out_first.dart_gptr();
   // Send accumulate message:
-  trace.enter_state("transform_blocking");
+  trace.enter_state(state_transform_blocking);
   dash::internal::transform_blocking_impl(
       dest_gptr,
       in_first,
       num_local_elements,
       binary_op.dart_operation());
-  trace.exit_state("transform_blocking");
+  trace.exit_state(state_transform_blocking);
   // The position past the last element transformed in global element space
   // cannot be resolved from the size of the local range if the local range
   // spans over more than one block. Otherwise, the difference of two global
@@ -432,21 +723,104 @@ GlobOutputIt transform(
   return out_first + num_local_elements;
 }
 
+template <
+    class InputIt,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_accumulate_local(
+    InputIt,
+    InputIt,
+    GlobOutputIt    out_first,
+    BinaryOperation,
+    std::false_type /* DART operation */)
+{
+  DASH_THROW(
+    dash::exception::InvalidArgument,
+    "dash::transform: operation cannot be applied by accumulate");
+  return out_first;
+}
+
+template <
+    class ExecutionPolicy,
+    class InputIt,
+    class GlobInputIt,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform(
+    /// Execution policy of the operation on local elements
+    const ExecutionPolicy & /*policy*/,
+    /// Iterator on begin of first local range
+    InputIt in_a_first,
+    /// Iterator after last element of local range
+    InputIt in_a_last,
+    /// Iterator on begin of second local range
+    GlobInputIt in_b_first,
+    /// Iterator on first element of global output range
+    GlobOutputIt out_first,
+    /// Reduce operation
+    BinaryOperation binary_op,
+    transform_impl_local_input_it /*unused*/)
+{
+  DASH_LOG_DEBUG("dash::transform(af, al, bf, outf, binop)");
+  typedef std::integral_constant<
+            bool,
+            dash::internal::dart_reduce_operation<BinaryOperation>::value
+              != DART_OP_UNDEFINED > is_dart_op;
+
+  if (transform_same_element(in_b_first, out_first) && is_dart_op::value) {
+    // Output range is rhs input range: C += A
+    // Input is (in_a_first, in_a_last).
+    return transform_accumulate_local(
+             in_a_first,
+             in_a_last,
+             out_first,
+             binary_op,
+             is_dart_op());
+  }
+  // Output range different from rhs input range: C = op(A,B)
+  // Input is (in_a_first, in_a_last) + (in_b_first, in_b_last), the rhs
+  // input range is copied to local memory and the result is copied to the
+  // output range:
+  typedef typename std::remove_const<
+            typename GlobInputIt::value_type>::type value_b_t;
+  typedef typename GlobOutputIt::value_type        value_out_t;
+
+  auto num_elem = std::distance(in_a_first, in_a_last);
+  std::vector<value_b_t>   in_b_range(num_elem);
+  std::vector<value_out_t> out_range(num_elem);
+  dash::copy(in_b_first, in_b_first + num_elem, in_b_range.data());
+  std::transform(
+    in_a_first, in_a_last,
+    in_b_range.begin(),
+    out_range.begin(),
+    binary_op);
+  return dash::copy(out_range.data(),
+                    out_range.data() + num_elem,
+                    out_first);
+}
+
 } // namespace internal
 
 
 
 template <
+    class ExecutionPolicy,
     class InputIt,
     class GlobInputIt,
     class GlobOutputIt,
-    class BinaryOperation>
+    class BinaryOperation,
+    typename = typename std::enable_if<
+                 dash::is_execution_policy<
+                   typename std::decay<ExecutionPolicy>::type
+                 >::value
+               >::type >
 GlobOutputIt transform(
-    InputIt         in_a_first,
-    InputIt         in_a_last,
-    GlobInputIt     in_b_first,
-    GlobOutputIt    out_first,
-    BinaryOperation binary_op)
+    ExecutionPolicy && policy,
+    InputIt            in_a_first,
+    InputIt            in_a_last,
+    GlobInputIt        in_b_first,
+    GlobOutputIt       out_first,
+    BinaryOperation    binary_op)
 {
   using InputIt_traits_t    = dash::iterator_traits<InputIt>;
   using InputIt_is_global_t = typename InputIt_traits_t::is_global_iterator;
@@ -466,6 +840,7 @@ GlobOutputIt transform(
       "out_first must be a global iterator");
 
   return internal::transform(
+      policy,
       in_a_first,
       in_a_last,
       in_b_first,
@@ -477,6 +852,27 @@ GlobOutputIt transform(
           internal::transform_impl_local_input_it>::type());
 }
 
+template <
+    class InputIt,
+    class GlobInputIt,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform(
+    InputIt         in_a_first,
+    InputIt         in_a_last,
+    GlobInputIt     in_b_first,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op)
+{
+  return dash::transform(
+           dash::execution::seq,
+           in_a_first,
+           in_a_last,
+           in_b_first,
+           out_first,
+           binary_op);
+}
+
 /**
  * Specialization of \c dash::transform as non-blocking operation.
  *
@@ -0,0 +1,78 @@
+#ifndef DASH__ALGORITHM__INTERNAL__COLLECTIVE_FUTURE_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__COLLECTIVE_FUTURE_H__INCLUDED
+
+#include <dash/Future.h>
+#include <dash/Exception.h>
+#include <dash/dart/if/dart_communication.h>
+#include <dash/internal/Logging.h>
+
+#include <memory>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Creates a future for the result of a non-blocking collective operation
+ * identified by \c handle.
+ *
+ * The buffers of the operation are members of \c state which is kept alive
+ * until the operation completed. Once completed, the result of the future
+ * is obtained from \c finish, called with \c state as argument.
+ *
+ * Requests of non-blocking collective operations must not be freed before
+ * their completion, destroying an incomplete future therefore waits for the
+ * operation to complete.
+ */
+template <
+  typename ResultT,
+  typename StateT,
+  typename FinishFunc >
+dash::Future<ResultT> collective_future(
+  dart_handle_t             handle,
+  std::shared_ptr<StateT>   state,
+  FinishFunc                finish)
+{
+  auto handle_ptr = std::make_shared<dart_handle_t>(handle);
+
+  return dash::Future<ResultT>(
+    // get
+    [=]() mutable {
+      DASH_LOG_TRACE("dash::internal::collective_future [Future]()",
+                     "wait for collective operation");
+      if (dart_wait_local(handle_ptr.get()) != DART_OK) {
+        DASH_LOG_ERROR("dash::internal::collective_future [Future]",
+                       "dart_wait_local failed");
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "dash::internal::collective_future [Future]: "
+          "dart_wait_local failed");
+      }
+      return finish(*state);
+    },
+    // test
+    [=](ResultT * out) mutable {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_test_local(handle_ptr.get(), &flag),
+        DART_OK);
+      if (flag) {
+        *out = finish(*state);
+      }
+      return (flag != 0);
+    },
+    // destroy
+    [=]() mutable {
+      if (*handle_ptr != DART_HANDLE_NULL) {
+        DASH_ASSERT_RETURNS(
+          dart_wait_local(handle_ptr.get()),
+          DART_OK);
+      }
+    }
+  );
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__COLLECTIVE_FUTURE_H__INCLUDED
@@ -0,0 +1,374 @@
+#ifndef DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+// Micro-kernels of float and double values are implemented with compiler
+// vector extensions where available, define DASH_GEMM_DISABLE_VECTOR_EXT to
+// use the portable scalar micro-kernel instead:
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(DASH_GEMM_DISABLE_VECTOR_EXT)
+#  define DASH__GEMM__VECTOR_EXT
+#  if defined(__AVX512F__)
+#    define DASH__GEMM__VECTOR_BYTES 64
+#  elif defined(__AVX__)
+#    define DASH__GEMM__VECTOR_BYTES 32
+#  else
+#    define DASH__GEMM__VECTOR_BYTES 16
+#  endif
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Portable micro-kernel of the local matrix multiplication.
+ *
+ * Computes the \c MR x \c NR tile of the product of a packed sliver of
+ * \c MR rows of A and a packed sliver of \c NR columns of B.
+ * Loop bounds are constant so compilers can keep the accumulators in
+ * registers and vectorize the inner loop.
+ */
+template <typename ValueType>
+struct gemm_scalar_kernel
+{
+  static constexpr int mr = 4;
+  static constexpr int nr = 4;
+
+  static const char * name() { return "scalar"; }
+
+  static void run(
+    long long         kc,
+    const ValueType * a,
+    const ValueType * b,
+    ValueType       * c_tile)
+  {
+    ValueType acc[mr][nr];
+    for (int r = 0; r < mr; ++r) {
+      for (int c = 0; c < nr; ++c) {
+        acc[r][c] = ValueType();
+      }
+    }
+    for (long long p = 0; p < kc; ++p) {
+      for (int r = 0; r < mr; ++r) {
+        auto a_r = a[r];
+        for (int c = 0; c < nr; ++c) {
+          acc[r][c] += a_r * b[c];
+        }
+      }
+      a += mr;
+      b += nr;
+    }
+    for (int r = 0; r < mr; ++r) {
+      for (int c = 0; c < nr; ++c) {
+        c_tile[r * nr + c] = acc[r][c];
+      }
+    }
+  }
+};
+
+#ifdef DASH__GEMM__VECTOR_EXT
+
+template <typename ValueType>
+struct gemm_vector_type;
+
+template <>
+struct gemm_vector_type<float> {
+  typedef float  type __attribute__((vector_size(DASH__GEMM__VECTOR_BYTES)));
+};
+
+template <>
+struct gemm_vector_type<double> {
+  typedef double type __attribute__((vector_size(DASH__GEMM__VECTOR_BYTES)));
+};
+
+/**
+ * Micro-kernel of the local matrix multiplication using compiler vector
+ * extensions.
+ *
+ * Every row of the \c MR x \c NR tile is accumulated in two vector
+ * registers, elements of A are broadcast to vectors.
+ */
+template <typename ValueType>
+struct gemm_vector_kernel
+{
+  typedef typename gemm_vector_type<ValueType>::type vec_t;
+
+  static constexpr int lanes = DASH__GEMM__VECTOR_BYTES / sizeof(ValueType);
+  static constexpr int nv    = 2;
+  // Two vector registers for B and one for the broadcast element of A
+  // are required in addition to the accumulators:
+  static constexpr int mr    = (DASH__GEMM__VECTOR_BYTES > 16) ? 6 : 4;
+  static constexpr int nr    = nv * lanes;
+
+  static const char * name() { return "vector"; }
+
+  static void run(
+    long long         kc,
+    const ValueType * a,
+    const ValueType * b,
+    ValueType       * c_tile)
+  {
+    vec_t acc[mr][nv];
+    for (int r = 0; r < mr; ++r) {
+      for (int v = 0; v < nv; ++v) {
+        acc[r][v] = vec_t{};
+      }
+    }
+    for (long long p = 0; p < kc; ++p) {
+      vec_t b_v[nv];
+      for (int v = 0; v < nv; ++v) {
+        std::memcpy(&b_v[v], b + v * lanes, sizeof(vec_t));
+      }
+      for (int r = 0; r < mr; ++r) {
+        vec_t a_r = vec_t{} + a[r];
+        for (int v = 0; v < nv; ++v) {
+          acc[r][v] += a_r * b_v[v];
+        }
+      }
+      a += mr;
+      b += nr;
+    }
+    for (int r = 0; r < mr; ++r) {
+      for (int v = 0; v < nv; ++v) {
+        std::memcpy(c_tile + r * nr + v * lanes, &acc[r][v], sizeof(vec_t));
+      }
+    }
+  }
+};
+
+template <typename ValueType>
+struct gemm_kernel
+: public std::conditional<
+           std::is_same<ValueType, float>::value ||
+           std::is_same<ValueType, double>::value,
+           gemm_vector_kernel<ValueType>,
+           gemm_scalar_kernel<ValueType>
+         >::type
+{ };
+
+#else  // DASH__GEMM__VECTOR_EXT
+
+template <typename ValueType>
+struct gemm_kernel
+: public gemm_scalar_kernel<ValueType>
+{ };
+
+#endif // DASH__GEMM__VECTOR_EXT
+
+/**
+ * Cache blocking of the local matrix multiplication.
+ *
+ * A packed \c KC x \c NC panel of B is shared by all threads and should
+ * fit into the last level cache, every thread packs \c MC x \c KC blocks
+ * of A that should fit into the L2 cache. A sliver of \c KC x \c NR
+ * elements of the panel of B is reused from the L1 cache for all slivers
+ * of the block of A.
+ */
+template <typename ValueType>
+struct gemm_blocking
+{
+  typedef gemm_kernel<ValueType> kernel;
+
+  static constexpr long long kc = 256;
+  static constexpr long long mc = (96   / kernel::mr) * kernel::mr;
+  static constexpr long long nc = (2048 / kernel::nr) * kernel::nr;
+};
+
+/**
+ * Packs a block of \c mc x \c kc elements of row-major matrix A to
+ * slivers of \c MR rows, stored column by column.
+ * The last sliver is padded with zeros.
+ */
+template <typename ValueType>
+void gemm_pack_a(
+  const ValueType * A,
+  long long         lda,
+  long long         mc,
+  long long         kc,
+  ValueType       * buf)
+{
+  constexpr int mr = gemm_kernel<ValueType>::mr;
+  for (long long i0 = 0; i0 < mc; i0 += mr) {
+    auto const mr_eff = std::min<long long>(mr, mc - i0);
+    for (long long p = 0; p < kc; ++p) {
+      for (int r = 0; r < mr; ++r) {
+        *buf++ = (r < mr_eff) ? A[(i0 + r) * lda + p] : ValueType();
+      }
+    }
+  }
+}
+
+/**
+ * Packs a panel of \c kc x \c nc elements of row-major matrix B to
+ * slivers of \c NR columns, stored row by row.
+ * The last sliver is padded with zeros.
+ */
+template <typename ValueType>
+void gemm_pack_b(
+  const ValueType * B,
+  long long         ldb,
+  long long         kc,
+  long long         nc,
+  ValueType       * buf)
+{
+  constexpr int nr = gemm_kernel<ValueType>::nr;
+  for (long long j0 = 0; j0 < nc; j0 += nr) {
+    auto const nr_eff = std::min<long long>(nr, nc - j0);
+    for (long long p = 0; p < kc; ++p) {
+      const ValueType * b_row = B + p * ldb + j0;
+      for (int c = 0; c < nr; ++c) {
+        *buf++ = (c < nr_eff) ? b_row[c] : ValueType();
+      }
+    }
+  }
+}
+
+/**
+ * Multiplies a packed block of A with a packed panel of B and adds the
+ * result to the \c mc x \c nc block of row-major matrix C.
+ */
+template <typename ValueType>
+void gemm_macro_kernel(
+  long long         mc,
+  long long         nc,
+  long long         kc,
+  const ValueType * a_pack,
+  const ValueType * b_pack,
+  ValueType       * C,
+  long long         ldc)
+{
+  typedef gemm_kernel<ValueType> kernel;
+  constexpr int mr = kernel::mr;
+  constexpr int nr = kernel::nr;
+
+  ValueType c_tile[mr * nr];
+  for (long long jr = 0; jr < nc; jr += nr) {
+    auto const nr_eff = std::min<long long>(nr, nc - jr);
+    for (long long ir = 0; ir < mc; ir += mr) {
+      auto const mr_eff = std::min<long long>(mr, mc - ir);
+      kernel::run(kc, a_pack + ir * kc, b_pack + jr * kc, c_tile);
+      ValueType * c_block = C + ir * ldc + jr;
+      for (long long r = 0; r < mr_eff; ++r) {
+        for (long long c = 0; c < nr_eff; ++c) {
+          c_block[r * ldc + c] += c_tile[r * nr + c];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Cache-blocked multiplication of row-major matrices, computes
+ * C += A x B for A of extents \c m x \c k and B of extents \c k x \c n.
+ *
+ * Blocks of A are multiplied by up to \c n_threads threads.
+ */
+template <typename ValueType>
+void gemm_row_major(
+  const ValueType * A,
+  long long         lda,
+  const ValueType * B,
+  long long         ldb,
+  ValueType       * C,
+  long long         ldc,
+  long long         m,
+  long long         n,
+  long long         k,
+  int               n_threads)
+{
+  typedef gemm_kernel<ValueType>   kernel;
+  typedef gemm_blocking<ValueType> blocking;
+
+  if (m <= 0 || n <= 0 || k <= 0) {
+    return;
+  }
+
+  const long long mr     = kernel::mr;
+  const long long nr     = kernel::nr;
+  const long long mc_blk = blocking::mc;
+  const long long nc_blk = blocking::nc;
+  const long long kc_blk = blocking::kc;
+
+  auto const kc_max = std::min(kc_blk, k);
+  auto const mc_max = std::min(mc_blk, ((m + mr - 1) / mr) * mr);
+  auto const nc_max = std::min(nc_blk, ((n + nr - 1) / nr) * nr);
+  auto const n_ic   = static_cast<int>((m + mc_blk - 1) / mc_blk);
+  // Every thread multiplies at least one block of A:
+  n_threads = std::max(1, std::min(n_threads, n_ic));
+
+  DASH_LOG_TRACE("dash::internal::gemm_row_major",
+                 "m:", m, "n:", n, "k:", k,
+                 "kernel:", kernel::name(),
+                 "mr:", mr, "nr:", nr,
+                 "threads:", n_threads);
+
+  std::vector<ValueType> b_pack(kc_max * nc_max);
+  std::vector<ValueType> a_packs(n_threads * mc_max * kc_max);
+
+  for (long long jc = 0; jc < n; jc += nc_blk) {
+    auto const nc = std::min(nc_blk, n - jc);
+    for (long long pc = 0; pc < k; pc += kc_blk) {
+      auto const kc = std::min(kc_blk, k - pc);
+      gemm_pack_b(B + pc * ldb + jc, ldb, kc, nc, b_pack.data());
+#ifdef DASH_ENABLE_OPENMP
+      #pragma omp parallel for num_threads(n_threads) schedule(static, 1)
+#endif
+      for (int ib = 0; ib < n_ic; ++ib) {
+#ifdef DASH_ENABLE_OPENMP
+        auto const thread_id = omp_get_thread_num();
+#else
+        auto const thread_id = 0;
+#endif
+        auto const ic      = ib * mc_blk;
+        auto const mc      = std::min(mc_blk, m - ic);
+        ValueType * a_pack = a_packs.data() + thread_id * mc_max * kc_max;
+        gemm_pack_a(A + ic * lda + pc, lda, mc, kc, a_pack);
+        gemm_macro_kernel(mc, nc, kc, a_pack, b_pack.data(),
+                          C + ic * ldc + jc, ldc);
+      }
+    }
+  }
+}
+
+/**
+ * Built-in local matrix multiplication C += A x B, used where MKL or BLAS
+ * are not available.
+ *
+ * A has extents \c m x \c k, B has extents \c k x \c n and C has extents
+ * \c m x \c n. Matrices are stored contiguously in the given storage order.
+ */
+template <typename ValueType>
+void gemm(
+  const ValueType * A,
+  const ValueType * B,
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  MemArrange        storage,
+  int               n_threads = 1)
+{
+  if (storage == dash::COL_MAJOR) {
+    // Column-major C = A x B is row-major C^T = B^T x A^T:
+    gemm_row_major(B, k, A, m, C, m, n, m, k, n_threads);
+  } else {
+    gemm_row_major(A, k, B, n, C, n, m, n, k, n_threads);
+  }
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
@@ -0,0 +1,288 @@
+#ifndef DASH__ALGORITHM__INTERNAL__MERGE_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__MERGE_H__INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <dash/internal/Logging.h>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Tournament tree of losers for merging \c k sorted sequences.
+ *
+ * Every inner node stores the index of the sequence that lost the match
+ * at this node, the overall winner is stored at index 0. Advancing the
+ * winner replays only the matches on its path to the root, so every
+ * element is merged in O(log k) comparisons.
+ *
+ * Ties are resolved by sequence index which renders the merge stable.
+ */
+template <
+  class RandomIt,
+  class Compare >
+class LoserTree
+{
+private:
+  typedef LoserTree<RandomIt, Compare>  self_t;
+  typedef std::pair<RandomIt, RandomIt> run_t;
+
+public:
+  typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+
+public:
+  LoserTree(
+    const std::vector<run_t> & runs,
+    Compare                    comp)
+  : _comp(comp)
+  {
+    // Pad number of leaves to the next power of two, padding leaves are
+    // empty sequences that never win a match:
+    _nleaves = 1;
+    while (_nleaves < runs.size()) {
+      _nleaves <<= 1;
+    }
+    _runs.reserve(_nleaves);
+    _runs.insert(_runs.end(), runs.begin(), runs.end());
+    while (_runs.size() < _nleaves) {
+      _runs.push_back(run_t(RandomIt(), RandomIt()));
+    }
+    _tree.resize(_nleaves, 0);
+    _tree[0] = (_nleaves > 1) ? play(1) : 0;
+  }
+
+  /**
+   * Whether all sequences have been consumed.
+   */
+  inline bool empty() const
+  {
+    return exhausted(_tree[0]);
+  }
+
+  /**
+   * The smallest element of all sequences.
+   */
+  inline const value_type & top() const
+  {
+    return *(_runs[_tree[0]].first);
+  }
+
+  /**
+   * Removes the smallest element and replays the matches on the path of
+   * its sequence.
+   */
+  inline void pop()
+  {
+    auto winner = _tree[0];
+    ++(_runs[winner].first);
+    for (auto node = (winner + _nleaves) >> 1; node > 0; node >>= 1) {
+      if (wins(_tree[node], winner)) {
+        std::swap(_tree[node], winner);
+      }
+    }
+    _tree[0] = winner;
+  }
+
+  /**
+   * Moves all elements of the sequences to the output range in ascending
+   * order.
+   */
+  template <class OutputIt>
+  OutputIt merge(OutputIt out)
+  {
+    for (; !empty(); ++out) {
+      *out = std::move(_runs[_tree[0]].first[0]);
+      pop();
+    }
+    return out;
+  }
+
+private:
+  inline bool exhausted(std::size_t run) const
+  {
+    return _runs[run].first == _runs[run].second;
+  }
+
+  /**
+   * Whether sequence \c a wins a match against sequence \c b.
+   */
+  inline bool wins(std::size_t a, std::size_t b) const
+  {
+    if (exhausted(a)) {
+      return false;
+    }
+    if (exhausted(b)) {
+      return true;
+    }
+    if (_comp(*(_runs[b].first), *(_runs[a].first))) {
+      return false;
+    }
+    if (_comp(*(_runs[a].first), *(_runs[b].first))) {
+      return true;
+    }
+    return a < b;
+  }
+
+  /**
+   * Plays all matches in the subtree at the given node, stores the losers
+   * and returns the winner.
+   */
+  std::size_t play(std::size_t node)
+  {
+    if (node >= _nleaves) {
+      return node - _nleaves;
+    }
+    auto left  = play(2 * node);
+    auto right = play(2 * node + 1);
+    if (wins(left, right)) {
+      _tree[node] = right;
+      return left;
+    }
+    _tree[node] = left;
+    return right;
+  }
+
+private:
+  Compare                  _comp;
+  std::size_t              _nleaves;
+  std::vector<run_t>       _runs;
+  std::vector<std::size_t> _tree;
+};
+
+/**
+ * Merges the sorted sequences \c runs into the output range starting at
+ * \c out, using a loser tree.
+ *
+ * \returns  Output iterator past the last merged element.
+ */
+template <
+  class RandomIt,
+  class OutputIt,
+  class Compare >
+OutputIt merge_sorted_runs(
+  const std::vector<std::pair<RandomIt, RandomIt>> & runs,
+  OutputIt                                           out,
+  Compare                                            comp)
+{
+  if (runs.empty()) {
+    return out;
+  }
+  if (runs.size() == 1) {
+    return std::move(runs[0].first, runs[0].second, out);
+  }
+  if (runs.size() == 2) {
+    return std::merge(
+             std::make_move_iterator(runs[0].first),
+             std::make_move_iterator(runs[0].second),
+             std::make_move_iterator(runs[1].first),
+             std::make_move_iterator(runs[1].second),
+             out, comp);
+  }
+  LoserTree<RandomIt, Compare> tree(runs, comp);
+  return tree.merge(out);
+}
+
+/**
+ * Merges the sorted sequences \c runs into the random access output range
+ * starting at \c out, using up to \c nthreads threads.
+ *
+ * The output range is split into at most \c nthreads disjoint parts at
+ * equidistant splitter values sampled from the longest sequence. Every
+ * thread then merges its part of all sequences with a separate loser
+ * tree.
+ *
+ * \returns  Output iterator past the last merged element.
+ */
+template <
+  class RandomIt,
+  class OutputIt,
+  class Compare >
+OutputIt merge_sorted_runs(
+  const std::vector<std::pair<RandomIt, RandomIt>> & runs,
+  OutputIt                                           out,
+  Compare                                            comp,
+  int                                                nthreads)
+{
+  typedef std::pair<RandomIt, RandomIt> run_t;
+
+  auto const nruns = runs.size();
+
+  std::size_t n_total   = 0;
+  std::size_t max_run   = 0;
+  for (std::size_t r = 0; r < nruns; ++r) {
+    auto run_size = static_cast<std::size_t>(
+                      std::distance(runs[r].first, runs[r].second));
+    n_total += run_size;
+    if (run_size >
+        static_cast<std::size_t>(
+          std::distance(runs[max_run].first, runs[max_run].second))) {
+      max_run = r;
+    }
+  }
+
+  // Parallel merge does not pay off for small ranges:
+  static const std::size_t min_elements_per_thread = 4096;
+  if (nthreads > static_cast<int>(n_total / min_elements_per_thread)) {
+    nthreads = static_cast<int>(n_total / min_elements_per_thread);
+  }
+  if (nthreads <= 1 || nruns < 2) {
+    return merge_sorted_runs(runs, out, comp);
+  }
+
+  DASH_LOG_TRACE("dash::internal::merge_sorted_runs",
+                 "runs:", nruns, "elements:", n_total,
+                 "threads:", nthreads);
+
+  // splits[t * nruns + r] is the first position of part t in run r:
+  std::vector<RandomIt>    splits((nthreads + 1) * nruns);
+  std::vector<std::size_t> out_offsets(nthreads + 1, 0);
+
+  auto const & pivot_run  = runs[max_run];
+  auto const   pivot_size = std::distance(pivot_run.first,
+                                          pivot_run.second);
+  for (int t = 0; t <= nthreads; ++t) {
+    for (std::size_t r = 0; r < nruns; ++r) {
+      RandomIt split;
+      if (t == 0) {
+        split = runs[r].first;
+      } else if (t == nthreads) {
+        split = runs[r].second;
+      } else {
+        auto const & pivot = *(pivot_run.first +
+                               (pivot_size * t) / nthreads);
+        split = std::lower_bound(runs[r].first, runs[r].second, pivot,
+                                 comp);
+      }
+      splits[t * nruns + r] = split;
+      out_offsets[t]       += std::distance(runs[r].first, split);
+    }
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    std::vector<run_t> part_runs;
+    part_runs.reserve(nruns);
+    for (std::size_t r = 0; r < nruns; ++r) {
+      part_runs.push_back(run_t(splits[t * nruns + r],
+                                splits[(t + 1) * nruns + r]));
+    }
+    merge_sorted_runs(part_runs, out + out_offsets[t], comp);
+  }
+  return out + n_total;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__MERGE_H__INCLUDED
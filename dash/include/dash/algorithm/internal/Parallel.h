@@ -0,0 +1,308 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/Execution.h>
+
+#include <dash/algorithm/internal/Segments.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+// Threads of parallel regions are bound to the places closest to the
+// unit's master thread, i.e. to the cores assigned to the unit:
+#if defined(DASH_ENABLE_OPENMP) && DASH__OPENMP_VERSION >= 40
+#  define DASH__OMP_PROC_BIND proc_bind(close)
+#else
+#  define DASH__OMP_PROC_BIND
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Minimum number of elements processed by a single thread, smaller
+ * ranges are processed by fewer threads so forking threads is amortized.
+ */
+constexpr int parallel_min_elements()
+{
+  return 1024;
+}
+
+/**
+ * Number of threads used by the calling unit to execute an algorithm with
+ * the given execution policy.
+ *
+ * Parallel policies use the threads available to the unit as specified by
+ * its locality domain and the DASH configuration, see
+ * \c dash::util::UnitLocality::num_domain_threads.
+ * Resolving the locality of the unit is not free, algorithms determine the
+ * number of threads once per invocation and pass it to the helpers below.
+ * Parallel regions of OpenMP reuse the runtime's persistent thread team,
+ * threads are not created for every invocation.
+ */
+inline int execution_threads(const dash::execution::sequenced_policy &)
+{
+  return 1;
+}
+
+inline int execution_threads(const dash::execution::parallel_policy &)
+{
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  return std::max(uloc.num_domain_threads(), 1);
+#else
+  return 1;
+#endif
+}
+
+inline int execution_threads(
+  const dash::execution::parallel_unsequenced_policy &)
+{
+  return execution_threads(dash::execution::par);
+}
+
+/**
+ * Number of threads to process \c nelem elements with \c n_threads
+ * available threads.
+ */
+template <typename IndexType>
+inline int execution_threads(int n_threads, IndexType nelem)
+{
+  return static_cast<int>(
+           std::max<IndexType>(
+             1,
+             std::min<IndexType>(
+               n_threads,
+               nelem / parallel_min_elements())));
+}
+
+/**
+ * Splits the index range <tt>[0, nelem)</tt> into \c n_chunks contiguous
+ * chunks and invokes \c fn(c, begin, end) on every chunk \c c, chunks are
+ * processed concurrently by one thread each.
+ *
+ * Unlike a parallel loop over single elements, the function is invoked
+ * once per thread so results can be accumulated in local variables
+ * without synchronization.
+ */
+template <typename IndexType, class ChunkFunction>
+void parallel_chunks(
+  int                n_chunks,
+  IndexType          nelem,
+  ChunkFunction   && fn)
+{
+  IndexType chunk_size = nelem / n_chunks;
+  IndexType chunk_rem  = nelem % n_chunks;
+  DASH_LOG_TRACE("dash::internal::parallel_chunks",
+                 "elements:", nelem, "chunks:", n_chunks);
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(n_chunks) schedule(static, 1) \
+                           if(n_chunks > 1) DASH__OMP_PROC_BIND
+#endif
+  for (int c = 0; c < n_chunks; ++c) {
+    // The first chunk_rem chunks contain one additional element:
+    IndexType begin = c * chunk_size + std::min<IndexType>(c, chunk_rem);
+    IndexType end   = begin + chunk_size + (c < chunk_rem ? 1 : 0);
+    fn(c, begin, end);
+  }
+}
+
+/**
+ * Splits the index range <tt>[0, nelem)</tt> into \c n_chunks contiguous
+ * chunks, folds every chunk into a separate result starting from \c init
+ * using \c fold(result, begin, end) and combines the results in the order
+ * of the chunks using \c combine(result, chunk_result).
+ */
+template <
+  typename IndexType,
+  typename ResultType,
+  class    FoldFunction,
+  class    CombineFunction>
+ResultType reduce_chunks(
+  int                  n_chunks,
+  IndexType            nelem,
+  const ResultType   & init,
+  FoldFunction      && fold,
+  CombineFunction   && combine)
+{
+  ResultType result = init;
+  if (n_chunks <= 1) {
+    fold(result, IndexType(0), nelem);
+    return result;
+  }
+  std::vector<ResultType> chunk_results(n_chunks, init);
+  parallel_chunks(n_chunks, nelem,
+    [&](int c, IndexType begin, IndexType end) {
+      // Fold the chunk into a local variable to prevent false sharing:
+      ResultType chunk_result = init;
+      fold(chunk_result, begin, end);
+      chunk_results[c] = chunk_result;
+    });
+  for (const auto & chunk_result : chunk_results) {
+    combine(result, chunk_result);
+  }
+  return result;
+}
+
+/**
+ * Invokes \c fn(seg) on the local segments of the global range
+ * <tt>[first, last)</tt> using at most \c n_threads threads.
+ *
+ * The positions traversed to resolve the local segments are divided into
+ * chunks that are processed concurrently, segments are clipped to the
+ * chunks. With a single thread, \c fn is invoked on the segments in the
+ * order of \c dash::internal::for_each_local_segment.
+ */
+template <class GlobIterType, class SegmentFunction>
+void for_each_local_segment(
+  int                  n_threads,
+  const GlobIterType & first,
+  const GlobIterType & last,
+  SegmentFunction   && fn)
+{
+  typedef typename GlobIterType::index_type index_t;
+
+  index_t npos = local_segment_positions(first, last);
+  parallel_chunks(execution_threads(n_threads, npos), npos,
+    [&](int, index_t begin, index_t end) {
+      for_each_local_segment(first, last, begin, end, fn);
+    });
+}
+
+/**
+ * Invokes \c fn(lbegin, lend) on runs of local elements of the global
+ * range <tt>[first, last)</tt> that are contiguous in local memory, using
+ * at most \c n_threads threads.
+ *
+ * If the local elements of the range are contiguous, the run of all local
+ * elements is split into chunks of equal size, otherwise the positions
+ * traversed to resolve the local segments are divided into chunks.
+ *
+ * \see  dash::internal::for_each_local_run
+ */
+template <class GlobIterType, class RunFunction>
+void for_each_local_run(
+  int                  n_threads,
+  const GlobIterType & first,
+  const GlobIterType & last,
+  RunFunction       && fn)
+{
+  typedef typename GlobIterType::index_type index_t;
+
+  auto l_run = local_run_of(first, last);
+  if (l_run.contiguous) {
+    index_t nelem = l_run.end - l_run.begin;
+    parallel_chunks(execution_threads(n_threads, nelem), nelem,
+      [&](int, index_t begin, index_t end) {
+        if (begin < end) {
+          fn(l_run.begin + begin, l_run.begin + end);
+        }
+      });
+    return;
+  }
+  index_t npos = local_segment_positions(first, last);
+  parallel_chunks(execution_threads(n_threads, npos), npos,
+    [&](int, index_t begin, index_t end) {
+      for_each_local_merged_run(first, last, begin, end, fn);
+    });
+}
+
+/**
+ * Reduces the local segments of the global range <tt>[first, last)</tt>
+ * to a single result using at most \c n_threads threads.
+ *
+ * \c part(result, seg) folds the elements of a local segment \c seg into
+ * \c result, results of chunks are combined in the order of the chunks
+ * using \c combine(result, other).
+ *
+ * \see  dash::internal::for_each_local_segment
+ */
+template <
+  class    GlobIterType,
+  typename ResultType,
+  class    PartFunction,
+  class    CombineFunction>
+ResultType reduce_local_segments(
+  int                  n_threads,
+  const GlobIterType & first,
+  const GlobIterType & last,
+  const ResultType   & init,
+  PartFunction      && part,
+  CombineFunction   && combine)
+{
+  typedef typename GlobIterType::index_type index_t;
+
+  index_t npos = local_segment_positions(first, last);
+  return reduce_chunks(execution_threads(n_threads, npos), npos, init,
+    [&](ResultType & result, index_t begin, index_t end) {
+      for_each_local_segment(first, last, begin, end,
+        [&](const glob_segment<GlobIterType> & seg) {
+          part(result, seg);
+        });
+    },
+    combine);
+}
+
+/**
+ * Reduces the runs of local elements of the global range
+ * <tt>[first, last)</tt> to a single result using at most \c n_threads
+ * threads.
+ *
+ * \c part(result, lbegin, lend) folds the local elements
+ * <tt>[lbegin, lend)</tt> into \c result, results of chunks are combined
+ * in the order of the chunks using \c combine(result, other).
+ *
+ * \see  dash::internal::for_each_local_run
+ */
+template <
+  class    GlobIterType,
+  typename ResultType,
+  class    PartFunction,
+  class    CombineFunction>
+ResultType reduce_local_runs(
+  int                  n_threads,
+  const GlobIterType & first,
+  const GlobIterType & last,
+  const ResultType   & init,
+  PartFunction      && part,
+  CombineFunction   && combine)
+{
+  typedef typename GlobIterType::index_type    index_t;
+  typedef typename GlobIterType::local_pointer local_pointer;
+
+  auto l_run = local_run_of(first, last);
+  if (l_run.contiguous) {
+    index_t nelem = l_run.end - l_run.begin;
+    return reduce_chunks(execution_threads(n_threads, nelem), nelem, init,
+      [&](ResultType & result, index_t begin, index_t end) {
+        if (begin < end) {
+          part(result, l_run.begin + begin, l_run.begin + end);
+        }
+      },
+      combine);
+  }
+  index_t npos = local_segment_positions(first, last);
+  return reduce_chunks(execution_threads(n_threads, npos), npos, init,
+    [&](ResultType & result, index_t begin, index_t end) {
+      for_each_local_merged_run(first, last, begin, end,
+        [&](local_pointer lbegin, local_pointer lend) {
+          part(result, lbegin, lend);
+        });
+    },
+    combine);
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
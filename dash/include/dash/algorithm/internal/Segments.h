@@ -0,0 +1,514 @@
+#ifndef DASH__ALGORITHM__INTERNAL__SEGMENTS_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__SEGMENTS_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Iterator.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_types.h>
+
+#include <algorithm>
+#include <type_traits>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Number of elements from the given global index to the end of its block
+ * in the fastest changing dimension of the pattern, i.e. the length of
+ * the run of elements that are contiguous in global index order and in
+ * the local memory of the unit owning the block.
+ */
+template <class PatternType>
+typename PatternType::size_type block_run_length(
+  const PatternType                   & pattern,
+  typename PatternType::index_type      g_index)
+{
+  constexpr dim_t ndim = PatternType::ndim();
+  constexpr dim_t d    = (PatternType::memory_order() == ROW_MAJOR)
+                         ? ndim - 1
+                         : 0;
+  auto g_coords = pattern.coords(g_index);
+  auto block_vs = pattern.block(pattern.block_at(g_coords));
+  return block_vs.offset(d) + block_vs.extent(d) - g_coords[d];
+}
+
+/**
+ * Largest length \c n in <tt>[1, max_len]</tt> for which \c valid(n)
+ * holds, found by binary search.
+ * Expects \c valid(1) to hold and \c valid(n) to imply \c valid(m) for
+ * all \c m < \c n.
+ */
+template <typename SizeType, class Predicate>
+SizeType longest_valid_length(
+  SizeType    max_len,
+  Predicate   valid)
+{
+  if (max_len <= 1 || valid(max_len)) {
+    return max_len;
+  }
+  // valid(lo) holds, valid(hi + 1) does not:
+  SizeType lo = 1;
+  SizeType hi = max_len - 1;
+  while (lo < hi) {
+    SizeType mid = lo + (hi - lo + 1) / 2;
+    if (valid(mid)) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return lo;
+}
+
+/**
+ * Number of elements from position \c offset in the range starting at
+ * \c first that are contiguous in global index order and in local memory
+ * of their owning unit, at most \c max_len.
+ */
+template <class GlobIterType, typename SizeType>
+SizeType segment_length(
+  const GlobIterType & first,
+  SizeType             offset,
+  SizeType             max_len)
+{
+  const auto & pattern = first.pattern();
+  auto     g_index = (first + offset).gpos();
+  SizeType run_len = std::min<SizeType>(
+                       block_run_length(pattern, g_index),
+                       max_len);
+  if (run_len <= 1) {
+    return run_len;
+  }
+  // Elements in a view range are not necessarily contiguous in global
+  // index order, e.g. in a block view of a matrix:
+  auto l_index = pattern.local(g_index).index;
+  return longest_valid_length(run_len, [&](SizeType len) {
+           auto g_last = (first + (offset + len - 1)).gpos();
+           return g_last ==
+                    g_index + static_cast<decltype(g_index)>(len - 1) &&
+                  pattern.local(g_last).index ==
+                    l_index + static_cast<decltype(l_index)>(len - 1);
+         });
+}
+
+/**
+ * Segment of a global range, a sequence of elements that are contiguous
+ * in the range and in the local memory of a single unit.
+ *
+ * Elements of local segments are accessed through the native pointer
+ * \c lbegin, elements of remote segments through the global pointer
+ * \c gptr.
+ */
+template <class GlobIterType>
+struct glob_segment {
+  typedef typename GlobIterType::index_type    index_type;
+  typedef typename GlobIterType::local_pointer local_pointer;
+
+  /// Position of the segment's first element in the range
+  index_type    offset;
+  /// Global index of the segment's first element
+  index_type    gindex;
+  /// Number of elements in the segment
+  index_type    size;
+  /// Unit owning the segment
+  team_unit_t   unit;
+  /// Local index of the segment's first element at the owning unit
+  index_type    lindex;
+  /// Native pointer to the first element, \c nullptr for remote segments
+  local_pointer lbegin;
+  /// Global pointer to the first element, only set for remote segments
+  dart_gptr_t   gptr;
+
+  constexpr bool is_local() const {
+    return lbegin != nullptr;
+  }
+};
+
+/**
+ * Invokes \c fn on every segment of the global range starting at
+ * \c first at positions <tt>[offset_begin, offset_end)</tt> in the
+ * range, in the order of the range.
+ * Segments are clipped to the given positions.
+ *
+ * \complexity  O(d * ns), with \c d dimensions in the iterators' pattern
+ *              and \c ns segments at the given positions
+ */
+template <class GlobIterType, typename IndexType, class SegmentFunction>
+void for_each_segment(
+  const GlobIterType & first,
+  IndexType            offset_begin,
+  IndexType            offset_end,
+  SegmentFunction      fn)
+{
+  typedef typename GlobIterType::index_type index_t;
+
+  const auto & pattern = first.pattern();
+  auto myid = pattern.team().myid();
+
+  glob_segment<GlobIterType> seg;
+  for (index_t offset = offset_begin; offset < offset_end;
+       offset += seg.size) {
+    auto it    = first + offset;
+    auto l_pos = pattern.local(it.gpos());
+    seg.offset = offset;
+    seg.gindex = it.gpos();
+    seg.size   = segment_length<GlobIterType, index_t>(
+                   first, offset, offset_end - offset);
+    seg.unit   = l_pos.unit;
+    seg.lindex = l_pos.index;
+    if (l_pos.unit == myid) {
+      seg.lbegin = it.local();
+      seg.gptr   = DART_GPTR_NULL;
+    } else {
+      seg.lbegin = nullptr;
+      seg.gptr   = it.dart_gptr();
+    }
+    DASH_LOG_TRACE("dash::internal::for_each_segment",
+                   "offset:", seg.offset,
+                   "g_idx:",  seg.gindex,
+                   "unit:",   seg.unit,
+                   "l_idx:",  seg.lindex,
+                   "size:",   seg.size);
+    fn(seg);
+  }
+}
+
+/**
+ * Invokes \c fn on every segment in the global range \c [first, last),
+ * in the order of the range.
+ *
+ * \complexity  O(d * ns), with \c d dimensions in the iterators' pattern
+ *              and \c ns segments in the range
+ */
+template <class GlobIterType, class SegmentFunction>
+void for_each_segment(
+  const GlobIterType & first,
+  const GlobIterType & last,
+  SegmentFunction      fn)
+{
+  typedef typename GlobIterType::index_type index_t;
+
+  index_t num_elem = dash::distance(first, last);
+  for_each_segment(first, index_t(0), num_elem, fn);
+}
+
+/**
+ * Number of positions that are traversed to resolve the local segments
+ * of the global range \c [first, last).
+ *
+ * Positions are local indices of the calling unit for ranges of global
+ * iterators that are not relative to a view and contain at least as many
+ * elements as local memory, otherwise positions in the range.
+ * Disjoint intervals of positions can be traversed independently, e.g. by
+ * multiple threads, see \c for_each_local_segment.
+ */
+template <class GlobIterType>
+typename std::enable_if<
+  !GlobIterType::has_view::value,
+  typename GlobIterType::index_type
+>::type
+local_segment_positions(
+  const GlobIterType & first,
+  const GlobIterType & last)
+{
+  typedef typename GlobIterType::index_type index_t;
+
+  index_t num_elem = dash::distance(first, last);
+  index_t l_size   = first.pattern().local_size();
+  if (num_elem <= 0) {
+    return 0;
+  }
+  return num_elem < l_size ? num_elem : l_size;
+}
+
+template <class GlobIterType>
+typename std::enable_if<
+  GlobIterType::has_view::value,
+  typename GlobIterType::index_type
+>::type
+local_segment_positions(
+  const GlobIterType & first,
+  const GlobIterType & last)
+{
+  return std::max<typename GlobIterType::index_type>(
+           dash::distance(first, last), 0);
+}
+
+/**
+ * Invokes \c fn on every segment in the global range \c [first, last)
+ * that is local to the calling unit and at positions
+ * <tt>[pos_begin, pos_end)</tt> as defined by
+ * \c local_segment_positions.
+ * Segments are clipped to the given positions.
+ *
+ * For ranges of global iterators that are not relative to a view, the
+ * segments are resolved from the calling unit's local memory in ascending
+ * order of their local index, otherwise in the order of the range.
+ * Remote segments of the range are not visited in the former case.
+ *
+ * \complexity  O(d * nl), with \c d dimensions in the iterators' pattern
+ *              and \c nl segments in local memory
+ */
+template <class GlobIterType, class SegmentFunction>
+typename std::enable_if<
+  !GlobIterType::has_view::value,
+  void
+>::type
+for_each_local_segment(
+  const GlobIterType                & first,
+  const GlobIterType                & last,
+  typename GlobIterType::index_type   pos_begin,
+  typename GlobIterType::index_type   pos_end,
+  SegmentFunction                     fn)
+{
+  typedef typename GlobIterType::index_type    index_t;
+  typedef typename GlobIterType::local_pointer local_pointer;
+
+  index_t num_elem = dash::distance(first, last);
+  if (num_elem <= 0) {
+    return;
+  }
+  const auto & pattern = first.pattern();
+  index_t      l_size  = pattern.local_size();
+  if (num_elem < l_size) {
+    // Fewer elements in the range than in local memory:
+    for_each_segment(first, pos_begin, pos_end,
+      [&](const glob_segment<GlobIterType> & seg) {
+        if (seg.is_local()) {
+          fn(seg);
+        }
+      });
+    return;
+  }
+  index_t g_first = first.gpos();
+  index_t g_last  = g_first + num_elem;
+  GlobIterType  first_it(first);
+  local_pointer l_begin = first_it.globmem().lbegin();
+
+  glob_segment<GlobIterType> seg;
+  seg.unit = pattern.team().myid();
+  seg.gptr = DART_GPTR_NULL;
+  for (index_t l_idx = pos_begin; l_idx < pos_end; ) {
+    index_t g_idx   = pattern.global(l_idx);
+    index_t run_len = longest_valid_length(
+                        std::min<index_t>(
+                          block_run_length(pattern, g_idx),
+                          pos_end - l_idx),
+                        [&](index_t len) {
+                          return pattern.local(g_idx + len - 1).index ==
+                                 l_idx + len - 1;
+                        });
+    // Intersection of the run with the range in global index domain:
+    index_t g_begin = std::max<index_t>(g_idx, g_first);
+    index_t g_end   = std::min<index_t>(g_idx + run_len, g_last);
+    if (g_begin < g_end) {
+      seg.offset = g_begin - g_first;
+      seg.gindex = g_begin;
+      seg.size   = g_end - g_begin;
+      seg.lindex = l_idx + (g_begin - g_idx);
+      seg.lbegin = l_begin + seg.lindex;
+      DASH_LOG_TRACE("dash::internal::for_each_local_segment",
+                     "offset:", seg.offset,
+                     "g_idx:",  seg.gindex,
+                     "l_idx:",  seg.lindex,
+                     "size:",   seg.size);
+      fn(seg);
+    }
+    l_idx += run_len;
+  }
+}
+
+template <class GlobIterType, class SegmentFunction>
+typename std::enable_if<
+  GlobIterType::has_view::value,
+  void
+>::type
+for_each_local_segment(
+  const GlobIterType                & first,
+  const GlobIterType                & last,
+  typename GlobIterType::index_type   pos_begin,
+  typename GlobIterType::index_type   pos_end,
+  SegmentFunction                     fn)
+{
+  for_each_segment(first, pos_begin, pos_end,
+    [&](const glob_segment<GlobIterType> & seg) {
+      if (seg.is_local()) {
+        fn(seg);
+      }
+    });
+}
+
+/**
+ * Invokes \c fn on every segment in the global range \c [first, last)
+ * that is local to the calling unit.
+ *
+ * \see  local_segment_positions
+ */
+template <class GlobIterType, class SegmentFunction>
+void for_each_local_segment(
+  const GlobIterType & first,
+  const GlobIterType & last,
+  SegmentFunction      fn)
+{
+  for_each_local_segment(first, last,
+                         0, local_segment_positions(first, last),
+                         fn);
+}
+
+/**
+ * Native pointers to the local elements of a global range if they are
+ * contiguous in local memory of the calling unit.
+ */
+template <class GlobIterType>
+struct local_run {
+  typedef typename GlobIterType::local_pointer local_pointer;
+
+  /// Whether the local elements of the range are <tt>[begin, end)</tt>
+  bool          contiguous;
+  local_pointer begin;
+  local_pointer end;
+};
+
+/**
+ * Resolves the local elements of the global range \c [first, last) as a
+ * single run in local memory of the calling unit.
+ *
+ * Local elements of ranges of global iterators that are not relative to
+ * a view are contiguous if the range contains all local elements, or if
+ * the pattern is one-dimensional as global indices of local elements
+ * then ascend with their local index.
+ *
+ * \complexity  O(d), or O(log nl) for a one-dimensional pattern and a
+ *              range containing a part of the \c nl local elements
+ */
+template <class GlobIterType>
+typename std::enable_if<
+  !GlobIterType::has_view::value,
+  local_run<GlobIterType>
+>::type
+local_run_of(
+  const GlobIterType & first,
+  const GlobIterType & last)
+{
+  typedef typename GlobIterType::index_type    index_t;
+  typedef typename GlobIterType::pattern_type  pattern_t;
+  typedef typename GlobIterType::local_pointer local_pointer;
+
+  const auto & pattern  = first.pattern();
+  index_t      num_elem = dash::distance(first, last);
+  index_t      l_size   = pattern.local_size();
+  if (num_elem <= 0 || l_size == 0) {
+    return local_run<GlobIterType> { true, nullptr, nullptr };
+  }
+  GlobIterType  first_it(first);
+  local_pointer l_begin = first_it.globmem().lbegin();
+  index_t       g_first = first.gpos();
+  index_t       g_last  = g_first + num_elem;
+  if (g_first <= pattern.lbegin() && pattern.lend() <= g_last) {
+    return local_run<GlobIterType> { true, l_begin, l_begin + l_size };
+  }
+  if (pattern_t::ndim() > 1) {
+    return local_run<GlobIterType> { false, nullptr, nullptr };
+  }
+  // Local index of the first local element at or after global index g:
+  auto l_lower = [&](index_t g) {
+                   index_t lo = 0;
+                   index_t hi = l_size;
+                   while (lo < hi) {
+                     index_t mid = lo + (hi - lo) / 2;
+                     if (pattern.global(mid) < g) {
+                       lo = mid + 1;
+                     } else {
+                       hi = mid;
+                     }
+                   }
+                   return lo;
+                 };
+  return local_run<GlobIterType> {
+           true, l_begin + l_lower(g_first), l_begin + l_lower(g_last) };
+}
+
+template <class GlobIterType>
+typename std::enable_if<
+  GlobIterType::has_view::value,
+  local_run<GlobIterType>
+>::type
+local_run_of(
+  const GlobIterType &,
+  const GlobIterType &)
+{
+  return local_run<GlobIterType> { false, nullptr, nullptr };
+}
+
+/**
+ * Invokes \c fn(lbegin, lend) on the local elements of the segments at
+ * positions <tt>[pos_begin, pos_end)</tt> of the global range
+ * \c [first, last), merging segments that are adjacent in local memory.
+ *
+ * \see  for_each_local_segment
+ */
+template <class GlobIterType, class RunFunction>
+void for_each_local_merged_run(
+  const GlobIterType                & first,
+  const GlobIterType                & last,
+  typename GlobIterType::index_type   pos_begin,
+  typename GlobIterType::index_type   pos_end,
+  RunFunction                      && fn)
+{
+  typedef typename GlobIterType::local_pointer local_pointer;
+
+  local_pointer run_begin = nullptr;
+  local_pointer run_end   = nullptr;
+  for_each_local_segment(first, last, pos_begin, pos_end,
+    [&](const glob_segment<GlobIterType> & seg) {
+      if (seg.lbegin == run_end) {
+        run_end += seg.size;
+        return;
+      }
+      if (run_begin != run_end) {
+        fn(run_begin, run_end);
+      }
+      run_begin = seg.lbegin;
+      run_end   = seg.lbegin + seg.size;
+    });
+  if (run_begin != run_end) {
+    fn(run_begin, run_end);
+  }
+}
+
+/**
+ * Invokes \c fn(lbegin, lend) on runs of local elements of the global
+ * range \c [first, last) that are contiguous in local memory of the
+ * calling unit.
+ *
+ * Unlike \c for_each_local_segment, runs are not restricted to elements
+ * that are contiguous in the range, so the local elements of a range
+ * containing all local elements are visited in a single run, also for
+ * cyclic distributions.
+ * Runs carry no position in the range and are intended for algorithms
+ * that do not depend on the order of elements.
+ */
+template <class GlobIterType, class RunFunction>
+void for_each_local_run(
+  const GlobIterType & first,
+  const GlobIterType & last,
+  RunFunction       && fn)
+{
+  auto l_run = local_run_of(first, last);
+  if (l_run.contiguous) {
+    if (l_run.begin != l_run.end) {
+      fn(l_run.begin, l_run.end);
+    }
+    return;
+  }
+  for_each_local_merged_run(first, last,
+                            0, local_segment_positions(first, last),
+                            fn);
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__SEGMENTS_H__INCLUDED
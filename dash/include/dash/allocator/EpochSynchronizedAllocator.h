@@ -223,6 +223,50 @@ public:
     return gptr;
   }
 
+  /**
+   * Register multiple pre-allocated local memory segments in global memory
+   * space in a single collective operation.
+   *
+   * Collective operation.
+   * The number of segments must be identical at all units, the number of
+   * elements in a segment may differ between units and may be 0.
+   *
+   * \return  Global pointers to the attached segments, \c DART_GPTR_NULL
+   *          for all segments if the attach failed.
+   *
+   * \see attach
+   */
+  std::vector<pointer> attach(
+    const std::vector<local_pointer> & lptrs,
+    const std::vector<size_type>     & num_local_elem)
+  {
+    DASH_LOG_DEBUG("EpochSynchronizedAllocator.attach(lptrs,nlocal)",
+                   "number of segments:", lptrs.size());
+    DASH_ASSERT_EQ(lptrs.size(), num_local_elem.size(),
+                   "number of segments and segment sizes differ");
+    auto nsegs = lptrs.size();
+    std::vector<pointer> gptrs(nsegs, DART_GPTR_NULL);
+    std::vector<size_t>  seg_nelem(nsegs);
+    std::vector<void *>  seg_addrs(nsegs);
+    for (size_t s = 0; s < nsegs; ++s) {
+      dash::dart_storage<ElementType> ds(num_local_elem[s]);
+      seg_nelem[s] = ds.nelem;
+      seg_addrs[s] = lptrs[s];
+    }
+    if (dart_team_memregister_segments(
+          _team->dart_id(), nsegs, seg_nelem.data(),
+          dash::dart_storage<ElementType>::dtype,
+          seg_addrs.data(), gptrs.data()) == DART_OK) {
+      for (size_t s = 0; s < nsegs; ++s) {
+        _allocated.push_back(std::make_pair(lptrs[s], gptrs[s]));
+      }
+    } else {
+      std::fill(gptrs.begin(), gptrs.end(), DART_GPTR_NULL);
+    }
+    DASH_LOG_DEBUG("EpochSynchronizedAllocator.attach(lptrs,nlocal) >");
+    return gptrs;
+  }
+
   /**
    * Unregister local memory segment from global memory space.
    * Does not deallocate local memory.
@@ -0,0 +1,217 @@
+#ifndef DASH__ATOMIC__BATCH_OPERATION_H_
+#define DASH__ATOMIC__BATCH_OPERATION_H_
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/algorithm/Operation.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace dash {
+namespace atomic {
+
+/**
+ * Atomically applies \c binary_op to the elements at the given global
+ * indices of a container of \c dash::Atomic values and the corresponding
+ * operands, e.g. to accumulate a histogram.
+ *
+ * In contrast to calling \c dash::atomic::op for every element, updates
+ * are grouped by owning unit, operands of repeated indices are combined
+ * locally, and a single accumulate operation is issued per target unit,
+ * followed by a single flush.
+ *
+ * The operation blocks until all updates are completed at their target
+ * units.
+ *
+ * \code
+ *  dash::Array<dash::Atomic<int>> histo(nbins);
+ *  std::vector<int> bins   = { 3, 7, 3, 1 };
+ *  std::vector<int> counts = { 1, 1, 1, 1 };
+ *  dash::atomic::batch_op(histo, bins.begin(), bins.end(),
+ *                         counts.begin(), dash::plus<int>());
+ *  // histo[3] += 2, histo[7] += 1, histo[1] += 1
+ * \endcode
+ *
+ * \tparam ContainerT  Container of \c dash::Atomic<T> providing
+ *                     \c pattern() and \c globmem(), e.g. \c dash::Array
+ * \tparam BinaryOp    DART reduce operation such as \c dash::plus<T>,
+ *                     must be associative and commutative
+ */
+template<
+  typename ContainerT,
+  typename IndexIt,
+  typename ValueIt,
+  typename BinaryOp >
+void batch_op(
+  /// Container of atomic values
+  ContainerT & container,
+  /// Iterator to the initial global index of elements to update
+  IndexIt      indices_first,
+  /// Iterator past the final global index of elements to update
+  IndexIt      indices_last,
+  /// Iterator to the operand of the initial index
+  ValueIt      values_first,
+  /// Binary operation to apply
+  BinaryOp     binary_op)
+{
+  typedef typename ContainerT::value_type::value_type value_t;
+  typedef typename ContainerT::pattern_type           pattern_t;
+  typedef typename pattern_t::index_type              index_t;
+  typedef std::pair<std::size_t, value_t>             update_t;
+
+  static_assert(
+      dash::dart_datatype<value_t>::value != DART_TYPE_UNDEFINED,
+      "Basic type required for atomic batch operation");
+  static_assert(
+      dash::internal::dart_reduce_operation<BinaryOp>::value
+        != DART_OP_UNDEFINED,
+      "DART reduce operation required for atomic batch operation");
+
+  auto & pattern = container.pattern();
+  auto   nunits  = pattern.num_units();
+  auto   nupdate = static_cast<std::size_t>(
+                     std::distance(indices_first, indices_last));
+  DASH_LOG_DEBUG("dash::atomic::batch_op()", "updates:", nupdate);
+  if (nupdate == 0 || nunits == 0) {
+    return;
+  }
+
+  // Group updates by owning unit:
+  std::vector<std::size_t> unit_offsets(nunits + 1, 0);
+  std::vector<std::size_t> units(nupdate);
+  std::vector<update_t>    unit_updates(nupdate);
+  auto idx_it = indices_first;
+  auto val_it = values_first;
+  for (std::size_t u = 0; u < nupdate; ++u, ++idx_it, ++val_it) {
+    auto l_pos = pattern.local(static_cast<index_t>(*idx_it));
+    units[u]        = l_pos.unit.id;
+    unit_updates[u] = update_t(l_pos.index, *val_it);
+    ++unit_offsets[units[u] + 1];
+  }
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    unit_offsets[unit + 1] += unit_offsets[unit];
+  }
+  std::vector<update_t> updates(nupdate);
+  {
+    auto unit_pos = unit_offsets;
+    for (std::size_t u = 0; u < nupdate; ++u) {
+      updates[unit_pos[units[u]]++] = unit_updates[u];
+    }
+  }
+  units.clear();
+  unit_updates.clear();
+
+  std::vector<std::size_t> offsets;
+  std::vector<value_t>     operands;
+  dart_gptr_t              gptr = DART_GPTR_NULL;
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    auto u_begin = updates.begin() + unit_offsets[unit];
+    auto u_end   = updates.begin() + unit_offsets[unit + 1];
+    if (u_begin == u_end) {
+      continue;
+    }
+    // Combine operands of repeated indices, target elements of an
+    // indexed accumulate must not overlap:
+    std::stable_sort(u_begin, u_end,
+      [](const update_t & a, const update_t & b) {
+        return std::get<0>(a) < std::get<0>(b);
+      });
+    offsets.clear();
+    operands.clear();
+    for (auto it = u_begin; it != u_end; ++it) {
+      if (!offsets.empty() && offsets.back() == it->first) {
+        operands.back() = binary_op(operands.back(), it->second);
+      } else {
+        offsets.push_back(it->first);
+        operands.push_back(it->second);
+      }
+    }
+    gptr = container.globmem().at(team_unit_t(unit), 0).dart_gptr();
+    DASH_LOG_TRACE("dash::atomic::batch_op", "unit:", unit,
+                   "elements:", offsets.size());
+    DASH_ASSERT_RETURNS(
+      dart_accumulate_indexed(
+        gptr,
+        operands.data(),
+        operands.size(),
+        offsets.data(),
+        dash::dart_datatype<value_t>::value,
+        binary_op.dart_operation()),
+      DART_OK);
+  }
+  DASH_ASSERT_RETURNS(
+    dart_flush_all(gptr),
+    DART_OK);
+  DASH_LOG_DEBUG("dash::atomic::batch_op >");
+}
+
+/**
+ * Atomically adds the given operands to the elements at the given global
+ * indices of a container of \c dash::Atomic values.
+ *
+ * \see dash::atomic::batch_op
+ */
+template<
+  typename ContainerT,
+  typename IndexIt,
+  typename ValueIt >
+void batch_add(
+  /// Container of atomic values
+  ContainerT & container,
+  /// Iterator to the initial global index of elements to update
+  IndexIt      indices_first,
+  /// Iterator past the final global index of elements to update
+  IndexIt      indices_last,
+  /// Iterator to the operand of the initial index
+  ValueIt      values_first)
+{
+  typedef typename ContainerT::value_type::value_type value_t;
+  batch_op(container, indices_first, indices_last, values_first,
+           dash::plus<value_t>());
+}
+
+/**
+ * Atomically adds the operands in \c values to the elements at the
+ * corresponding global indices in \c indices of a container of
+ * \c dash::Atomic values.
+ *
+ * \code
+ *  dash::Array<dash::Atomic<int>> histo(nbins);
+ *  std::vector<int> bins   = { 3, 7, 3, 1 };
+ *  std::vector<int> counts(bins.size(), 1);
+ *  dash::atomic::batch_add(histo, bins, counts);
+ * \endcode
+ *
+ * \see dash::atomic::batch_op
+ */
+template<
+  typename ContainerT,
+  typename IndexRange,
+  typename ValueRange >
+void batch_add(
+  /// Container of atomic values
+  ContainerT       & container,
+  /// Global indices of elements to update
+  const IndexRange & indices,
+  /// Operands to add, one for every index
+  const ValueRange & values)
+{
+  DASH_ASSERT_EQ(
+    std::distance(std::begin(indices), std::end(indices)),
+    std::distance(std::begin(values),  std::end(values)),
+    "dash::atomic::batch_add: number of indices and values differ");
+  batch_add(container, std::begin(indices), std::end(indices),
+            std::begin(values));
+}
+
+} // namespace atomic
+} // namespace dash
+
+#endif // DASH__ATOMIC__BATCH_OPERATION_H_
@@ -24,20 +24,22 @@ public:
 public:
 
   explicit CoEventIter(
-    const gptr_t & pos,
-    Team & team = dash::Team::Null())
+    const gptr_t   & pos,
+    Team           & team   = dash::Team::Null(),
+    coevent_notify   notify = coevent_notify::poll)
   : _team(team),
-    _gptr(pos) {}
+    _gptr(pos),
+    _notify(notify) {}
 
   inline Team & team() {
     return _team;
   }
   inline value_type operator[] (int pos) const {
-    return value_type(_gptr + pos, _team);
+    return value_type(_gptr + pos, _team, _notify);
   }
 
   inline value_type operator* () const {
-    return value_type(_gptr, _team);
+    return value_type(_gptr, _team, _notify);
   }
   /*
    * Comparison operators
@@ -77,7 +79,7 @@ public:
   }
   inline self_t operator ++(int) noexcept {
     auto oldptr = _gptr++;
-    return self_t(oldptr);
+    return self_t(oldptr, _team, _notify);
   }
   inline self_t & operator --() noexcept{
     --_gptr;
@@ -85,18 +87,19 @@ public:
   }
   inline self_t operator --(int) noexcept {
     auto oldptr = _gptr--;
-    return self_t(oldptr);
+    return self_t(oldptr, _team, _notify);
   }
   inline self_t operator +(int i) const noexcept {
-    return self_t(_gptr + i);
+    return self_t(_gptr + i, _team, _notify);
   }
   inline self_t operator -(int i) const noexcept {
-    return self_t(_gptr - i);
+    return self_t(_gptr - i, _team, _notify);
   }
 
 private:
-  Team   & _team = dash::Team::Null();
-  gptr_t   _gptr;
+  Team           & _team = dash::Team::Null();
+  gptr_t           _gptr;
+  coevent_notify   _notify = coevent_notify::poll;
 };
 
 } // namespace coarray
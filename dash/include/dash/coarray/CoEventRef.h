@@ -5,9 +5,41 @@
 #include <dash/GlobPtr.h>
 #include <dash/Atomic.h>
 
+#include <dash/dart/if/dart_communication.h>
+
 namespace dash {
 namespace coarray {
 
+/**
+ * Notification of units waiting for events posted to a \c dash::Coevent.
+ */
+enum class coevent_notify : int {
+  /// Waiting units poll their event counter in local memory
+  poll,
+  /// Every post additionally sends a zero-byte message to the receiving
+  /// unit, waiting units block until the message arrived
+  message
+};
+
+/**
+ * Maximum segment id of event counters of coevents using
+ * \c coevent_notify::message.
+ */
+constexpr int coevent_notify_max_segid = 0x3FFF;
+
+/**
+ * Message tag of event notifications of the coevent with the given event
+ * counters.
+ * Notifications are sent on the communicator of the coevent's team, so
+ * tags only have to be unique within a team. Segment ids of event counters
+ * must be in the range [1, coevent_notify_max_segid], tags are in the range
+ * [16385, 32767] and do not collide with the tag of \c sync_images.
+ */
+inline int coevent_notify_tag(const dart_gptr_t & event_counts)
+{
+  return 0x4000 | event_counts.segid;
+}
+
 class CoEventRef {
 private:
   using self_t      = CoEventRef;
@@ -16,10 +48,12 @@ private:
 
 public:
   explicit CoEventRef(
-    const gptr_t & gptr,
-    Team & team = dash::Team::Null())
+    const gptr_t   & gptr,
+    Team           & team   = dash::Team::Null(),
+    coevent_notify   notify = coevent_notify::poll)
   : _team(team),
-    _gptr(gptr) {}
+    _gptr(gptr),
+    _notify(notify) {}
 
   /**
    * post an event to this unit. This function is thread-safe
@@ -28,6 +62,16 @@ public:
     DASH_LOG_DEBUG("post event to gptr", _gptr);
     GlobRef<event_ctr_t> gref(_gptr);
     gref.add(1);
+    if (_notify == coevent_notify::message) {
+      // The increment is completed, notify the receiving unit:
+      dart_gptr_t dart_gptr = _gptr.dart_gptr();
+      DASH_ASSERT_RETURNS(
+        dart_team_send(
+          nullptr, 0, DART_TYPE_BYTE,
+          coevent_notify_tag(dart_gptr), dart_gptr.teamid,
+          dart_team_unit_t { static_cast<dart_unit_t>(dart_gptr.unitid) }),
+        DART_OK);
+    }
     DASH_LOG_DEBUG("event posted");
   }
 
@@ -51,8 +95,9 @@ public:
   }
 
 private:
-  Team   & _team = dash::Team::All();
-  gptr_t   _gptr;
+  Team           & _team = dash::Team::All();
+  gptr_t           _gptr;
+  coevent_notify   _notify = coevent_notify::poll;
 };
 
 } // namespace coarray
@@ -60,4 +105,3 @@ private:
 
 
 #endif /* DASH__COARRAY__COEVENTREF_H */
-
@@ -3,18 +3,47 @@
 
 #include <dash/dart/if/dart.h>
 
+#include <dash/Exception.h>
 #include <dash/Matrix.h>
 #include <dash/Pattern.h>
 #include <dash/halo/StencilOperator.h>
+#include <dash/internal/Backoff.h>
 #include <dash/memory/GlobStaticMem.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace dash {
 
 namespace halo {
 
+/**
+ * Transfer mode of halo updates
+ */
+enum class HaloUpdateMode : uint8_t {
+  /// Units fetch halo elements from the boundary regions of neighbors
+  PULL,
+  /// Units put their boundary elements into the halo memory of neighbors
+  PUSH
+};
+
+inline std::ostream& operator<<(std::ostream& os, const HaloUpdateMode& mode) {
+  if(mode == HaloUpdateMode::PULL)
+    os << "PULL";
+  else
+    os << "PUSH";
+
+  return os;
+}
+
 /**
  * As known from classic stencil algorithms, *boundaries* are the outermost
  * elements within a block that are requested by neighoring units.
@@ -44,6 +73,23 @@ namespace halo {
  *           |    `-------------------------'    '- halo width in dimension 1
  *           '                  \
  *     halo region 3             '- halo region 7
+ *
+ * Halo regions are updated in one of the modes \ref HaloUpdateMode.
+ * In pull mode (default), units fetch halo elements directly from the
+ * boundary regions of their neighbors. Boundary elements must not be
+ * modified until all neighbors completed their update, which usually
+ * requires a barrier.
+ *
+ * In push mode, units pack their boundary elements into contiguous buffers
+ * and put them into the halo memory of their neighbors, followed by a
+ * notification. Units only synchronize with their actual neighbors:
+ * \c update_async() waits until neighbors consumed the previous update
+ * and \c wait() waits for the notifications of neighbors.
+ * All units have to call \c update_async() and \c wait() the same number
+ * of times.
+ * Push mode requires that the elements of every halo region are owned by
+ * a single unit, construction throws \c dash::exception::InvalidArgument
+ * otherwise.
  */
 
 template <typename MatrixT>
@@ -246,6 +292,22 @@ public:
   HaloMatrixWrapper(MatrixT& matrix, const StencilSpecT&... stencil_spec)
   : HaloMatrixWrapper(matrix, GlobBoundSpec_t(), stencil_spec...) {}
 
+  /**
+   * Constructor that takes \ref Matrix, a \ref GlobalBoundarySpec, the
+   * \ref HaloUpdateMode and a user defined number of stencil specifications
+   * (\ref StencilSpec).
+   *
+   * Collective operation in push mode.
+   */
+  template <typename... StencilSpecT>
+  HaloMatrixWrapper(MatrixT& matrix, const GlobBoundSpec_t& cycle_spec,
+                    HaloUpdateMode update_mode,
+                    const StencilSpecT&... stencil_spec)
+  : HaloMatrixWrapper(matrix, cycle_spec, stencil_spec...) {
+    if(update_mode == HaloUpdateMode::PUSH)
+      init_push();
+  }
+
   HaloMatrixWrapper() = delete;
 
   ~HaloMatrixWrapper() {
@@ -253,8 +315,21 @@ public:
       dart_type_destroy(&dart_type);
     }
     _dart_types.clear();
+
+    if(_update_mode == HaloUpdateMode::PUSH) {
+      // Notifications of neighbors must have been completed before the
+      // halo memory is released:
+      dart_flush_all(_push_gptr);
+      dart_barrier(_matrix.team().dart_id());
+      dart_team_memfree(_push_gptr);
+    }
   }
 
+  /**
+   * Returns the \ref HaloUpdateMode used for halo updates
+   */
+  HaloUpdateMode update_mode() const { return _update_mode; }
+
   /**
    * Returns the underlying \ref HaloBlock
    */
@@ -264,17 +339,18 @@ public:
    * Initiates a blocking halo region update for all halo elements.
    */
   void update() {
-    for(auto& region : _region_data) {
-      update_halo_intern(region.second);
-    }
+    update_async();
     wait();
   }
 
   /**
    * Initiates a blocking halo region update for all halo elements within the
    * the given region.
+   *
+   * Not supported in push mode.
    */
   void update_at(region_index_t index) {
+    check_pull_mode("update_at");
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end()) {
       update_halo_intern(it_find->second);
@@ -284,8 +360,15 @@ public:
 
   /**
    * Initiates an asychronous halo region update for all halo elements.
+   *
+   * In push mode, waits until all neighbors consumed the previous update
+   * before boundary elements are sent.
    */
   void update_async() {
+    if(_update_mode == HaloUpdateMode::PUSH) {
+      push_halos();
+      return;
+    }
     for(auto& region : _region_data) {
       update_halo_intern(region.second);
     }
@@ -294,8 +377,11 @@ public:
   /**
    * Initiates an asychronous halo region update for all halo elements within
    * the given region.
+   *
+   * Not supported in push mode.
    */
   void update_async_at(region_index_t index) {
+    check_pull_mode("update_async_at");
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end()) {
       update_halo_intern(it_find->second);
@@ -307,6 +393,13 @@ public:
    * halo updates.
    */
   void wait() {
+    if(_update_mode == HaloUpdateMode::PUSH) {
+      for(auto& recv : _push_recvs) {
+        wait_push_intern(recv);
+      }
+      dart_flush_local_all(_push_gptr);
+      return;
+    }
     for(auto& region : _region_data) {
       dart_wait_local(&region.second.handle);
     }
@@ -317,9 +410,18 @@ public:
    * Only useful for asynchronous halo updates.
    */
   void wait(region_index_t index) {
+    if(_update_mode == HaloUpdateMode::PUSH) {
+      for(auto& recv : _push_recvs) {
+        if(recv.region == index) {
+          wait_push_intern(recv);
+          dart_flush_local_all(_push_gptr);
+        }
+      }
+      return;
+    }
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end())
-      dart_wait_local(it_find->second.handle);
+      dart_wait_local(&it_find->second.handle);
   }
 
   /**
@@ -460,6 +562,285 @@ private:
     data.get_halos(data.handle);
   }
 
+  void check_pull_mode(const char* func) const {
+    if(_update_mode != HaloUpdateMode::PULL) {
+      DASH_THROW(dash::exception::NotImplemented,
+                 "HaloMatrixWrapper." << func
+                 << " is not supported in push mode");
+    }
+  }
+
+  /**
+   * Request of a unit for the elements of one of its halo regions, stored
+   * in the push memory of the unit owning the elements.
+   */
+  struct PushRequest {
+    bool                                       valid;
+    dart_team_unit_t                           unit;
+    region_index_t                             region;
+    pattern_size_t                             halo_offset;
+    std::array<pattern_index_t, NumDimensions> offsets;
+    std::array<pattern_size_t, NumDimensions>  extents;
+  };
+
+  /**
+   * Boundary elements to push to the halo region of a neighbor.
+   */
+  struct PushSend {
+    dart_team_unit_t                                  unit;
+    region_index_t                                    region;
+    region_index_t                                    slot;
+    pattern_size_t                                    halo_offset;
+    /// Contiguous ranges of elements in local memory as (offset, size)
+    std::vector<std::pair<pattern_size_t, pattern_size_t>> runs;
+    std::vector<Element_t>                            buffer;
+  };
+
+  /**
+   * Halo region filled by a neighbor.
+   */
+  struct PushRecv {
+    dart_team_unit_t unit;
+    region_index_t   region;
+    pattern_size_t   halo_offset;
+    pattern_size_t   size;
+    int64_t          consumed;
+  };
+
+  static constexpr region_index_t opposite_region(region_index_t index) {
+    return RegionCoords<NumDimensions>::MaxIndex - 1 - index;
+  }
+
+  static constexpr size_t align_offset(size_t offset) {
+    return (offset + alignof(std::max_align_t) - 1)
+           / alignof(std::max_align_t) * alignof(std::max_align_t);
+  }
+
+  /*
+   * Layout of the push memory of every unit:
+   *
+   *   | requests[MaxIndex] | signals[MaxIndex] | acks[MaxIndex] | halos |
+   *
+   * Signals count the updates received for every halo region, acks count
+   * the updates consumed by the neighbor in the direction of the region.
+   */
+  static constexpr size_t push_signal_offset(region_index_t index) {
+    return align_offset(sizeof(PushRequest)
+                        * RegionCoords<NumDimensions>::MaxIndex)
+           + index * sizeof(int64_t);
+  }
+
+  static constexpr size_t push_ack_offset(region_index_t index) {
+    return push_signal_offset(RegionCoords<NumDimensions>::MaxIndex)
+           + index * sizeof(int64_t);
+  }
+
+  static constexpr size_t push_halo_offset() {
+    return align_offset(push_ack_offset(RegionCoords<NumDimensions>::MaxIndex));
+  }
+
+  dart_gptr_t push_gptr(dart_team_unit_t unit, size_t offset) const {
+    auto gptr = _push_gptr;
+    dart_gptr_setunit(&gptr, unit);
+    dart_gptr_incaddr(&gptr, offset);
+    return gptr;
+  }
+
+  /**
+   * Sets up the push memory and exchanges requests for the halo regions
+   * with neighbors.
+   */
+  void init_push() {
+    auto& team = _matrix.team();
+    _myid      = team.myid();
+
+    // Every halo region is requested from a single owner. Checked on all
+    // units so construction fails collectively:
+    int32_t multiple_owners     = 0;
+    int32_t any_multiple_owners = 0;
+    for(const auto& region : _haloblock.halo_regions()) {
+      if(region.size() == 0 || region.is_custom_region())
+        continue;
+
+      auto owner = region.begin().lpos().unit;
+      for(auto it = region.begin(); it != region.end(); ++it) {
+        if(it.lpos().unit != owner) {
+          multiple_owners = 1;
+          break;
+        }
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&multiple_owners, &any_multiple_owners, 1,
+                     DART_TYPE_INT, DART_OP_MAX, team.dart_id()),
+      DART_OK);
+    if(any_multiple_owners) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "HaloMatrixWrapper: push mode requires halo regions owned "
+                 "by a single unit");
+    }
+
+    // Push memory is allocated symmetrically and has to provide space for
+    // the largest halo memory:
+    uint64_t halo_size     = _haloblock.halo_size();
+    uint64_t max_halo_size = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&halo_size, &max_halo_size, 1, DART_TYPE_ULONGLONG,
+                     DART_OP_MAX, team.dart_id()),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(
+        team.dart_id(), push_halo_offset() + max_halo_size * sizeof(Element_t),
+        DART_TYPE_BYTE, &_push_gptr),
+      DART_OK);
+    void* addr = nullptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(push_gptr(_myid, 0), &addr), DART_OK);
+    _push_lbegin = static_cast<char*>(addr);
+    std::fill(_push_lbegin, _push_lbegin + push_halo_offset(), 0);
+    team.barrier();
+
+    // Request the elements of every halo region from the unit owning them:
+    for(const auto& region : _haloblock.halo_regions()) {
+      if(region.size() == 0 || region.is_custom_region())
+        continue;
+
+      auto        index = region.index();
+      PushRequest request{};
+      request.valid       = true;
+      request.unit        = _myid;
+      request.region      = index;
+      request.halo_offset = std::distance(
+        _halomemory.begin(), _halomemory.first_element_at(index));
+      request.offsets = region.view().offsets();
+      request.extents = region.view().extents();
+
+      dart_team_unit_t owner(region.begin().lpos().unit);
+      DASH_ASSERT_RETURNS(
+        dart_put_blocking(
+          push_gptr(owner, opposite_region(index) * sizeof(PushRequest)),
+          &request, sizeof(PushRequest), DART_TYPE_BYTE, DART_TYPE_BYTE),
+        DART_OK);
+      _push_recvs.push_back(PushRecv{ owner, index, request.halo_offset,
+                                      region.size(), 0 });
+    }
+    team.barrier();
+
+    // Resolve local offsets of the elements requested by neighbors:
+    const auto* requests = reinterpret_cast<const PushRequest*>(_push_lbegin);
+    for(region_index_t slot = 0; slot < RegionCoords<NumDimensions>::MaxIndex;
+        ++slot) {
+      const auto& request = requests[slot];
+      if(!request.valid)
+        continue;
+
+      ViewSpec_t view(request.offsets, request.extents);
+      typename Region_t::iterator it(&_matrix.begin().globmem(),
+                                     &_matrix.pattern(), view, 0, view.size());
+      PushSend send{ request.unit, request.region, slot, request.halo_offset,
+                     {}, std::vector<Element_t>(view.size()) };
+      for(pattern_size_t i = 0; i < view.size(); ++i, ++it) {
+        pattern_size_t offset = it.lpos().index;
+        if(!send.runs.empty()
+           && send.runs.back().first + send.runs.back().second == offset) {
+          ++send.runs.back().second;
+        } else {
+          send.runs.emplace_back(offset, 1);
+        }
+      }
+      _push_sends.push_back(std::move(send));
+    }
+
+    _update_mode = HaloUpdateMode::PUSH;
+  }
+
+  /**
+   * Waits until the counter at the given offset of the local push memory
+   * reached the given value.
+   * The counter is read from local memory, the window is synchronized
+   * with completed remote updates once polling left the spinning phase.
+   */
+  void wait_push_counter(size_t offset, int64_t value) const {
+    auto lcounter = reinterpret_cast<const volatile int64_t*>(
+                      _push_lbegin + offset);
+    dash::internal::Backoff backoff;
+    while(true) {
+      int64_t current = *lcounter;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if(current >= value)
+        break;
+      if(!backoff.is_spinning()) {
+        DASH_ASSERT_RETURNS(
+          dart_flush(push_gptr(_myid, offset)), DART_OK);
+      }
+      backoff.pause();
+    }
+  }
+
+  /**
+   * Packs boundary elements and puts them into the halo memory of
+   * neighbors, followed by a notification.
+   */
+  void push_halos() {
+    ++_push_generation;
+    if(_push_sends.empty())
+      return;
+
+    const Element_t* lbegin = _matrix.lbegin();
+    for(auto& send : _push_sends) {
+      // The neighbor must have consumed the previous update:
+      wait_push_counter(push_ack_offset(send.slot), _push_generation - 1);
+
+      auto* buffer = send.buffer.data();
+      for(const auto& run : send.runs) {
+        buffer = std::copy(lbegin + run.first, lbegin + run.first + run.second,
+                           buffer);
+      }
+      DASH_ASSERT_RETURNS(
+        dart_put(push_gptr(send.unit, push_halo_offset()
+                                        + send.halo_offset * sizeof(Element_t)),
+                 send.buffer.data(), send.buffer.size() * sizeof(Element_t),
+                 DART_TYPE_BYTE, DART_TYPE_BYTE),
+        DART_OK);
+    }
+    // Halo elements have to be complete at the neighbors before they are
+    // notified:
+    dart_flush_all(_push_gptr);
+    for(const auto& send : _push_sends) {
+      DASH_ASSERT_RETURNS(
+        dart_accumulate(push_gptr(send.unit, push_signal_offset(send.region)),
+                        &_push_one, 1,
+                        dash::dart_punned_datatype<int64_t>::value,
+                        DART_OP_SUM),
+        DART_OK);
+    }
+    dart_flush_local_all(_push_gptr);
+  }
+
+  /**
+   * Waits for the current update of a halo region, copies the received
+   * elements to the halo memory and notifies the neighbor.
+   */
+  void wait_push_intern(PushRecv& recv) {
+    if(recv.consumed >= _push_generation)
+      return;
+
+    wait_push_counter(push_signal_offset(recv.region), _push_generation);
+    const auto* halos = reinterpret_cast<const Element_t*>(
+                          _push_lbegin + push_halo_offset())
+                        + recv.halo_offset;
+    std::copy(halos, halos + recv.size,
+              _halomemory.first_element_at(recv.region));
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(push_gptr(recv.unit,
+                                push_ack_offset(opposite_region(recv.region))),
+                      &_push_one, 1,
+                      dash::dart_punned_datatype<int64_t>::value,
+                      DART_OP_SUM),
+      DART_OK);
+    recv.consumed = _push_generation;
+  }
+
   Element_t* halo_element_at(ElementCoords_t& coords) {
     auto        index     = _haloblock.index_at(_view_local, coords);
     const auto& spec      = _halo_spec.spec(index);
@@ -483,6 +864,14 @@ private:
   HaloMemory_t                   _halomemory;
   std::map<region_index_t, Data> _region_data;
   std::vector<dart_datatype_t>   _dart_types;
+  HaloUpdateMode                 _update_mode = HaloUpdateMode::PULL;
+  team_unit_t                    _myid{ DART_UNDEFINED_UNIT_ID };
+  dart_gptr_t                    _push_gptr   = DART_GPTR_NULL;
+  char*                          _push_lbegin = nullptr;
+  int64_t                        _push_generation = 0;
+  const int64_t                  _push_one        = 1;
+  std::vector<PushSend>          _push_sends;
+  std::vector<PushRecv>          _push_recvs;
 };
 
 }  // namespace halo
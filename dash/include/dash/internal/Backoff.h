@@ -0,0 +1,106 @@
+#ifndef DASH__INTERNAL__BACKOFF_H__INCLUDED
+#define DASH__INTERNAL__BACKOFF_H__INCLUDED
+
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Exponential backoff for polling loops.
+ *
+ * Spins for a number of iterations, then yields the processor and finally
+ * sleeps for exponentially growing intervals up to a maximum interval.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::internal::Backoff backoff;
+ *   while (!condition()) {
+ *     backoff.pause();
+ *   }
+ * \endcode
+ */
+class Backoff
+{
+public:
+  /// Number of iterations spinning before yielding the processor
+  static constexpr unsigned spin_iterations  = 64;
+  /// Number of iterations yielding the processor before sleeping
+  static constexpr unsigned yield_iterations = 16;
+
+public:
+  explicit Backoff(
+    /// Maximum sleep interval
+    std::chrono::microseconds max_sleep = std::chrono::microseconds(1000))
+  : _max_sleep(max_sleep)
+  { }
+
+  /**
+   * Pause the calling thread for the current backoff interval and
+   * increase the interval.
+   */
+  void pause()
+  {
+    unsigned const spin_iter  = spin_iterations;
+    unsigned const yield_iter = spin_iter + yield_iterations;
+    if (_iter < spin_iter) {
+      cpu_relax();
+    } else if (_iter < yield_iter) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(_sleep);
+      _sleep = std::min(_sleep * 2, _max_sleep);
+    }
+    ++_iter;
+  }
+
+  /**
+   * Whether the backoff is in the spinning phase, i.e. the next pause
+   * neither yields the processor nor sleeps.
+   */
+  bool is_spinning() const noexcept
+  {
+    return _iter < spin_iterations;
+  }
+
+  /**
+   * Number of pauses since construction or the last reset.
+   */
+  unsigned count() const noexcept
+  {
+    return _iter;
+  }
+
+  /**
+   * Restart the backoff from the spinning phase.
+   */
+  void reset() noexcept
+  {
+    _iter  = 0;
+    _sleep = std::chrono::microseconds(1);
+  }
+
+private:
+  static inline void cpu_relax() noexcept
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__ ("yield");
+#endif
+  }
+
+private:
+  unsigned                  _iter  = 0;
+  std::chrono::microseconds _sleep { 1 };
+  std::chrono::microseconds _max_sleep;
+};
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__INTERNAL__BACKOFF_H__INCLUDED
@@ -0,0 +1,643 @@
+#ifndef DASH__IO__CHECKPOINT_H__INCLUDED
+#define DASH__IO__CHECKPOINT_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Cartesian.h>
+#include <dash/pattern/PatternProperties.h>
+
+#include <dash/internal/Logging.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace dash {
+namespace io {
+
+/**
+ * Native binary checkpoint format of DASH containers with rectangular
+ * patterns like \c dash::Array and \c dash::Matrix.
+ *
+ * A checkpoint file consists of a header with the pattern metadata
+ * followed by one page-aligned region per unit containing the unit's
+ * local elements in local memory order:
+ *
+ * \code
+ *   header:    magic, version, ndim, element size, number of units,
+ *              memory order, local layout, offset of first region,
+ *   per dim:   extent, block size, team extent, distribution type
+ *   per unit:  region offset, number of elements, local extents
+ *   regions:   local elements of unit 0, unit 1, ...
+ * \endcode
+ *
+ * Units write their region directly from their local memory and, on
+ * restart with identical team size and pattern, read it directly into
+ * their local memory. Otherwise, every unit maps the checkpoint file
+ * and gathers its local elements from the regions of the units that
+ * stored them.
+ *
+ * All operations are collective.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<double> a(size);
+ *   // ...
+ *   dash::io::Checkpoint::write(a, "a.ckpt");
+ *   // ...
+ *   dash::Array<double> b(size, dash::CYCLIC);
+ *   dash::io::Checkpoint::read(b, "a.ckpt");
+ * \endcode
+ */
+class Checkpoint {
+  typedef std::uint64_t word_t;
+
+  static constexpr word_t Magic   = 0x54504b4348534144ULL; // "DASHCKPT"
+  static constexpr word_t Version = 1;
+
+  /// Number of words preceding the dimension entries
+  static constexpr size_t HeadWords = 8;
+  /// Number of words per dimension entry
+  static constexpr size_t DimWords  = 4;
+
+  enum layout_t : word_t {
+    /// Local elements ordered by their local coordinates
+    LayoutCanonical = 0,
+    /// Local elements ordered block-wise
+    LayoutBlocked   = 1
+  };
+
+  /**
+   * Metadata of a checkpoint as stored in the file header.
+   */
+  struct header_t {
+    word_t              ndim;
+    word_t              value_size;
+    word_t              nunits;
+    word_t              memory_order;
+    word_t              layout;
+    word_t              data_offset;
+    std::vector<word_t> extents;
+    std::vector<word_t> blocksizes;
+    std::vector<word_t> team_extents;
+    std::vector<word_t> dist_types;
+    std::vector<word_t> unit_offsets;
+    std::vector<word_t> unit_sizes;
+    /// Local extents of all units, \c ndim entries per unit
+    std::vector<word_t> unit_extents;
+
+    size_t nwords() const {
+      return HeadWords + (ndim * DimWords) + (nunits * (2 + ndim));
+    }
+
+    bool operator==(const header_t & other) const {
+      return ndim         == other.ndim         &&
+             value_size   == other.value_size   &&
+             nunits       == other.nunits       &&
+             memory_order == other.memory_order &&
+             layout       == other.layout       &&
+             extents      == other.extents      &&
+             blocksizes   == other.blocksizes   &&
+             team_extents == other.team_extents &&
+             dist_types   == other.dist_types   &&
+             unit_sizes   == other.unit_sizes   &&
+             unit_extents == other.unit_extents;
+    }
+  };
+
+  static size_t _align_to_page(size_t nbytes) {
+    static const size_t page_size = sysconf(_SC_PAGESIZE);
+    return ((nbytes + page_size - 1) / page_size) * page_size;
+  }
+
+  static void _throw_errno(
+    const std::string & what,
+    const std::string & filename) {
+    DASH_THROW(
+      dash::exception::RuntimeError,
+      "Checkpoint: " << what << " of " << filename << " failed: " <<
+      std::strerror(errno));
+  }
+
+  /**
+   * Closes a file descriptor when leaving the scope.
+   */
+  struct fd_guard_t {
+    int fd;
+
+    explicit fd_guard_t(int file_descriptor)
+    : fd(file_descriptor)
+    { }
+
+    fd_guard_t(const fd_guard_t &)             = delete;
+    fd_guard_t & operator=(const fd_guard_t &) = delete;
+
+    ~fd_guard_t() {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+  };
+
+  /**
+   * Agrees on the outcome of a step of a collective operation before
+   * units synchronize. If the step failed at any unit, all units throw
+   * instead of waiting for the failed units in the next barrier: the
+   * local exception is rethrown at failed units, the other units throw
+   * a \c RuntimeError with the largest errno of the failed units.
+   */
+  static void _agree(
+    dart_team_t          team,
+    std::exception_ptr   error,
+    int                  error_no,
+    const std::string  & what,
+    const std::string  & filename) {
+    int l_errno = 0;
+    if (error) {
+      l_errno = (error_no > 0) ? error_no : EIO;
+    }
+    int g_errno = 0;
+    if (dart_allreduce(&l_errno, &g_errno, 1, DART_TYPE_INT, DART_OP_MAX,
+                       team) != DART_OK) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Checkpoint: dart_allreduce failed while " << what << " " <<
+        filename);
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    if (g_errno != 0) {
+      errno = g_errno;
+      _throw_errno(what + " at another unit", filename);
+    }
+  }
+
+  /**
+   * Metadata of a checkpoint of the specified container.
+   */
+  template <class ContainerT>
+  static header_t _make_header(const ContainerT & container) {
+    typedef typename ContainerT::pattern_type         pattern_t;
+    typedef typename ContainerT::value_type           value_t;
+    typedef typename pattern_t::size_type             extent_t;
+    typedef dash::pattern_layout_traits<pattern_t>    layout_traits;
+
+    constexpr dim_t ndim    = pattern_t::ndim();
+    const pattern_t & pattern = container.pattern();
+
+    header_t header;
+    header.ndim         = ndim;
+    header.value_size   = sizeof(value_t);
+    header.nunits       = pattern.team().size();
+    header.memory_order = (pattern_t::memory_order() == ROW_MAJOR) ? 0 : 1;
+    header.layout       = layout_traits::type::blocked
+                          ? LayoutBlocked
+                          : LayoutCanonical;
+    for (dim_t d = 0; d < ndim; ++d) {
+      header.extents.push_back(pattern.extent(d));
+      header.blocksizes.push_back(pattern.blocksize(d));
+      header.team_extents.push_back(pattern.teamspec().extent(d));
+      header.dist_types.push_back(pattern.distspec()[d].type);
+    }
+    size_t offset = _align_to_page(header.nwords() * sizeof(word_t));
+    header.data_offset = offset;
+    for (size_t u = 0; u < header.nunits; ++u) {
+      std::array<extent_t, ndim> l_extents =
+        pattern.local_extents(team_unit_t(u));
+      size_t l_size = pattern.local_size(team_unit_t(u));
+      header.unit_offsets.push_back(offset);
+      header.unit_sizes.push_back(l_size);
+      header.unit_extents.insert(
+        header.unit_extents.end(), l_extents.begin(), l_extents.end());
+      offset += _align_to_page(l_size * sizeof(value_t));
+    }
+    return header;
+  }
+
+  static std::vector<word_t> _serialize(const header_t & header) {
+    std::vector<word_t> words = {
+      Magic, Version,
+      header.ndim, header.value_size, header.nunits,
+      header.memory_order, header.layout, header.data_offset
+    };
+    for (size_t d = 0; d < header.ndim; ++d) {
+      words.push_back(header.extents[d]);
+      words.push_back(header.blocksizes[d]);
+      words.push_back(header.team_extents[d]);
+      words.push_back(header.dist_types[d]);
+    }
+    for (size_t u = 0; u < header.nunits; ++u) {
+      words.push_back(header.unit_offsets[u]);
+      words.push_back(header.unit_sizes[u]);
+      words.insert(
+        words.end(),
+        header.unit_extents.begin() + (u * header.ndim),
+        header.unit_extents.begin() + ((u + 1) * header.ndim));
+    }
+    return words;
+  }
+
+  static header_t _read_header(int fd, const std::string & filename) {
+    word_t head[HeadWords];
+    if (pread(fd, head, sizeof(head), 0) != sizeof(head) ||
+        head[0] != Magic) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Checkpoint: " << filename << " is not a DASH checkpoint");
+    }
+    if (head[1] != Version) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Checkpoint: unsupported version " << head[1] << " of " <<
+        filename);
+    }
+    header_t header;
+    header.ndim         = head[2];
+    header.value_size   = head[3];
+    header.nunits       = head[4];
+    header.memory_order = head[5];
+    header.layout       = head[6];
+    header.data_offset  = head[7];
+
+    std::vector<word_t> words(header.nwords() - HeadWords);
+    ssize_t nbytes = words.size() * sizeof(word_t);
+    if (pread(fd, words.data(), nbytes, sizeof(head)) != nbytes) {
+      _throw_errno("reading header", filename);
+    }
+    auto it = words.begin();
+    for (size_t d = 0; d < header.ndim; ++d) {
+      header.extents.push_back(*it++);
+      header.blocksizes.push_back(*it++);
+      header.team_extents.push_back(*it++);
+      header.dist_types.push_back(*it++);
+    }
+    for (size_t u = 0; u < header.nunits; ++u) {
+      header.unit_offsets.push_back(*it++);
+      header.unit_sizes.push_back(*it++);
+      header.unit_extents.insert(
+        header.unit_extents.end(), it, it + header.ndim);
+      it += header.ndim;
+    }
+    return header;
+  }
+
+  static void _pwrite_all(
+    int                 fd,
+    const void        * buf,
+    size_t              nbytes,
+    off_t               offset,
+    const std::string & filename) {
+    const char * data = static_cast<const char *>(buf);
+    while (nbytes > 0) {
+      ssize_t ret = pwrite(fd, data, nbytes, offset);
+      if (ret < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        _throw_errno("pwrite", filename);
+      }
+      data   += ret;
+      nbytes -= ret;
+      offset += ret;
+    }
+  }
+
+  static void _pread_all(
+    int                 fd,
+    void              * buf,
+    size_t              nbytes,
+    off_t               offset,
+    const std::string & filename) {
+    char * data = static_cast<char *>(buf);
+    while (nbytes > 0) {
+      ssize_t ret = pread(fd, data, nbytes, offset);
+      if (ret < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        _throw_errno("pread", filename);
+      }
+      if (ret == 0) {
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "Checkpoint: unexpected end of file " << filename);
+      }
+      data   += ret;
+      nbytes -= ret;
+      offset += ret;
+    }
+  }
+
+  /**
+   * Position of the element at the given global coordinates in the
+   * checkpoint file, relative to the beginning of the first region.
+   */
+  template <typename IndexT, size_t NDim>
+  static size_t _file_offset(
+    const header_t                  & header,
+    const std::array<IndexT, NDim>  & g_coords) {
+    std::array<size_t, NDim> unit_coords;
+    std::array<size_t, NDim> l_coords;
+    for (size_t d = 0; d < NDim; ++d) {
+      size_t bs       = header.blocksizes[d];
+      size_t g_block  = g_coords[d] / bs;
+      unit_coords[d]  = g_block % header.team_extents[d];
+      l_coords[d]     = (g_block / header.team_extents[d]) * bs +
+                        (g_coords[d] % bs);
+    }
+    // Team specs are always arranged in row major order:
+    size_t unit = _linearize<NDim>(
+                    unit_coords, header.team_extents.data(), true);
+    const word_t * l_extents = header.unit_extents.data() + (unit * NDim);
+    bool           row_major = (header.memory_order == 0);
+    size_t l_offset;
+    if (header.layout == LayoutBlocked) {
+      // Blocks are stored consecutively, elements within a block are
+      // ordered by their phase:
+      std::array<size_t, NDim> l_block_coords;
+      std::array<size_t, NDim> phase_coords;
+      std::array<word_t, NDim> l_nblocks;
+      size_t block_size = 1;
+      for (size_t d = 0; d < NDim; ++d) {
+        size_t bs         = header.blocksizes[d];
+        l_block_coords[d] = l_coords[d] / bs;
+        phase_coords[d]   = l_coords[d] % bs;
+        l_nblocks[d]      = (l_extents[d] + bs - 1) / bs;
+        block_size       *= bs;
+      }
+      l_offset = _linearize<NDim>(
+                   l_block_coords, l_nblocks.data(), row_major)
+                   * block_size +
+                 _linearize<NDim>(
+                   phase_coords, header.blocksizes.data(), row_major);
+    } else {
+      l_offset = _linearize<NDim>(l_coords, l_extents, row_major);
+    }
+    return header.unit_offsets[unit] - header.data_offset +
+           (l_offset * header.value_size);
+  }
+
+  template <size_t NDim>
+  static size_t _linearize(
+    const std::array<size_t, NDim>  & coords,
+    const word_t                    * extents,
+    bool                              row_major) {
+    size_t offset = 0;
+    if (row_major) {
+      for (size_t d = 0; d < NDim; ++d) {
+        offset = offset * extents[d] + coords[d];
+      }
+    } else {
+      for (size_t d = NDim; d > 0; --d) {
+        offset = offset * extents[d-1] + coords[d-1];
+      }
+    }
+    return offset;
+  }
+
+  /**
+   * Whether elements of the checkpoint can be located by their global
+   * coordinates, i.e. the regular mapping of blocks to units assumed in
+   * \c _file_offset is consistent with the stored local extents.
+   */
+  static bool _is_regular(const header_t & header) {
+    size_t team_size = 1;
+    for (size_t d = 0; d < header.ndim; ++d) {
+      team_size *= header.team_extents[d];
+    }
+    if (team_size != header.nunits) {
+      return false;
+    }
+    std::vector<size_t> unit_coords(header.ndim, 0);
+    for (size_t u = 0; u < header.nunits; ++u) {
+      for (size_t d = 0; d < header.ndim; ++d) {
+        size_t bs        = header.blocksizes[d];
+        size_t nunits_d  = header.team_extents[d];
+        size_t nblocks   = (header.extents[d] + bs - 1) / bs;
+        size_t uc        = unit_coords[d];
+        // Number of blocks of the unit and size of its last block:
+        size_t l_nblocks = (nblocks / nunits_d) +
+                           ((uc < nblocks % nunits_d) ? 1 : 0);
+        size_t l_extent  = l_nblocks * bs;
+        if (l_nblocks > 0 && (l_nblocks - 1) * nunits_d + uc ==
+                             nblocks - 1) {
+          l_extent -= (nblocks * bs) - header.extents[d];
+        }
+        if (header.unit_extents[(u * header.ndim) + d] != l_extent) {
+          return false;
+        }
+      }
+      // Advance unit coordinates in row major order of the team spec:
+      for (size_t d = header.ndim; d > 0; --d) {
+        if (++unit_coords[d-1] < header.team_extents[d-1]) { break; }
+        unit_coords[d-1] = 0;
+      }
+    }
+    return true;
+  }
+
+public:
+  /**
+   * Store the elements of a container in a checkpoint file.
+   * Every unit writes its local elements directly from local memory.
+   *
+   * Collective operation.
+   *
+   * \param  container  Container to store, e.g. \c dash::Array or
+   *                    \c dash::Matrix
+   * \param  filename   Path of the checkpoint file, existing files are
+   *                    overwritten
+   */
+  template <class ContainerT>
+  static void write(
+    ContainerT        & container,
+    const std::string & filename)
+  {
+    typedef typename ContainerT::value_type value_t;
+    static_assert(std::is_trivially_copyable<value_t>::value,
+                  "Checkpoint requires trivially copyable element type");
+
+    DASH_LOG_DEBUG("Checkpoint.write()", filename);
+    auto     & team   = container.team();
+    header_t   header = _make_header(container);
+    size_t     myid   = team.myid();
+
+    // wait for pending writes to local elements:
+    container.barrier();
+
+    // Unit 0 creates the file and writes the header. All units agree
+    // on its outcome so all units fail if the file could not be created
+    // instead of waiting for unit 0 in the barrier:
+    std::exception_ptr error;
+    int                error_no = 0;
+    if (myid == 0) {
+      try {
+        fd_guard_t file(
+          open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+        if (file.fd < 0) {
+          _throw_errno("open", filename);
+        }
+        std::vector<word_t> words = _serialize(header);
+        _pwrite_all(file.fd, words.data(), words.size() * sizeof(word_t),
+                    0, filename);
+        size_t file_size = header.unit_offsets.back() +
+                           _align_to_page(
+                             header.unit_sizes.back() * sizeof(value_t));
+        if (ftruncate(file.fd, file_size) != 0) {
+          _throw_errno("ftruncate", filename);
+        }
+      } catch (...) {
+        error_no = errno;
+        error    = std::current_exception();
+      }
+    }
+    _agree(team.dart_id(), error, error_no, "writing header", filename);
+    team.barrier();
+
+    try {
+      fd_guard_t file(open(filename.c_str(), O_WRONLY));
+      if (file.fd < 0) {
+        _throw_errno("open", filename);
+      }
+      _pwrite_all(file.fd, container.lbegin(),
+                  header.unit_sizes[myid] * sizeof(value_t),
+                  header.unit_offsets[myid], filename);
+      if (fsync(file.fd) != 0) {
+        _throw_errno("fsync", filename);
+      }
+    } catch (...) {
+      error_no = errno;
+      error    = std::current_exception();
+    }
+    _agree(team.dart_id(), error, error_no, "writing local elements",
+           filename);
+
+    team.barrier();
+    DASH_LOG_DEBUG("Checkpoint.write >");
+  }
+
+  /**
+   * Restore the elements of an allocated container from a checkpoint
+   * file.
+   * If the checkpoint has been written by a container with identical
+   * pattern and team size, every unit reads its region directly into
+   * local memory. Otherwise, elements are gathered from the memory-mapped
+   * checkpoint file.
+   *
+   * Collective operation.
+   *
+   * \param  container  Container to restore, must have the same extents
+   *                    and element type as the stored container
+   * \param  filename   Path of the checkpoint file
+   *
+   * \return  \c true if local memory has been restored from the unit's
+   *          region directly, \c false if elements have been
+   *          redistributed
+   */
+  template <class ContainerT>
+  static bool read(
+    ContainerT        & container,
+    const std::string & filename)
+  {
+    typedef typename ContainerT::pattern_type pattern_t;
+    typedef typename ContainerT::value_type   value_t;
+    typedef typename pattern_t::index_type    index_t;
+    static_assert(std::is_trivially_copyable<value_t>::value,
+                  "Checkpoint requires trivially copyable element type");
+
+    constexpr dim_t ndim = pattern_t::ndim();
+
+    DASH_LOG_DEBUG("Checkpoint.read()", filename);
+    const pattern_t & pattern = container.pattern();
+    size_t            myid    = container.team().myid();
+
+    bool               in_place = false;
+    std::exception_ptr error;
+    int                error_no = 0;
+    try {
+      fd_guard_t file(open(filename.c_str(), O_RDONLY));
+      if (file.fd < 0) {
+        _throw_errno("open", filename);
+      }
+      header_t stored = _read_header(file.fd, filename);
+      header_t actual = _make_header(container);
+
+      if (stored.ndim != actual.ndim || stored.extents != actual.extents ||
+          stored.value_size != actual.value_size) {
+        DASH_THROW(
+          dash::exception::InvalidArgument,
+          "Checkpoint: extents or element type of " << filename <<
+          " differ from container");
+      }
+
+      in_place = (stored == actual);
+      if (in_place) {
+        DASH_LOG_DEBUG("Checkpoint.read", "reading local region in place");
+        _pread_all(file.fd, container.lbegin(),
+                   stored.unit_sizes[myid] * sizeof(value_t),
+                   stored.unit_offsets[myid], filename);
+      } else {
+        DASH_LOG_DEBUG("Checkpoint.read", "redistributing elements");
+        if (!_is_regular(stored)) {
+          DASH_THROW(
+            dash::exception::NotImplemented,
+            "Checkpoint: cannot redistribute irregular pattern of " <<
+            filename);
+        }
+        size_t data_size = stored.unit_offsets.back() +
+                           _align_to_page(
+                             stored.unit_sizes.back() * sizeof(value_t)) -
+                           stored.data_offset;
+        void * data = nullptr;
+        if (data_size > 0) {
+          data = mmap(nullptr, data_size, PROT_READ, MAP_SHARED, file.fd,
+                      stored.data_offset);
+          if (data == MAP_FAILED) {
+            _throw_errno("mmap", filename);
+          }
+        }
+        const char * regions = static_cast<const char *>(data);
+        value_t    * lbegin  = container.lbegin();
+        size_t       lsize   = pattern.local_size();
+        for (size_t l = 0; l < lsize; ++l) {
+          std::array<index_t, ndim> g_coords =
+            pattern.coords(pattern.global(static_cast<index_t>(l)));
+          std::memcpy(lbegin + l,
+                      regions + _file_offset(stored, g_coords),
+                      sizeof(value_t));
+        }
+        if (data != nullptr) {
+          munmap(data, data_size);
+        }
+      }
+    } catch (...) {
+      error_no = errno;
+      error    = std::current_exception();
+    }
+    _agree(container.team().dart_id(), error, error_no, "reading",
+           filename);
+
+    container.barrier();
+    DASH_LOG_DEBUG("Checkpoint.read >", in_place);
+    return in_place;
+  }
+};
+
+} // namespace io
+} // namespace dash
+
+#endif // DASH__IO__CHECKPOINT_H__INCLUDED
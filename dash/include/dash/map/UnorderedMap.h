@@ -8,6 +8,7 @@
 #include <dash/Array.h>
 #include <dash/Allocator.h>
 #include <dash/Meta.h>
+#include <dash/Onesided.h>
 
 #include <dash/memory/GlobHeapMem.h>
 
@@ -16,6 +17,7 @@
 #include <dash/map/UnorderedMapLocalRef.h>
 #include <dash/map/UnorderedMapLocalIter.h>
 #include <dash/map/UnorderedMapGlobIter.h>
+#include <dash/map/UnorderedMapIndex.h>
 
 #include <iterator>
 #include <utility>
@@ -168,6 +170,13 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+  typedef dash::internal::UnorderedMapIndex<Key, Pred, size_type>
+    key_index_type;
+  typedef typename key_index_type::slot_type
+    key_index_slot;
+  typedef dash::Array<key_index_slot>
+    key_index_map;
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -194,6 +203,14 @@ private:
   std::vector<iterator>  _move_elements;
   /// Global pointer to local element in _local_sizes.
   dart_gptr_t            _local_size_gptr = DART_GPTR_NULL;
+  /// Hash index of the elements in local memory space, mapping keys to
+  /// local offsets.
+  key_index_type         _local_index;
+  /// Hash indices of all units as published in the last commit, every
+  /// unit's index consists of _key_index_lcap slots.
+  key_index_map          _key_index;
+  /// Number of slots in every unit's published hash index.
+  size_type              _key_index_lcap  = 0;
   /// Hash type for mapping of key to unit and local offset.
   hasher                 _key_hash;
   /// Predicate for key comparison.
@@ -301,6 +318,8 @@ public:
     DASH_LOG_TRACE("UnorderedMap.barrier", "new size:", new_size);
     DASH_ASSERT_EQ(_remote_size, new_size - _local_sizes.local[0],
                    "invalid size after global commit");
+    // Publish local hash index for key lookups of remote units:
+    _publish_key_index();
     _begin = iterator(this, 0);
     _end   = iterator(this, new_size);
     DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
@@ -347,6 +366,13 @@ public:
     _local_sizes.local[0] = 0;
     _local_size_gptr      = _local_sizes[_myid].dart_gptr();
 
+    // Initialize empty hash indices:
+    _local_index    = key_index_type(_key_equal);
+    _key_index_lcap = key_index_type::next_capacity(0);
+    _key_index.allocate(_team->size() * _key_index_lcap,
+                        dash::BLOCKED, *_team);
+    _local_index.rehash_to(_key_index.lbegin(), _key_index_lcap);
+
     // Global iterators:
     _begin       = iterator(this, 0);
     _end         = _begin;
@@ -393,6 +419,7 @@ public:
     }
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
     _local_sizes.local[0] = 0;
+    _local_index.clear();
     _remote_size          = 0;
     _begin                = iterator();
     _end                  = _begin;
@@ -582,14 +609,22 @@ public:
     return nelem;
   }
 
+  /**
+   * Iterator to the element with the specified key, or \c end() if no
+   * such element exists.
+   *
+   * Elements inserted by the calling unit are resolved in its local hash
+   * index. Otherwise, only the index of the unit mapped to the key by the
+   * hash function is probed, usually with a single one-sided read.
+   * For hash functions not mapping keys to their owning unit (see
+   * \c dash::hash_maps_key_to_owner), the indices of all units are probed.
+   *
+   * \complexity  O(1) expected
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    iterator found = _find(key);
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -597,11 +632,7 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    const_iterator found = _find(key);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
@@ -655,11 +686,128 @@ public:
     //       multiple calls of globmem.grow(_local_buffer_size).
     //       Could be optimized to allocate additional memory in a single call
     //       of globmem.grow(std::distance(first,last)).
+    //       See bulk_insert for a collective variant.
     for (auto it = first; it != last; ++it) {
       insert(*it);
     }
   }
 
+  /**
+   * Inserts the elements in the specified range at the units their keys
+   * are mapped to by the hash function. Elements with keys already
+   * contained in the map are not inserted.
+   *
+   * Collective operation. Elements are binned by target unit locally, the
+   * space for every bin at its target unit is reserved in a single atomic
+   * fetch-and-add and every bin is transferred in a single put.
+   * Inserted elements are committed to global memory, as in
+   * \c barrier().
+   *
+   * \complexity  O(n) local operations and O(p) one-sided operations
+   *              for \c n elements in the range and \c p units
+   */
+  template<class InputIterator>
+  void bulk_insert(
+    // Iterator at first value in the range to insert.
+    InputIterator first,
+    // Iterator past the last value in the range to insert.
+    InputIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert()");
+    auto const nunits = _team->size();
+
+    // Bin elements by target unit:
+    std::vector<std::vector<value_type>> unit_bins(nunits);
+    for (auto it = first; it != last; ++it) {
+      team_unit_t unit = _key_hash(it->first);
+      DASH_ASSERT_RANGE(0, unit.id, nunits - 1, "invalid target unit");
+      unit_bins[unit.id].push_back(*it);
+    }
+
+    // Number of elements received by every unit, written by remote units:
+    dash::Array<size_type> recv_sizes(nunits, dash::BLOCKED, *_team);
+    recv_sizes.local[0] = 0;
+    recv_sizes.barrier();
+
+    // Reserve space for every bin at its target unit:
+    std::vector<size_type> recv_offsets(nunits, 0);
+    for (team_unit_t unit{0}; unit < nunits; ++unit) {
+      auto nsend = unit_bins[unit.id].size();
+      if (nsend > 0 && unit != _myid) {
+        recv_offsets[unit.id] = GlobRef<Atomic<size_type>>(
+                               recv_sizes[unit.id].dart_gptr()
+                             ).fetch_add(nsend);
+      }
+    }
+    recv_sizes.barrier();
+
+    // Allocate receive buffers, symmetric in size:
+    size_type lrecv_size = recv_sizes.local[0];
+    size_type max_recv_size;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &lrecv_size,
+        &max_recv_size,
+        1,
+        dash::dart_datatype<size_type>::value,
+        DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert",
+                   "local elements received:", lrecv_size,
+                   "max. elements received:",  max_recv_size);
+
+    if (max_recv_size > 0) {
+      dart_gptr_t recv_gptr = DART_GPTR_NULL;
+      DASH_ASSERT_RETURNS(
+        dart_team_memalloc_aligned(
+          _team->dart_id(),
+          max_recv_size * sizeof(value_type),
+          DART_TYPE_BYTE,
+          &recv_gptr),
+        DART_OK);
+
+      // Transfer every bin in a single put:
+      for (team_unit_t unit{0}; unit < nunits; ++unit) {
+        auto const & bin = unit_bins[unit.id];
+        if (bin.empty() || unit == _myid) {
+          continue;
+        }
+        dart_gptr_t gptr = recv_gptr;
+        DASH_ASSERT_RETURNS(
+          dart_gptr_setunit(&gptr, unit),
+          DART_OK);
+        DASH_ASSERT_RETURNS(
+          dart_gptr_incaddr(
+            &gptr, recv_offsets[unit.id] * sizeof(value_type)),
+          DART_OK);
+        dash::internal::put(gptr, bin.data(), bin.size());
+      }
+      DASH_ASSERT_RETURNS(dart_flush_all(recv_gptr), DART_OK);
+      _team->barrier();
+
+      dart_gptr_t lrecv_gptr = recv_gptr;
+      DASH_ASSERT_RETURNS(
+        dart_gptr_setunit(&lrecv_gptr, _myid),
+        DART_OK);
+      value_type * lrecv = nullptr;
+      DASH_ASSERT_RETURNS(
+        dart_gptr_getaddr(lrecv_gptr, reinterpret_cast<void **>(&lrecv)),
+        DART_OK);
+      _insert_local(lrecv, lrecv + lrecv_size);
+
+      _team->barrier();
+      DASH_ASSERT_RETURNS(dart_team_memfree(recv_gptr), DART_OK);
+    }
+
+    auto const & lbin = unit_bins[_myid.id];
+    _insert_local(lbin.data(), lbin.data() + lbin.size());
+
+    // Commit inserted elements:
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert >", "size:", size());
+  }
+
   iterator erase(
     const_iterator position)
   {
@@ -718,6 +866,112 @@ public:
   }
 
 private:
+  /**
+   * Resolves the element with the specified key in the local hash index
+   * and in the published hash indices of remote units.
+   */
+  iterator _find(const key_type & key) const
+  {
+    auto self = const_cast<self_t *>(this);
+    auto lpos = _local_index.find(key);
+    if (lpos != key_index_type::npos) {
+      return iterator(self, _myid, lpos);
+    }
+    if (dash::hash_maps_key_to_owner<hasher>::value) {
+      team_unit_t unit = self->_key_hash(key);
+      if (unit != _myid) {
+        lpos = _find_remote(unit, key);
+        if (lpos != key_index_type::npos) {
+          return iterator(self, unit, lpos);
+        }
+      }
+      return _end;
+    }
+    for (team_unit_t unit{0}; unit < _team->size(); ++unit) {
+      if (unit == _myid) {
+        continue;
+      }
+      lpos = _find_remote(unit, key);
+      if (lpos != key_index_type::npos) {
+        return iterator(self, unit, lpos);
+      }
+    }
+    return _end;
+  }
+
+  /**
+   * Probes the published hash index of the specified unit for the given
+   * key. Slots are read in contiguous windows, so a lookup usually
+   * requires a single one-sided get.
+   *
+   * \returns  The local offset of the element at the unit or
+   *           \c key_index_type::npos if the key is not found.
+   */
+  size_type _find_remote(
+    team_unit_t      unit,
+    const key_type & key) const
+  {
+    // Number of slots read in a single get:
+    constexpr size_type probe_window = 8;
+    key_index_slot      slots[probe_window];
+
+    auto const nslots = _key_index_lcap;
+    auto       slot   = key_index_type::probe_begin(key, nslots);
+    size_type  nprobe = 0;
+    while (nprobe < nslots) {
+      auto nget = std::min(probe_window, nslots - slot);
+      auto gptr = (_key_index.begin() + (unit.id * nslots + slot)).dart_gptr();
+      DASH_LOG_TRACE("UnorderedMap._find_remote", "unit:", unit,
+                     "slot:", slot, "nslots:", nget);
+      dash::internal::get_blocking(gptr, slots, nget);
+      for (size_type s = 0; s < nget; ++s) {
+        if (slots[s].lpos_1 == 0) {
+          return key_index_type::npos;
+        }
+        if (_key_equal(slots[s].key, key)) {
+          return slots[s].lpos_1 - 1;
+        }
+      }
+      nprobe += nget;
+      slot    = (slot + nget) & (nslots - 1);
+    }
+    return key_index_type::npos;
+  }
+
+  /**
+   * Copies the local hash index to global memory such that it can be
+   * probed by remote units. Collective operation, the capacity of all
+   * units' indices is increased to the largest capacity required by any
+   * unit.
+   */
+  void _publish_key_index()
+  {
+    DASH_LOG_TRACE("UnorderedMap._publish_key_index()");
+    size_type lcap = key_index_type::next_capacity(_local_index.size());
+    size_type gcap = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &lcap,
+        &gcap,
+        1,
+        dash::dart_datatype<size_type>::value,
+        DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    if (gcap > _key_index_lcap) {
+      DASH_LOG_TRACE("UnorderedMap._publish_key_index",
+                     "resize index from", _key_index_lcap, "to", gcap);
+      _key_index.deallocate();
+      _key_index_lcap = gcap;
+      _key_index.allocate(_team->size() * _key_index_lcap,
+                          dash::BLOCKED, *_team);
+    }
+    _local_index.rehash_to(_key_index.lbegin(), _key_index_lcap);
+    _key_index.barrier();
+    DASH_LOG_TRACE("UnorderedMap._publish_key_index >",
+                   "index capacity:", _key_index_lcap);
+  }
+
   /**
    * Helper to resolve address of mapped value from map entries.
    *
@@ -781,6 +1035,61 @@ private:
                    "lptr to mapped:", lptr_mapped);
   }
 
+  /**
+   * Inserts the values in the specified range at the local unit, growing
+   * the local memory space at most once. Values with keys already
+   * contained in the local memory space are not inserted.
+   */
+  void _insert_local(
+    const value_type * first,
+    const value_type * last)
+  {
+    DASH_LOG_TRACE("UnorderedMap._insert_local()",
+                   "nvalues:", std::distance(first, last));
+    // Filter keys already contained in the map or occurring more than
+    // once in the range:
+    key_index_type             insert_keys(_key_equal);
+    std::vector<const value_type *> insert_values;
+    for (auto it = first; it != last; ++it) {
+      if (_local_index.find(it->first)  == key_index_type::npos &&
+          insert_keys.find(it->first)  == key_index_type::npos) {
+        insert_keys.insert(it->first, insert_values.size());
+        insert_values.push_back(it);
+      }
+    }
+    size_type ninsert = insert_values.size();
+    if (ninsert == 0) {
+      DASH_LOG_TRACE("UnorderedMap._insert_local >", "no values inserted");
+      return;
+    }
+    // Reserve storage for all new elements:
+    size_type old_local_size = GlobRef<Atomic<size_type>>(
+                                 _local_size_gptr
+                               ).fetch_add(ninsert);
+    size_type new_local_size = old_local_size + ninsert;
+    size_type local_capacity = _globmem->local_size();
+    _local_cumul_sizes[_myid] += ninsert;
+    if (new_local_size > local_capacity) {
+      DASH_LOG_TRACE("UnorderedMap._insert_local",
+                     "globmem.grow(", new_local_size - local_capacity, ")");
+      _globmem->grow(std::max(new_local_size - local_capacity,
+                              _local_buffer_size));
+    }
+    auto lptr_insert = _globmem->lbegin() + old_local_size;
+    for (size_type i = 0; i < ninsert; ++i, ++lptr_insert) {
+      // Using placement new to avoid assignment/copy as value_type is
+      // const:
+      new (static_cast<value_type *>(lptr_insert))
+        value_type(*insert_values[i]);
+      _local_index.insert(insert_values[i]->first, old_local_size + i);
+    }
+    _begin = iterator(this, 0);
+    _end   = iterator(this, size());
+    _lend  = _lbegin + new_local_size;
+    DASH_LOG_TRACE("UnorderedMap._insert_local >",
+                   "inserted:", ninsert, "local size:", new_local_size);
+  }
+
   /**
    * Insert value at specified unit.
    */
@@ -827,6 +1136,7 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
+    _local_index.insert(value.first, old_local_size);
     // Convert local iterator to global iterator:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
                    "unit:", unit, "lidx:", old_local_size);
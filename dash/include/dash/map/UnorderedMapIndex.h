@@ -0,0 +1,329 @@
+#ifndef DASH__MAP__UNORDERED_MAP_INDEX_H__INCLUDED
+#define DASH__MAP__UNORDERED_MAP_INDEX_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/internal/Logging.h>
+
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace dash {
+
+template<typename Key>
+class HashLocal;
+
+/**
+ * Type trait indicating whether a hash function of a \c dash::UnorderedMap
+ * maps every key to the unit that stores the element with this key.
+ *
+ * Element lookup then only has to query the index of the owning unit.
+ * Otherwise, the indices of all units are queried.
+ */
+template<typename Hash>
+struct hash_maps_key_to_owner : public std::true_type
+{ };
+
+/**
+ * Keys are always mapped to the calling unit by \c dash::HashLocal,
+ * independent from the unit that inserted the element.
+ */
+template<typename Key>
+struct hash_maps_key_to_owner< dash::HashLocal<Key> >
+: public std::false_type
+{ };
+
+namespace internal {
+
+/**
+ * Slot in the open-addressing index of a \c dash::UnorderedMap.
+ *
+ * Slots are stored in global memory and must therefore satisfy the
+ * requirements of DASH container elements.
+ */
+template<typename Key, typename SizeType>
+struct UnorderedMapIndexSlot
+{
+  /// Key of the indexed element.
+  Key      key;
+  /// Local offset of the indexed element, increased by 1. Unused slots have
+  /// value 0.
+  SizeType lpos_1;
+};
+
+/**
+ * Whether \c std::hash is enabled for the given key type, i.e. the key
+ * type is arithmetic, an enum or \c std::hash has been specialized for
+ * it.
+ */
+template<typename Key, typename Enable = void>
+struct is_std_hashable : public std::false_type
+{ };
+
+template<typename Key>
+struct is_std_hashable<
+  Key,
+  typename std::enable_if<
+    std::is_default_constructible< std::hash<Key> >::value &&
+    std::is_convertible<
+      decltype(std::declval< const std::hash<Key> & >()(
+                 std::declval<const Key &>())),
+      std::size_t
+    >::value
+  >::type >
+: public std::true_type
+{ };
+
+/**
+ * Default hash of map keys used to determine the initial probe position
+ * in the index of a unit.
+ * Uses \c std::hash if it is enabled for the key type and the object
+ * representation of the key otherwise.
+ *
+ * Keys compared equal must have identical hash values. Hashing the
+ * object representation therefore requires keys to be compared by
+ * \c std::equal_to and, if supported by the standard library, keys
+ * with equal values to have identical object representations, i.e. no
+ * padding bits. Specialize \c std::hash for other key types.
+ */
+template<
+  typename Key,
+  typename Pred,
+  typename Enable = void >
+struct unordered_map_index_hash
+{
+  static_assert(
+    std::is_same<Pred, std::equal_to<Key>>::value,
+    "Keys of dash::UnorderedMap compared by a custom predicate require a "
+    "specialization of std::hash");
+#if defined(__cpp_lib_has_unique_object_representations)
+  static_assert(
+    std::has_unique_object_representations<Key>::value,
+    "Keys of dash::UnorderedMap with padding bits require a "
+    "specialization of std::hash");
+#endif
+
+  inline std::size_t operator()(const Key & key) const noexcept
+  {
+    // FNV-1a:
+    const unsigned char * bytes = reinterpret_cast<const unsigned char *>(
+                                    &key);
+    std::uint64_t h = 14695981039346656037ULL;
+    for (std::size_t b = 0; b < sizeof(Key); ++b) {
+      h ^= bytes[b];
+      h *= 1099511628211ULL;
+    }
+    return static_cast<std::size_t>(h);
+  }
+};
+
+template<typename Key, typename Pred>
+struct unordered_map_index_hash<
+  Key,
+  Pred,
+  typename std::enable_if< is_std_hashable<Key>::value >::type >
+: public std::hash<Key>
+{ };
+
+/**
+ * Open-addressing hash index mapping keys of a \c dash::UnorderedMap to
+ * the local offsets of elements in the local memory segment of a unit.
+ *
+ * Slots are probed linearly, the capacity of the index is a power of two
+ * and its load factor is kept below 1/2 so probe sequences are short.
+ */
+template<
+  typename Key,
+  typename Pred,
+  typename SizeType,
+  typename KeyHash = unordered_map_index_hash<Key, Pred> >
+class UnorderedMapIndex
+{
+private:
+  typedef UnorderedMapIndex<Key, Pred, SizeType, KeyHash> self_t;
+
+public:
+  typedef Key                                       key_type;
+  typedef KeyHash                                   hasher;
+  typedef SizeType                                  size_type;
+  typedef UnorderedMapIndexSlot<Key, SizeType>      slot_type;
+
+  /// Returned by lookup for keys not contained in the index.
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+public:
+  UnorderedMapIndex(
+    Pred      key_equal   = Pred(),
+    size_type capacity    = 16)
+  : _key_equal(key_equal)
+  {
+    _slots.resize(next_capacity(capacity));
+    clear();
+  }
+
+  /**
+   * Number of indexed keys.
+   */
+  inline size_type size() const noexcept
+  {
+    return _size;
+  }
+
+  /**
+   * Number of slots in the index.
+   */
+  inline size_type capacity() const noexcept
+  {
+    return _slots.size();
+  }
+
+  /**
+   * Native pointer to the first slot in the index.
+   */
+  inline const slot_type * data() const noexcept
+  {
+    return _slots.data();
+  }
+
+  /**
+   * Removes all keys from the index.
+   */
+  void clear()
+  {
+    for (auto & slot : _slots) {
+      slot.lpos_1 = 0;
+    }
+    _size = 0;
+  }
+
+  /**
+   * Adds the local offset of the element with the specified key to the
+   * index.
+   */
+  void insert(
+    const key_type & key,
+    size_type        lpos)
+  {
+    if (2 * (_size + 1) > _slots.size()) {
+      rehash(2 * _slots.size());
+    }
+    insert_slot(_slots.data(), _slots.size(), key, lpos, _key_equal);
+    ++_size;
+  }
+
+  /**
+   * Local offset of the element with the specified key, or \c npos if the
+   * key is not contained in the index.
+   */
+  size_type find(
+    const key_type & key) const
+  {
+    auto const nslots = _slots.size();
+    auto       slot   = probe_begin(key, nslots);
+    for (size_type probe = 0; probe < nslots; ++probe) {
+      auto const & s = _slots[slot];
+      if (s.lpos_1 == 0) {
+        return npos;
+      }
+      if (_key_equal(s.key, key)) {
+        return s.lpos_1 - 1;
+      }
+      slot = (slot + 1) & (nslots - 1);
+    }
+    return npos;
+  }
+
+  /**
+   * Copies all keys in the index to the given slot range with specified
+   * capacity, which must be a power of two and exceed twice the number of
+   * indexed keys.
+   */
+  void rehash_to(
+    slot_type * slots,
+    size_type   nslots) const
+  {
+    DASH_ASSERT_GE(nslots, 2 * _size, "insufficient index capacity");
+    for (size_type s = 0; s < nslots; ++s) {
+      slots[s].lpos_1 = 0;
+    }
+    for (auto const & slot : _slots) {
+      if (slot.lpos_1 != 0) {
+        insert_slot(slots, nslots, slot.key, slot.lpos_1 - 1, _key_equal);
+      }
+    }
+  }
+
+  /**
+   * Initial probe position of a key in an index with the specified
+   * capacity.
+   */
+  static inline size_type probe_begin(
+    const key_type & key,
+    size_type        nslots)
+  {
+    // Finalizer of MurmurHash3 to spread sequential keys:
+    std::uint64_t h = KeyHash()(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<size_type>(h) & (nslots - 1);
+  }
+
+  /**
+   * Smallest valid index capacity for the specified number of keys.
+   */
+  static inline size_type next_capacity(
+    size_type nkeys)
+  {
+    size_type nslots = 16;
+    while (nslots < 2 * nkeys) {
+      nslots <<= 1;
+    }
+    return nslots;
+  }
+
+private:
+  static void insert_slot(
+    slot_type        * slots,
+    size_type          nslots,
+    const key_type   & key,
+    size_type          lpos,
+    const Pred       & key_equal)
+  {
+    auto slot = probe_begin(key, nslots);
+    while (slots[slot].lpos_1 != 0 && !key_equal(slots[slot].key, key)) {
+      slot = (slot + 1) & (nslots - 1);
+    }
+    slots[slot].key    = key;
+    slots[slot].lpos_1 = lpos + 1;
+  }
+
+  void rehash(
+    size_type nslots)
+  {
+    DASH_LOG_TRACE("UnorderedMapIndex.rehash()", "capacity:", nslots);
+    std::vector<slot_type> slots(nslots);
+    rehash_to(slots.data(), nslots);
+    _slots = std::move(slots);
+  }
+
+private:
+  Pred                   _key_equal;
+  std::vector<slot_type> _slots;
+  size_type              _size = 0;
+}; // class UnorderedMapIndex
+
+template<
+  typename Key, typename Pred, typename SizeType, typename KeyHash >
+constexpr SizeType UnorderedMapIndex<Key, Pred, SizeType, KeyHash>::npos;
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__MAP__UNORDERED_MAP_INDEX_H__INCLUDED
@@ -393,6 +393,8 @@ private:
       // element is in bucket currently referenced by this iterator:
       _bucket_phase += offset;
     } else {
+      // offset relative to the beginning of the current bucket:
+      offset += _bucket_phase;
       // find bucket containing element at given offset:
       for (; _bucket_it != _bucket_last; ++_bucket_it) {
         if (offset >= _bucket_it->size) {
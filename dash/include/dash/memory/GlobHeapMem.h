@@ -16,6 +16,7 @@
 
 #include <dash/memory/GlobHeapPtr.h>
 #include <dash/memory/GlobHeapLocalPtr.h>
+#include <dash/memory/WriteCombineBuffer.h>
 
 #include <dash/internal/Logging.h>
 
@@ -231,6 +232,11 @@ public:
 
   typedef typename local_pointer::bucket_type                   bucket_type;
 
+  typedef internal::glob_dynamic_mem_index<size_type>     bucket_index_type;
+
+  typedef internal::glob_dynamic_mem_commit_stats<size_type>
+    commit_stats_type;
+
 private:
   typedef typename std::list<bucket_type>                       bucket_list;
   typedef typename bucket_list::iterator                    bucket_iterator;
@@ -269,6 +275,15 @@ private:
   /// For example, if unit 2 allocated buckets with sizes 1,3,5, the
   /// list at _bucket_cumul_sizes[2] has values 1,4,9.
   bucket_cumul_sizes_map     _bucket_cumul_sizes;
+  /// Flattened prefix index of the global memory space built from
+  /// _bucket_cumul_sizes, used to resolve global offsets in O(log n).
+  /// Rebuilt in commit and on first access after changes of the local
+  /// memory space.
+  mutable bucket_index_type  _bucket_index;
+  /// Global pointers of the local buckets, ordered like _buckets.
+  mutable std::vector<dart_gptr_t> _bucket_gptrs;
+  /// Whether _bucket_index and _bucket_gptrs are up to date.
+  mutable bool               _bucket_index_valid = false;
   /// Mapping unit id to number of buckets marked for attach in the unit's
   /// memory space.
   local_sizes_map            _num_attach_buckets;
@@ -277,6 +292,8 @@ private:
   local_sizes_map            _num_detach_buckets;
   /// Total number of elements in attached memory space of remote units.
   size_type                  _remote_size = 0;
+  /// Statistics of commits at the active unit.
+  commit_stats_type          _commit_stats;
   /// Global pointer referencing start of global memory space.
   index_type                 _begin_idx;
   /// Global pointer referencing the final position in global memory space.
@@ -328,6 +345,8 @@ public:
   ~GlobHeapMem()
   {
     DASH_LOG_TRACE("GlobHeapMem.~GlobHeapMem()");
+    // Buckets are freed by the allocator, write buffered values first:
+    dash::WriteCombineBuffer::flush();
   }
 
   GlobHeapMem()                        = delete;
@@ -380,6 +399,15 @@ public:
     return _local_sizes.local[0];
   }
 
+  /**
+   * Statistics of the commits of this global memory space at the active
+   * unit, e.g. the number of collective operations and attached buckets.
+   */
+  inline const commit_stats_type & commit_stats() const noexcept
+  {
+    return _commit_stats;
+  }
+
   /**
    * Number of elements in local memory space of given unit.
    *
@@ -461,6 +489,7 @@ public:
       std::advance(_attach_buckets_first,  _buckets.size() - 1);
     }
     _bucket_cumul_sizes[_myid].push_back(_local_sizes.local[0]);
+    _bucket_index_valid = false;
     DASH_LOG_TRACE("GlobHeapMem.grow", "added unattached bucket:",
                    "size:", bucket.size,
                    "lptr:", bucket.lptr);
@@ -640,6 +669,7 @@ public:
     // Update local iterators as bucket iterators might have changed:
     update_lbegin();
     update_lend();
+    _bucket_index_valid = false;
 
     DASH_LOG_TRACE("GlobHeapMem.shrink",
                    "cumulative bucket sizes:",  _bucket_cumul_sizes[_myid]);
@@ -667,6 +697,11 @@ public:
    * Frees local memory marked for deallocation and detaches it from global
    * memory.
    *
+   * Issues at most three collective operations, independent of the number
+   * of buckets allocated since the last commit.
+   *
+   * \see commit_stats
+   *
    * \see resize
    * \see grow
    * \see shrink
@@ -676,23 +711,32 @@ public:
     DASH_LOG_DEBUG("GlobHeapMem.commit()");
     DASH_LOG_TRACE_VAR("GlobHeapMem.commit", _buckets.size());
 
+    // Exchange local sizes and number of buckets to attach, also ensures
+    // that no remote unit accesses buckets detached in this commit:
+    auto unit_states = gather_unit_states();
     // First detach, then attach to minimize number of elements allocated
     // at the same time:
     size_type num_detached_elem = commit_detach();
-    size_type num_attached_elem = commit_attach();
-
-    if (num_detached_elem > 0 || num_attached_elem > 0) {
-      // Update _begin iterator:
-      DASH_LOG_TRACE("GlobHeapMem.commit", "updating _begin");
-      _begin_idx = 0;
-      DASH_LOG_TRACE("GlobHeapMem.commit", "updating _end");
-      _end_idx   = size();
-    }
+    size_type num_attached_elem = commit_attach(unit_states);
+    ++_commit_stats.num_commits;
+    _commit_stats.num_detached_elem += num_detached_elem;
+    _commit_stats.num_attached_elem += num_attached_elem;
+    DASH_LOG_TRACE_VAR("GlobHeapMem.commit", num_detached_elem);
+    DASH_LOG_TRACE_VAR("GlobHeapMem.commit", num_attached_elem);
+
+    // Update _begin and _end iterators, also required if only remote units
+    // attached or detached memory:
+    DASH_LOG_TRACE("GlobHeapMem.commit", "updating _begin");
+    _begin_idx = 0;
+    DASH_LOG_TRACE("GlobHeapMem.commit", "updating _end");
+    _end_idx   = size();
     // Update local iterators as bucket iterators might have changed:
     DASH_LOG_TRACE("GlobHeapMem.commit", "updating _lbegin");
     update_lbegin();
     DASH_LOG_TRACE("GlobHeapMem.commit", "updating _lend");
     update_lend();
+    DASH_LOG_TRACE("GlobHeapMem.commit", "updating bucket index");
+    update_bucket_index();
     DASH_LOG_DEBUG("GlobHeapMem.commit >", "finished");
   }
 
@@ -889,6 +933,39 @@ public:
 
 private:
 
+  /**
+   * Flattened prefix index of the global memory space, rebuilt if the
+   * memory space changed since the last access.
+   */
+  inline const bucket_index_type & bucket_index() const
+  {
+    if (!_bucket_index_valid) {
+      update_bucket_index();
+    }
+    return _bucket_index;
+  }
+
+  /**
+   * Rebuild the flattened prefix index of the global memory space from
+   * the cumulative bucket sizes of all units.
+   *
+   * \complexity  O(p + b) for \c p units and \c b buckets in total
+   */
+  void update_bucket_index() const
+  {
+    DASH_LOG_TRACE("GlobHeapMem.update_bucket_index()");
+    _bucket_index.build(_bucket_cumul_sizes);
+    _bucket_gptrs.clear();
+    _bucket_gptrs.reserve(_buckets.size());
+    for (const auto & bucket : _buckets) {
+      _bucket_gptrs.push_back(bucket.gptr);
+    }
+    _bucket_index_valid = true;
+    DASH_LOG_TRACE("GlobHeapMem.update_bucket_index >",
+                   "size:",    _bucket_index.size(),
+                   "buckets:", _bucket_index.bucket_cumul_sizes.size());
+  }
+
   /**
    * Native pointer of the initial address of the local memory of
    * a unit.
@@ -940,6 +1017,9 @@ private:
     // Number of elements successfully deallocated from global memory in
     // this commit:
     size_type num_detached_elem = 0;
+    if (!_detach_buckets.empty()) {
+      dash::WriteCombineBuffer::flush();
+    }
     for (auto bucket_it = _detach_buckets.begin();
          bucket_it != _detach_buckets.cend(); ++bucket_it) {
       DASH_LOG_TRACE("GlobHeapMem.commit_detach", "detaching bucket:",
@@ -960,32 +1040,59 @@ private:
     return num_detached_elem;
   }
 
+  /**
+   * Exchange the current local size and the number of buckets marked for
+   * attach of all units.
+   *
+   * Collective operation.
+   *
+   * \return  Local size and number of buckets to attach of unit \c u at
+   *          offsets \c 2u and \c 2u+1.
+   */
+  std::vector<size_type> gather_unit_states()
+  {
+    DASH_LOG_TRACE("GlobHeapMem.gather_unit_states()");
+    size_type local_state[2] = { _local_sizes.local[0],
+                                 _num_attach_buckets.local[0] };
+    std::vector<size_type> unit_states(2 * _nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        local_state,
+        unit_states.data(),
+        2,
+        dash::dart_datatype<size_type>::value,
+        _teamid),
+      DART_OK);
+    ++_commit_stats.num_collectives;
+    DASH_LOG_TRACE("GlobHeapMem.gather_unit_states >", unit_states);
+    return unit_states;
+  }
+
   /**
    * Commit global allocation of buffers marked for attach.
+   *
+   * All buckets marked for attach are registered in global memory in a
+   * single collective operation, independent of their number.
    */
-  size_type commit_attach()
+  size_type commit_attach(const std::vector<size_type> & unit_states)
   {
     DASH_LOG_TRACE("GlobHeapMem.commit_attach()");
     DASH_LOG_TRACE("GlobHeapMem.commit_attach",
                    "local buckets to attach:", _num_attach_buckets.local[0]);
-    // Unregister buckets marked for detach in global memory:
-    _num_attach_buckets.barrier();
-    // Minumum and maximum number of buckets to be attached by any unit:
-    auto min_max_attach     = gather_min_max(_num_attach_buckets.begin(),
-                                             _num_attach_buckets.end());
-    auto min_attach_buckets = min_max_attach.first;
-    auto max_attach_buckets = min_max_attach.second;
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach",
-                   "min. attach buckets:",  min_attach_buckets);
+    // Maximum number of buckets to be attached by any unit:
+    size_type max_attach_buckets = 0;
+    for (size_type u = 0; u < _nunits; ++u) {
+      max_attach_buckets = std::max(max_attach_buckets,
+                                    unit_states[2 * u + 1]);
+    }
     DASH_LOG_TRACE("GlobHeapMem.commit_attach",
                    "max. attach buckets:",  max_attach_buckets);
-    // Number of buckets successfully attached in this commit:
-    size_type num_attached_buckets = 0;
     // Number of elements allocated in global memory in this commit:
     size_type num_attached_elem    = 0;
     // Number of elements at remote units before the commit:
     size_type old_remote_size      = _remote_size;
-    _remote_size                   = update_remote_size();
+    _remote_size                   = update_remote_size(
+                                       unit_states, max_attach_buckets);
     // Whether at least one remote unit needs to attach additional global
     // memory:
     bool has_remote_attach         = _remote_size > old_remote_size;
@@ -996,89 +1103,78 @@ private:
     // Plausibility check:
     DASH_ASSERT(!has_remote_attach || max_attach_buckets > 0);
 
-    // Attach local unattached buckets in global memory space.
-    // As bucket sizes differ between units, units must collect gptr's
-    // (dart_gptr_t) and size of buckets attached by other units and store
-    // them locally so a remote unit's local index can be mapped to the
-    // remote unit's bucket.
-    if (min_attach_buckets == 0 && max_attach_buckets == 0) {
-      DASH_LOG_TRACE("GlobHeapMem.commit_attach", "no attach");
+    if (max_attach_buckets == 0) {
+      DASH_LOG_TRACE("GlobHeapMem.commit_attach >", "no attach");
       DASH_ASSERT(_attach_buckets_first == _buckets.end());
       DASH_ASSERT(_buckets.empty() || _buckets.back().attached);
+      return 0;
     }
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attaching",
-                   std::distance(_attach_buckets_first, _buckets.end()),
-                   "buckets");
+    // Attach local unattached buckets in global memory space.
+    // All units must attach the same number of buckets collectively.
+    // Empty buckets are attached if this unit attaches less than the
+    // maximum number of buckets attached by any other unit in this commit,
+    // so the n-th bucket of every unit refers to the same segment in global
+    // memory.
+    std::vector<typename allocator_type::local_pointer> attach_lptrs;
+    std::vector<size_type>                              attach_sizes;
+    for (auto bit = _attach_buckets_first; bit != _buckets.end(); ++bit) {
+      DASH_ASSERT(!bit->attached);
+      attach_lptrs.push_back(bit->lptr);
+      attach_sizes.push_back(bit->size);
+    }
+    size_type num_attached_buckets = attach_lptrs.size();
+    DASH_LOG_TRACE("GlobHeapMem.commit_attach",
+                   "local buckets attached:", num_attached_buckets);
+    attach_lptrs.resize(max_attach_buckets, nullptr);
+    attach_sizes.resize(max_attach_buckets, 0);
+    auto attach_gptrs = _allocator.attach(attach_lptrs, attach_sizes);
+    ++_commit_stats.num_collectives;
+
+    size_type seg_idx = 0;
     for (; _attach_buckets_first != _buckets.end(); ++_attach_buckets_first) {
       bucket_type & bucket = *_attach_buckets_first;
-      DASH_ASSERT(!bucket.attached);
-      DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attaching bucket");
-      DASH_LOG_TRACE_VAR("GlobHeapMem.commit_attach", bucket.size);
-      DASH_LOG_TRACE_VAR("GlobHeapMem.commit_attach", bucket.lptr);
-      // Attach bucket's local memory segment in global memory:
-      bucket.gptr     = _allocator.attach(bucket.lptr, bucket.size);
-      bucket.attached = true;
+      bucket.gptr          = attach_gptrs[seg_idx++];
+      bucket.attached      = true;
+      DASH_ASSERT(!DART_GPTR_ISNULL(bucket.gptr));
       DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attached bucket:",
+                     "size:", bucket.size,
+                     "lptr:", bucket.lptr,
                      "gptr:", bucket.gptr);
-      num_attached_elem            += bucket.size;
-      _num_attach_buckets.local[0] -= 1;
-      num_attached_buckets++;
+      num_attached_elem += bucket.size;
     }
-    DASH_ASSERT(_attach_buckets_first == _buckets.end());
-    // All units must attach the same number of buckets collectively.
-    // Attach empty buckets if this unit attached less than the maximum
-    // number of buckets attached by any other unit in this commit:
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach",
-                   "local buckets attached:", num_attached_buckets);
-    DASH_LOG_TRACE("GlobHeapMem.commit_attach",
-                   "buckets required to attach:", max_attach_buckets);
-    while (num_attached_buckets < max_attach_buckets) {
-      DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attaching null bucket");
+    _num_attach_buckets.local[0] = 0;
+    auto & local_cumul_sizes = _bucket_cumul_sizes[_myid];
+    for (; seg_idx < max_attach_buckets; ++seg_idx) {
       bucket_type bucket;
       bucket.size     = 0;
       bucket.lptr     = nullptr;
       bucket.attached = true;
-      bucket.gptr     = _allocator.attach(bucket.lptr, bucket.size);
+      bucket.gptr     = attach_gptrs[seg_idx];
       DASH_ASSERT(!DART_GPTR_ISNULL(bucket.gptr));
-      _buckets.push_back(bucket);
-      num_attached_buckets++;
       DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attached null bucket:",
-                     "gptr:", bucket.gptr,
-                     "left:", max_attach_buckets - num_attached_buckets);
+                     "gptr:", bucket.gptr);
+      _buckets.push_back(bucket);
+      local_cumul_sizes.push_back(local_cumul_sizes.empty()
+                                  ? 0
+                                  : local_cumul_sizes.back());
     }
+    _commit_stats.num_attached_buckets += num_attached_buckets;
+    _commit_stats.num_padding_buckets  += max_attach_buckets
+                                          - num_attached_buckets;
     DASH_LOG_TRACE("GlobHeapMem.commit_attach >",
                    "globally allocated elements:", num_attached_elem);
     return num_attached_elem;
   }
 
-  template<
-    typename GlobalIt,
-    typename ValueType = typename GlobalIt::value_type >
-  std::pair<ValueType, ValueType> gather_min_max(
-    const GlobalIt & first,
-    const GlobalIt & last)
-  {
-    // TODO: Unoptimized, use dash::min_max_element once it is available
-    //
-    DASH_LOG_TRACE("GlobHeapMem.gather_min_max()");
-    std::vector<ValueType> lcopy(dash::distance(first, last));
-    auto lcopy_end = dash::copy(first, last, lcopy.data());
-    auto min_lptr  = std::min_element(lcopy.data(), lcopy_end);
-    auto max_lptr  = std::max_element(lcopy.data(), lcopy_end);
-    std::pair<ValueType, ValueType> min_max;
-    min_max.first  = *min_lptr;
-    min_max.second = *max_lptr;
-    DASH_LOG_TRACE("GlobHeapMem.gather_min_max >",
-                   "min:", min_max.first,
-                   "max:", min_max.second);
-    return min_max;
-  }
-
   /**
-   * Request the size of all units' local memory, including unattached memory
-   * regions, and update the capacity of global memory space.
+   * Update the capacity of global memory space from the local sizes and
+   * number of unattached buckets of all units.
+   *
+   * Collective operation.
    */
-  size_type update_remote_size()
+  size_type update_remote_size(
+    const std::vector<size_type> & unit_states,
+    size_type                      max_attach_buckets)
   {
     // This function updates local snapshots of the remote unit's local
     // sizes.
@@ -1097,49 +1193,53 @@ private:
     //
     // Outline:
     //
-    // 1. Create local copy of the distributed array _num_attach_buckets that
-    //    contains the number of unattached buckets of every unit.
-    // 2. Temporarily attach an array attach_bucket_sizes in global memory
-    //    that contains the sizes of this unit's unattached buckets.
-    // 3. At this point, every unit published the number of buckets it will
-    //    attach in the next commit, and their sizes.
-    //    The current local size Lu of every unit, including its unattached
-    //    buckets, is stored in _local_sizes.
-    // 4. For every remote unit u:
+    // 1. The current local size Lu of every unit u, including its
+    //    unattached buckets, and the number of its unattached buckets have
+    //    been exchanged in unit_states.
+    // 2. If any unit has more than one unattached bucket, the sizes of all
+    //    units' unattached buckets are exchanged in a single allgatherv.
+    // 3. For every remote unit u:
     //    - If unit u has one unattached bucket, append the unit's current
     //      local size Lu to the unit's list of cumulative bucket sizes.
-    //    - If unit u has more than one unattached bucket, the sizes of the
-    //      single buckets must be retrieved from the vector
-    //      attach_bucket_sizes temporarily attached by u in step 1.
-    // 5. Detach vector attach_bucket_sizes.
+    //    - If unit u has more than one unattached bucket, append the
+    //      cumulative sizes of its unattached buckets.
+    //    - Append empty buckets for the null buckets attached by unit u to
+    //      match the maximum number of attached buckets.
 
     DASH_LOG_TRACE("GlobHeapMem.update_remote_size()");
     size_type new_remote_size = 0;
-    // Number of unattached buckets of every unit:
-    std::vector<size_type> num_unattached_buckets(_nunits, 0);
-    _num_attach_buckets.barrier();
-    dash::copy(_num_attach_buckets.begin(),
-               _num_attach_buckets.end(),
-               num_unattached_buckets.data());
-    // Attach array of local unattached bucket sizes to allow remote units to
-    // query the sizes of this unit's unattached buckets.
-    std::vector<size_type> attach_buckets_sizes;
-    for (auto bit = _attach_buckets_first; bit != _buckets.end(); ++bit) {
-      attach_buckets_sizes.push_back((*bit).size);
+    // Offsets of the unattached bucket sizes of every unit in
+    // attach_buckets_sizes:
+    std::vector<size_t> attach_buckets_counts(_nunits);
+    std::vector<size_t> attach_buckets_displs(_nunits);
+    size_t              num_attach_buckets_total = 0;
+    for (size_type u = 0; u < _nunits; ++u) {
+      attach_buckets_counts[u]  = unit_states[2 * u + 1];
+      attach_buckets_displs[u]  = num_attach_buckets_total;
+      num_attach_buckets_total += attach_buckets_counts[u];
+    }
+    std::vector<size_type> attach_buckets_sizes(num_attach_buckets_total);
+    if (max_attach_buckets > 1) {
+      // Sizes of single buckets cannot be derived from the units' local
+      // sizes:
+      std::vector<size_type> local_attach_buckets_sizes;
+      for (auto bit = _attach_buckets_first; bit != _buckets.end(); ++bit) {
+        local_attach_buckets_sizes.push_back(bit->size);
+      }
+      DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
+                         local_attach_buckets_sizes);
+      DASH_ASSERT_RETURNS(
+        dart_allgatherv(
+          local_attach_buckets_sizes.data(),
+          local_attach_buckets_sizes.size(),
+          dash::dart_datatype<size_type>::value,
+          attach_buckets_sizes.data(),
+          attach_buckets_counts.data(),
+          attach_buckets_displs.data(),
+          _teamid),
+        DART_OK);
+      ++_commit_stats.num_collectives;
     }
-    DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
-                       attach_buckets_sizes);
-    // Use same allocator type as used for values in global memory:
-    typedef typename allocator_type::template rebind<size_type>::other
-      size_type_allocator_t;
-    size_type_allocator_t attach_buckets_sizes_allocator(_allocator.team());
-    auto attach_buckets_sizes_gptr = attach_buckets_sizes_allocator.attach(
-                                       &attach_buckets_sizes[0],
-                                       attach_buckets_sizes.size());
-    _team->barrier();
-    // Implicit barrier in allocator.attach
-    DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
-                       attach_buckets_sizes_gptr);
     for (size_type u = 0; u < _nunits; ++u) {
       if (u == _myid) {
         continue;
@@ -1148,19 +1248,19 @@ private:
                      "collecting local bucket sizes of unit", u);
       // Last known local attached capacity of remote unit:
       auto & u_bucket_cumul_sizes = _bucket_cumul_sizes[u];
-      // Request current locally allocated capacity of remote unit:
       size_type u_local_size_old  = u_bucket_cumul_sizes.size() == 0
                                     ? 0
                                     : u_bucket_cumul_sizes.back();
-      size_type u_local_size_new  = _local_sizes[u];
+      // Current locally allocated capacity of remote unit:
+      size_type u_local_size_new  = unit_states[2 * u];
       DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
                          u_local_size_old);
       DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
-                         u_local_size_old);
+                         u_local_size_new);
       difference_type u_local_size_diff  = u_local_size_new - u_local_size_old;
       new_remote_size       += u_local_size_new;
       // Number of unattached buckets of unit u:
-      size_type u_num_attach_buckets = num_unattached_buckets[u];
+      size_type u_num_attach_buckets = attach_buckets_counts[u];
       DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
                          u_num_attach_buckets);
       if (u_num_attach_buckets == 0) {
@@ -1171,20 +1271,10 @@ private:
         u_bucket_cumul_sizes.push_back(u_local_size_new);
       } else {
         // Unit u has multiple unattached buckets.
-        // Request sizes of single unattached buckets of unit u:
-        std::vector<size_type> u_attach_buckets_sizes(
-                                 u_num_attach_buckets, 0);
-        dart_gptr_t u_attach_buckets_sizes_gptr = attach_buckets_sizes_gptr;
-        dart_gptr_setunit(&u_attach_buckets_sizes_gptr, u);
-        dash::internal::get_blocking(
-          // global source:
-          u_attach_buckets_sizes_gptr,
-          // local dest:
-          u_attach_buckets_sizes.data(),
-          // request bytes (~= number of sizes) from unit u:
-          u_num_attach_buckets);
         // Update local snapshot of cumulative bucket sizes at unit u:
-        for (int bi = 0; bi < u_num_attach_buckets; ++bi) {
+        auto u_attach_buckets_sizes = attach_buckets_sizes.begin()
+                                      + attach_buckets_displs[u];
+        for (size_type bi = 0; bi < u_num_attach_buckets; ++bi) {
           size_type single_bkt_size = u_attach_buckets_sizes[bi];
           size_type cumul_bkt_size  = single_bkt_size;
           DASH_LOG_TRACE_VAR("GlobHeapMem.update_remote_size",
@@ -1199,11 +1289,14 @@ private:
       if (u_local_size_diff < 0 && u_bucket_cumul_sizes.size() > 0) {
         u_bucket_cumul_sizes.back() += u_local_size_diff;
       }
+      // Null buckets attached by unit u:
+      for (size_type bi = u_num_attach_buckets; bi < max_attach_buckets;
+           ++bi) {
+        u_bucket_cumul_sizes.push_back(u_bucket_cumul_sizes.empty()
+                                       ? 0
+                                       : u_bucket_cumul_sizes.back());
+      }
     }
-    // Detach array of local unattached bucket sizes, implicit barrier:
-    attach_buckets_sizes_allocator.detach(attach_buckets_sizes_gptr);
-    // Implicit barrier in allocator.detach
-    _team->barrier();
 #if DASH_ENABLE_TRACE_LOGGING
     for (size_type u = 0; u < _nunits; ++u) {
       DASH_LOG_TRACE("GlobHeapMem.update_remote_size",
@@ -1233,17 +1326,20 @@ private:
       DASH_THROW(dash::exception::RuntimeError, "No units in team");
     }
     // Get the referenced bucket's dart_gptr:
-    auto bucket_it = _buckets.begin();
-    std::advance(bucket_it, bucket_index);
-    auto dart_gptr = bucket_it->gptr;
-    DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->attached);
-    DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->gptr);
+    auto const & index = this->bucket_index();
+    DASH_ASSERT_LT(bucket_index,
+                   static_cast<index_type>(_bucket_gptrs.size()),
+                   "bucket index out of range");
+    auto dart_gptr = _bucket_gptrs[bucket_index];
+    DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", dart_gptr);
     if (unit == _myid) {
-      DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->lptr);
-      DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->size);
-      DASH_ASSERT_LT(bucket_phase, bucket_it->size,
+      DASH_ASSERT_LT(bucket_phase,
+                     static_cast<index_type>(
+                       index.bucket_end(unit, bucket_index) -
+                       index.bucket_begin(unit, bucket_index)),
                      "bucket phase out of bounds");
     }
+    dash__unused(index);
     if (DART_GPTR_ISNULL(dart_gptr)) {
       DASH_LOG_TRACE("GlobHeapMem.dart_gptr_at",
                      "bucket.gptr is DART_GPTR_NULL");
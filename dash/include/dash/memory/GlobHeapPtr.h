@@ -42,6 +42,9 @@ class GlobPtr<
             AllocatorType> GlobHeapMemType;
   typedef GlobPtr<ElementType, GlobHeapMemType>   self_t;
 
+  template<typename E_, class M_>
+  friend class GlobPtr;
+
   template<
     typename ElementType_,
     class    AllocType_ >
@@ -86,14 +89,12 @@ public:
   };
 
 private:
-  typedef std::vector<std::vector<size_type> >
-    bucket_cumul_sizes_map;
+  typedef typename GlobHeapMemType::bucket_index_type
+    bucket_index_type;
 
 private:
   /// Global memory used to dereference iterated values.
   const globmem_type           * _globmem            = nullptr;
-  /// Mapping unit id to buckets in the unit's attached local storage.
-  const bucket_cumul_sizes_map * _bucket_cumul_sizes = nullptr;
   /// Pointer to first element in local data space.
   local_pointer                  _lbegin;
   /// Current position of the pointer in global canonical index space.
@@ -117,7 +118,6 @@ public:
    */
   GlobPtr()
   : _globmem(nullptr),
-    _bucket_cumul_sizes(nullptr),
     _idx(0),
     _max_idx(0),
     _myid(dash::Team::GlobalUnitID()),
@@ -139,7 +139,6 @@ public:
     const MemSpaceT    * gmem,
 	  index_type           position = 0)
   : _globmem(reinterpret_cast<const globmem_type *>(gmem)),
-    _bucket_cumul_sizes(&_globmem->_bucket_cumul_sizes),
     _lbegin(_globmem->lbegin()),
     _idx(position),
     _max_idx(gmem->size() - 1),
@@ -150,32 +149,8 @@ public:
     _idx_bucket_phase(0)
   {
     DASH_LOG_TRACE("GlobPtr(gmem,idx)", "gidx:", position);
-    for (auto unit_bucket_cumul_sizes : *_bucket_cumul_sizes) {
-      DASH_LOG_TRACE_VAR("GlobPtr(gmem,idx)",
-                         unit_bucket_cumul_sizes);
-      size_type bucket_cumul_size_prev = 0;
-      for (auto bucket_cumul_size : unit_bucket_cumul_sizes) {
-        DASH_LOG_TRACE_VAR("GlobPtr(gmem,idx)", bucket_cumul_size);
-        if (position < bucket_cumul_size) {
-          DASH_LOG_TRACE_VAR("GlobPtr(gmem,idx)", position);
-          _idx_bucket_phase -= bucket_cumul_size;
-          position           = 0;
-          _idx_local_idx     = position;
-          _idx_bucket_phase  = position - bucket_cumul_size_prev;
-          break;
-        }
-        bucket_cumul_size_prev = bucket_cumul_size;
-        ++_idx_bucket_idx;
-      }
-      if (position == 0) {
-        break;
-      }
-      // Advance to next unit, adjust position relative to next unit's
-      // local index space:
-      position -= unit_bucket_cumul_sizes.back();
-      ++_idx_unit_id;
-    }
-    DASH_LOG_TRACE("GlobPtr(gmem,idx)",
+    set_position(_globmem->bucket_index(), position);
+    DASH_LOG_TRACE("GlobPtr(gmem,idx) >",
                    "gidx:",   _idx,
                    "unit:",   _idx_unit_id,
                    "lidx:",   _idx_local_idx,
@@ -193,7 +168,6 @@ public:
     team_unit_t          unit,
 	  index_type           local_index)
   : _globmem(reinterpret_cast<const globmem_type *>(gmem)),
-    _bucket_cumul_sizes(&_globmem->_bucket_cumul_sizes),
     _lbegin(_globmem->lbegin()),
     _idx(0),
     _max_idx(gmem->size() - 1),
@@ -206,13 +180,10 @@ public:
     DASH_LOG_TRACE("GlobPtr(gmem,unit,lidx)",
                    "unit:", unit,
                    "lidx:", local_index);
-    DASH_ASSERT_LT(unit, _bucket_cumul_sizes->size(), "invalid unit id");
-
-    for (size_type unit = 0; unit < _idx_unit_id; ++unit) {
-      auto prec_unit_local_size = (*_bucket_cumul_sizes)[unit].back();
-      _idx += prec_unit_local_size;
-    }
-    increment(local_index);
+    auto const & index = _globmem->bucket_index();
+    DASH_ASSERT_LT(unit, index.num_units(), "invalid unit id");
+    _idx = index.unit_offsets[unit] + local_index;
+    set_position(index, _idx);
     DASH_LOG_TRACE("GlobPtr(gmem,unit,lidx) >",
                    "gidx:",   _idx,
                    "maxidx:", _max_idx,
@@ -229,10 +200,10 @@ public:
   GlobPtr(
     const GlobPtr<E_, M_> & other)
   : _globmem(other._globmem),
-    _bucket_cumul_sizes(other._bucket_cumul_sizes),
     _lbegin(other._lbegin),
     _idx(other._idx),
     _max_idx(other._max_idx),
+    _myid(other._myid),
     _idx_unit_id(other._idx_unit_id),
     _idx_local_idx(other._idx_local_idx),
     _idx_bucket_idx(other._idx_bucket_idx),
@@ -247,14 +218,15 @@ public:
     const GlobPtr<E_, M_> & other)
   {
     _globmem            = other._globmem;
-    _bucket_cumul_sizes = other._bucket_cumul_sizes;
     _lbegin             = other._lbegin;
     _idx                = other._idx;
     _max_idx            = other._max_idx;
+    _myid               = other._myid;
     _idx_unit_id        = other._idx_unit_id;
     _idx_local_idx      = other._idx_local_idx;
     _idx_bucket_idx     = other._idx_bucket_idx;
     _idx_bucket_phase   = other._idx_bucket_phase;
+    return *this;
   }
 
   /**
@@ -431,7 +403,7 @@ public:
 
   inline self_t & operator-=(index_type offset)
   {
-    increment(offset);
+    decrement(offset);
     return *this;
   }
 
@@ -498,10 +470,42 @@ public:
   }
 
 private:
+  /**
+   * Resolve unit, local offset, bucket and bucket phase of the specified
+   * position in global index space.
+   * Positions past the final element are mapped to the last unit.
+   *
+   * \complexity  O(log p + log b) for \c p units and \c b buckets of the
+   *              unit at the position
+   */
+  void set_position(
+    const bucket_index_type & index,
+    index_type                g_index)
+  {
+    if (index.num_units() == 0) {
+      _idx_unit_id      = team_unit_t(0);
+      _idx_local_idx    = g_index;
+      _idx_bucket_idx   = 0;
+      _idx_bucket_phase = g_index;
+      return;
+    }
+    auto const unit   = index.unit_at(g_index);
+    auto const l_idx  = g_index - static_cast<index_type>(
+                                    index.unit_offsets[unit]);
+    auto const bucket = index.bucket_at(unit, l_idx);
+    _idx_unit_id      = team_unit_t(static_cast<dart_unit_t>(unit));
+    _idx_local_idx    = l_idx;
+    _idx_bucket_idx   = bucket;
+    _idx_bucket_phase = l_idx - static_cast<index_type>(
+                                  index.num_buckets(unit) == 0
+                                  ? 0
+                                  : index.bucket_begin(unit, bucket));
+  }
+
   /**
    * Advance pointer by specified position offset.
    */
-  void increment(int offset)
+  void increment(index_type offset)
   {
     DASH_LOG_TRACE("GlobPtr.increment()",
                    "gidx:",   _idx,
@@ -510,10 +514,17 @@ private:
                    "bidx:",   _idx_bucket_idx,
                    "bphase:", _idx_bucket_phase,
                    "offset:", offset);
+    if (offset < 0) {
+      decrement(-offset);
+      return;
+    }
     _idx += offset;
-    auto current_bucket_size =
-           (*_bucket_cumul_sizes)[_idx_unit_id][_idx_bucket_idx];
-    if (_idx_local_idx + offset < current_bucket_size) {
+    auto const & index = _globmem->bucket_index();
+    auto const   unit  = static_cast<size_type>(_idx_unit_id);
+    if (unit < index.num_units() &&
+        static_cast<size_type>(_idx_bucket_idx) < index.num_buckets(unit) &&
+        static_cast<size_type>(_idx_local_idx + offset)
+          < index.bucket_end(unit, _idx_bucket_idx)) {
       DASH_LOG_TRACE("GlobPtr.increment", "position current bucket");
       // element is in bucket currently referenced by this pointer:
       _idx_bucket_phase += offset;
@@ -521,64 +532,7 @@ private:
     } else {
       DASH_LOG_TRACE("GlobPtr.increment",
                      "position in succeeding bucket");
-      // iterate units:
-      auto unit_id_max = _bucket_cumul_sizes->size() - 1;
-      for (; _idx_unit_id <= unit_id_max; ++_idx_unit_id) {
-        if (offset == 0) {
-          break;
-        }
-        auto unit_bkt_sizes       = (*_bucket_cumul_sizes)[_idx_unit_id];
-        auto unit_bkt_sizes_total = unit_bkt_sizes.back();
-        auto unit_num_bkts        = unit_bkt_sizes.size();
-        DASH_LOG_TRACE("GlobPtr.increment",
-                       "unit:", _idx_unit_id,
-                       "remaining offset:", offset,
-                       "total local bucket size:", unit_bkt_sizes_total);
-        if (_idx_local_idx + offset >= unit_bkt_sizes_total) {
-          // offset refers to next unit:
-          DASH_LOG_TRACE("GlobPtr.increment",
-                         "position in remote range");
-          // subtract remaining own local size from remaining offset:
-          offset -= (unit_bkt_sizes_total - _idx_local_idx);
-          if (_idx_unit_id == unit_id_max) {
-            // end pointer, offset exceeds iteration space:
-            _idx_bucket_idx    = unit_num_bkts - 1;
-            auto last_bkt_size = unit_bkt_sizes.back();
-            if (unit_num_bkts > 1) {
-              last_bkt_size -= unit_bkt_sizes[_idx_bucket_idx-1];
-            }
-            _idx_bucket_phase  = last_bkt_size + offset;
-            _idx_local_idx    += unit_bkt_sizes_total  + offset;
-            break;
-          }
-          _idx_local_idx    = 0;
-          _idx_bucket_idx   = 0;
-          _idx_bucket_phase = 0;
-        } else {
-          // offset refers to current unit:
-          DASH_LOG_TRACE("GlobPtr.increment",
-                         "position in local range",
-                         "current bucket phase:", _idx_bucket_phase,
-                         "cumul. bucket sizes:",  unit_bkt_sizes);
-          _idx_local_idx += offset;
-          // iterate the unit's bucket sizes:
-          for (; _idx_bucket_idx < unit_num_bkts; ++_idx_bucket_idx) {
-            auto cumul_bucket_size = unit_bkt_sizes[_idx_bucket_idx];
-            if (_idx_local_idx < cumul_bucket_size) {
-              auto cumul_prev  = _idx_bucket_idx > 0
-                                 ? unit_bkt_sizes[_idx_bucket_idx-1]
-                                 : 0;
-              // offset refers to current bucket:
-              _idx_bucket_phase = _idx_local_idx - cumul_prev;
-              offset            = 0;
-              break;
-            }
-          }
-          if (offset == 0) {
-            break;
-          }
-        }
-      }
+      set_position(index, _idx);
     }
     DASH_LOG_TRACE("GlobPtr.increment >",
                    "gidx:",   _idx,
@@ -591,7 +545,7 @@ private:
   /**
    * Decrement pointer by specified position offset.
    */
-  void decrement(int offset)
+  void decrement(index_type offset)
   {
     DASH_LOG_TRACE("GlobPtr.decrement()",
                    "gidx:",   _idx,
@@ -600,6 +554,10 @@ private:
                    "bidx:",   _idx_bucket_idx,
                    "bphase:", _idx_bucket_phase,
                    "offset:", -offset);
+    if (offset < 0) {
+      increment(-offset);
+      return;
+    }
     if (offset > _idx) {
       DASH_THROW(dash::exception::OutOfRange,
                  "offset " << offset << " is out of range");
@@ -610,48 +568,7 @@ private:
       _idx_bucket_phase -= offset;
       _idx_local_idx    -= offset;
     } else {
-      // iterate units:
-      auto first_unit = _idx_unit_id;
-      for (; _idx_unit_id >= 0; --_idx_unit_id) {
-        auto unit_bkt_sizes       = (*_bucket_cumul_sizes)[_idx_unit_id];
-        auto unit_bkt_sizes_total = unit_bkt_sizes.back();
-        auto unit_num_bkts        = unit_bkt_sizes.size();
-        if (_idx_unit_id != first_unit) {
-          --offset;
-          _idx_bucket_idx    = unit_num_bkts - 1;
-          _idx_local_idx     = unit_bkt_sizes_total - 1;
-          auto last_bkt_size = unit_bkt_sizes.back();
-          if (unit_num_bkts > 1) {
-            last_bkt_size -= unit_bkt_sizes[_idx_bucket_idx-1];
-          }
-          _idx_bucket_phase  = last_bkt_size - 1;
-        }
-        if (offset <= _idx_local_idx) {
-          // offset refers to current unit:
-          // iterate the unit's bucket sizes:
-          for (; _idx_bucket_idx >= 0; --_idx_bucket_idx) {
-            auto bucket_size = unit_bkt_sizes[_idx_bucket_idx];
-            if (offset <= _idx_bucket_phase) {
-              // offset refers to current bucket:
-              _idx_local_idx    -= offset;
-              _idx_bucket_phase -= offset;
-              offset             = 0;
-              break;
-            } else {
-              // offset refers to preceeding bucket:
-              _idx_local_idx    -= (_idx_bucket_phase + 1);
-              offset            -= (_idx_bucket_phase + 1);
-              _idx_bucket_phase  = unit_bkt_sizes[_idx_bucket_idx-1] - 1;
-            }
-          }
-        } else {
-          // offset refers to preceeding unit:
-          offset -= _idx_local_idx;
-        }
-        if (offset == 0) {
-          break;
-        }
-      }
+      set_position(_globmem->bucket_index(), _idx);
     }
     DASH_LOG_TRACE("GlobPtr.decrement >",
                    "gidx:",   _idx,
@@ -9,6 +9,8 @@
 #include <dash/Team.h>
 #include <dash/Onesided.h>
 
+#include <dash/memory/WriteCombineBuffer.h>
+
 #include <dash/internal/Logging.h>
 
 namespace dash {
@@ -240,6 +242,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobStaticMem.~GlobStaticMem()", _begptr);
     // check if has been moved away
     if(!DART_GPTR_ISNULL(_begptr)){
+      dash::WriteCombineBuffer::flush();
       _allocator.deallocate(_begptr);
     }
     DASH_LOG_TRACE("GlobStaticMem.~GlobStaticMem >");
@@ -461,26 +464,29 @@ public:
   /**
    * Complete all outstanding non-blocking operations to all units.
    */
-  void flush() noexcept
+  void flush()
   {
+    dash::WriteCombineBuffer::flush();
     dart_flush_all(_begptr);
   }
 
   /**
    * Complete all outstanding non-blocking operations to the specified unit.
    */
-  void flush(dash::team_unit_t target) noexcept
+  void flush(dash::team_unit_t target)
   {
     dart_gptr_t gptr = _begptr;
     gptr.unitid = target.id;
+    dash::WriteCombineBuffer::flush();
     dart_flush(gptr);
   }
 
   /**
    * Locally complete all outstanding non-blocking operations to all units.
    */
-  void flush_local() noexcept
+  void flush_local()
   {
+    dash::WriteCombineBuffer::flush_local();
     dart_flush_local_all(_begptr);
   }
 
@@ -488,10 +494,11 @@ public:
    * Locally complete all outstanding non-blocking operations to the specified
    * unit.
    */
-  void flush_local(dash::team_unit_t target) noexcept
+  void flush_local(dash::team_unit_t target)
   {
     dart_gptr_t gptr = _begptr;
     gptr.unitid = target.id;
+    dash::WriteCombineBuffer::flush_local();
     dart_flush_local(gptr);
   }
 
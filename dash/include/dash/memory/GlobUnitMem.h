@@ -9,6 +9,8 @@
 #include <dash/Team.h>
 #include <dash/Onesided.h>
 
+#include <dash/memory/WriteCombineBuffer.h>
+
 #include <dash/internal/Logging.h>
 
 namespace dash {
@@ -186,6 +188,7 @@ public:
   {
     DASH_LOG_TRACE_VAR("GlobUnitMem.~GlobUnitMem()", _begptr);
     if (_owns_mem) {
+      dash::WriteCombineBuffer::flush();
       _allocator.deallocate(_begptr);
     }
     DASH_LOG_TRACE("GlobUnitMem.~GlobUnitMem >");
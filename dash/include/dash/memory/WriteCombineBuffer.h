@@ -0,0 +1,182 @@
+#ifndef DASH__MEMORY__WRITE_COMBINE_BUFFER_H__INCLUDED
+#define DASH__MEMORY__WRITE_COMBINE_BUFFER_H__INCLUDED
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace dash {
+
+/**
+ * Write-combining buffer of asynchronous writes of the calling unit.
+ *
+ * Values assigned to \c dash::GlobAsyncRef (e.g. via \c array.async[i])
+ * are copied into a staging buffer of the targeted unit instead of
+ * issuing a put for every element.
+ * Writes to adjacent addresses are coalesced to a single block, all
+ * blocks in a staging buffer are transferred in a single indexed put
+ * per target unit and memory segment when the buffer is drained.
+ *
+ * Buffers are drained:
+ *
+ * - when a staging buffer exceeds the buffer capacity,
+ * - in \c flush and \c flush_local of \c GlobAsyncRef and of global
+ *   memory (\c Array::flush, \c Matrix::flush, ...),
+ * - in \c Array::barrier, \c Team::barrier and \c dash::barrier.
+ *
+ * Draining only issues the puts and waits for their local completion
+ * unless it is triggered by a \c flush, so a \c flush is still required
+ * to guarantee remote completion.
+ * Buffered writes are not ordered with blocking writes to the same
+ * element; as before, a \c flush is required between them.
+ *
+ * Write-combining is disabled by default. The capacity of a staging
+ * buffer is read from the configuration key \c DASH_WRITE_COMBINE_SIZE
+ * in \c dash::init, e.g. environment variable
+ * <tt>DASH_WRITE_COMBINE_SIZE=64K</tt>, or set with \c set_capacity.
+ * A staging buffer is allocated for every targeted unit.
+ *
+ * \note Calling \c dart_flush directly does not drain buffered writes.
+ */
+class WriteCombineBuffer
+{
+public:
+  /**
+   * Statistics of buffered writes since the last \c reset_stats.
+   */
+  typedef struct {
+    /// Number of buffered writes
+    std::size_t num_writes;
+    /// Number of buffered bytes
+    std::size_t num_bytes;
+    /// Number of contiguous blocks transferred
+    std::size_t num_blocks;
+    /// Number of put operations issued
+    std::size_t num_puts;
+    /// Number of times a staging buffer was drained because it was full
+    std::size_t num_full_drains;
+    /// Number of times buffers have been drained by flush or barrier
+    std::size_t num_flushes;
+  } stats_t;
+
+public:
+  /**
+   * Set the capacity of the staging buffer of a target unit in bytes,
+   * a capacity of 0 disables write-combining.
+   * Pending writes are flushed before the capacity is changed.
+   */
+  static void set_capacity(std::size_t capacity_bytes);
+
+  /**
+   * Capacity of the staging buffer of a target unit in bytes.
+   */
+  static inline std::size_t capacity() noexcept
+  {
+    return _capacity;
+  }
+
+  /**
+   * Whether write-combining is enabled.
+   */
+  static inline bool enabled() noexcept
+  {
+    return _capacity > 0;
+  }
+
+  /**
+   * Whether buffered writes are pending.
+   */
+  static inline bool pending() noexcept
+  {
+    return _num_pending.load(std::memory_order_relaxed) > 0;
+  }
+
+  /**
+   * Buffer a write of \c nbytes bytes at \c src to the given global
+   * address.
+   *
+   * \returns  true  if the write has been buffered, false if
+   *                 write-combining is disabled or the value exceeds the
+   *                 buffer capacity.
+   */
+  static inline bool put(
+    dart_gptr_t   gptr,
+    const void  * src,
+    std::size_t   nbytes)
+  {
+    if (!enabled() || nbytes > _capacity) {
+      return false;
+    }
+    buffer_put(gptr, src, nbytes);
+    return true;
+  }
+
+  /**
+   * Transfer all buffered writes and wait for their remote completion.
+   */
+  static inline void flush()
+  {
+    if (pending()) {
+      drain(true);
+    }
+  }
+
+  /**
+   * Transfer all buffered writes and wait for their local completion.
+   */
+  static inline void flush_local()
+  {
+    if (pending()) {
+      drain(false);
+    }
+  }
+
+  /**
+   * Statistics of buffered writes of the calling unit.
+   */
+  static stats_t stats();
+
+  /**
+   * Reset statistics of buffered writes.
+   */
+  static void reset_stats();
+
+  /**
+   * Average number of buffered writes combined in a single put.
+   */
+  static double coalescing();
+
+  /**
+   * Read the buffer capacity from the configuration, called in
+   * \c dash::init.
+   */
+  static void initialize();
+
+  /**
+   * Flush buffered writes and release staging buffers, called in
+   * \c dash::finalize.
+   */
+  static void finalize();
+
+private:
+  static void buffer_put(
+    dart_gptr_t   gptr,
+    const void  * src,
+    std::size_t   nbytes);
+
+  static void drain(bool remote_completion);
+
+private:
+  static std::size_t               _capacity;
+  /// Number of buffered bytes, modified while holding the registry lock
+  /// and read without it in \c pending
+  static std::atomic<std::size_t>  _num_pending;
+};
+
+} // namespace dash
+
+#endif // DASH__MEMORY__WRITE_COMBINE_BUFFER_H__INCLUDED
@@ -1,6 +1,9 @@
 #ifndef DASH__MEMORY__INTERNAL__GLOB_HEAP_TYPES_H__INCLUDED
 #define DASH__MEMORY__INTERNAL__GLOB_HEAP_TYPES_H__INCLUDED
 
+#include <algorithm>
+#include <vector>
+
 namespace dash {
 namespace internal {
 
@@ -15,6 +18,163 @@ struct glob_dynamic_mem_bucket_type
   bool          attached;
 };
 
+/**
+ * Statistics of the commits of a global dynamic memory space at a unit.
+ */
+template<typename SizeType>
+struct glob_dynamic_mem_commit_stats
+{
+  /// Number of commits.
+  SizeType num_commits          = 0;
+  /// Number of collective operations issued in commits.
+  SizeType num_collectives      = 0;
+  /// Number of local buckets attached to global memory.
+  SizeType num_attached_buckets = 0;
+  /// Number of empty buckets attached to match the number of buckets
+  /// attached by remote units.
+  SizeType num_padding_buckets  = 0;
+  /// Number of local elements attached to global memory.
+  SizeType num_attached_elem    = 0;
+  /// Number of local elements detached from global memory.
+  SizeType num_detached_elem    = 0;
+};
+
+/**
+ * Flattened prefix index of the buckets in a global dynamic memory space.
+ *
+ * Maps global offsets to unit, bucket and offset in bucket by binary
+ * search on the offsets of units in global index space and the cumulative
+ * bucket sizes of the unit.
+ *
+ * For example, if unit 0 allocated buckets with sizes 2,3 and unit 1
+ * allocated buckets with sizes 1,3,5:
+ *
+ *   unit_offsets       = { 0, 5, 14 }
+ *   unit_buckets       = { 0, 2, 5 }
+ *   bucket_cumul_sizes = { 2, 5,  1, 4, 9 }
+ */
+template<typename SizeType>
+struct glob_dynamic_mem_index
+{
+  typedef SizeType size_type;
+
+  /// Offset of every unit's first element in global index space, followed
+  /// by the total number of elements.
+  std::vector<size_type> unit_offsets;
+  /// Offset of every unit's first bucket in \c bucket_cumul_sizes,
+  /// followed by the total number of buckets.
+  std::vector<size_type> unit_buckets;
+  /// Cumulative bucket sizes of all units, relative to the unit's first
+  /// element.
+  std::vector<size_type> bucket_cumul_sizes;
+
+  /**
+   * Rebuilds the index from a list of cumulative bucket sizes of every
+   * unit.
+   */
+  template<class UnitBucketCumulSizes>
+  void build(const UnitBucketCumulSizes & units_bucket_cumul_sizes)
+  {
+    auto const nunits = units_bucket_cumul_sizes.size();
+    unit_offsets.resize(nunits + 1);
+    unit_buckets.resize(nunits + 1);
+    bucket_cumul_sizes.clear();
+    size_type offset = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      auto const & u_cumul_sizes = units_bucket_cumul_sizes[u];
+      size_type    u_size        = u_cumul_sizes.empty()
+                                   ? 0
+                                   : u_cumul_sizes.back();
+      unit_offsets[u] = offset;
+      unit_buckets[u] = bucket_cumul_sizes.size();
+      for (auto cumul_size : u_cumul_sizes) {
+        // Shrinking the local memory space of a unit only adjusts its last
+        // cumulative bucket size, clamp preceding bucket sizes to keep the
+        // index sorted:
+        bucket_cumul_sizes.push_back(std::min(cumul_size, u_size));
+      }
+      offset += u_size;
+    }
+    unit_offsets[nunits] = offset;
+    unit_buckets[nunits] = bucket_cumul_sizes.size();
+  }
+
+  inline size_type num_units() const noexcept
+  {
+    return unit_offsets.empty() ? 0 : unit_offsets.size() - 1;
+  }
+
+  inline size_type size() const noexcept
+  {
+    return unit_offsets.empty() ? 0 : unit_offsets.back();
+  }
+
+  inline size_type unit_size(size_type unit) const noexcept
+  {
+    return unit_offsets[unit + 1] - unit_offsets[unit];
+  }
+
+  inline size_type num_buckets(size_type unit) const noexcept
+  {
+    return unit_buckets[unit + 1] - unit_buckets[unit];
+  }
+
+  /**
+   * Offset of the first element of the specified bucket in the unit's
+   * local index space.
+   */
+  inline size_type bucket_begin(size_type unit, size_type bucket)
+  const noexcept
+  {
+    return bucket == 0
+           ? 0
+           : bucket_cumul_sizes[unit_buckets[unit] + bucket - 1];
+  }
+
+  /**
+   * Offset past the final element of the specified bucket in the unit's
+   * local index space.
+   */
+  inline size_type bucket_end(size_type unit, size_type bucket)
+  const noexcept
+  {
+    return bucket_cumul_sizes[unit_buckets[unit] + bucket];
+  }
+
+  /**
+   * Unit owning the element at the given global offset, the last unit for
+   * offsets past the final element.
+   *
+   * \complexity  O(log p) for \c p units
+   */
+  size_type unit_at(size_type global_offset) const noexcept
+  {
+    auto const first = unit_offsets.begin() + 1;
+    auto const last  = unit_offsets.end()   - 1;
+    // First unit with local range ending past the offset:
+    auto const unit  = std::upper_bound(first, last, global_offset) - first;
+    return static_cast<size_type>(unit);
+  }
+
+  /**
+   * Bucket containing the element at the given offset in the unit's local
+   * index space, the last bucket for offsets past the unit's final element.
+   *
+   * \complexity  O(log b) for \c b buckets of the unit
+   */
+  size_type bucket_at(size_type unit, size_type local_offset) const noexcept
+  {
+    auto const nbuckets = num_buckets(unit);
+    if (nbuckets == 0) {
+      return 0;
+    }
+    auto const first  = bucket_cumul_sizes.begin() + unit_buckets[unit];
+    auto const last   = first + (nbuckets - 1);
+    auto const bucket = std::upper_bound(first, last, local_offset) - first;
+    return static_cast<size_type>(bucket);
+  }
+};
+
 } // namespace internal
 } // namespace dash
 
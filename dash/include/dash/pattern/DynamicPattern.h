@@ -3,6 +3,9 @@
 
 #include <functional>
 #include <array>
+#include <vector>
+#include <numeric>
+#include <algorithm>
 #include <type_traits>
 
 #include <dash/Types.h>
@@ -11,11 +14,13 @@
 #include <dash/Dimensional.h>
 #include <dash/Cartesian.h>
 #include <dash/Team.h>
-#include <dash/PatternProperties.h>
+#include <dash/pattern/PatternProperties.h>
+#include <dash/pattern/internal/PatternArguments.h>
+
+#include <dash/util/TeamLocality.h>
 
 #include <dash/internal/Math.h>
 #include <dash/internal/Logging.h>
-#include <dash/internal/PatternArguments.h>
 
 namespace dash {
 
@@ -466,26 +471,114 @@ public:
 
   /**
    * Update the number of local elements of the specified unit.
+   * The size of the pattern changes accordingly.
+   *
+   * Elements of containers using this pattern are not moved.
    */
   inline void local_resize(team_unit_t unit, size_type local_size)
   {
     _local_sizes[unit] = local_size;
+    update_local_sizes();
   }
 
   /**
    * Update the number of local elements of the active unit.
+   * The size of the pattern changes accordingly.
+   *
+   * Elements of containers using this pattern are not moved.
    */
   inline void local_resize(size_type local_size)
   {
-    _local_sizes[_myid] = local_size;
+    local_resize(_myid, local_size);
   }
 
   /**
    * Balance the number of local elements across all units in the pattern's
    * associated team.
+   *
+   * The pattern size is not changed. Local sizes of units differ by at
+   * most one element, remaining elements are assigned to the units with
+   * lowest id.
+   *
+   * Elements of containers using this pattern are not moved, see
+   * \c dash::Array::redistribute.
    */
   inline void balance()
   {
+    balance(std::vector<double>(_nunits, 1.0));
+  }
+
+  /**
+   * Distribute the pattern's elements to the units in the pattern's
+   * associated team proportional to the specified unit weights, e.g.
+   * weights obtained from \c dash::UnitClockFreqMeasure.
+   *
+   * The pattern size is not changed. Elements remaining from rounding
+   * are assigned to the units with the largest fractional share.
+   *
+   * Elements of containers using this pattern are not moved, see
+   * \c dash::Array::redistribute.
+   */
+  void balance(const std::vector<double> & unit_weights)
+  {
+    DASH_LOG_TRACE_VAR("DynamicPattern.balance()", unit_weights);
+    DASH_ASSERT_EQ(
+      unit_weights.size(), _nunits,
+      "Number of given unit weights "  << unit_weights.size() << " " <<
+      "does not match number of units" << _nunits);
+    if (_nunits == 0) {
+      return;
+    }
+    double weight_sum = 0;
+    for (auto weight : unit_weights) {
+      DASH_ASSERT_GE(weight, 0, "unit weights must not be negative");
+      weight_sum += weight;
+    }
+    if (weight_sum <= 0) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "DynamicPattern.balance: sum of unit weights must be positive");
+    }
+    // Largest remainder method:
+    std::vector<double> remainders(_nunits);
+    size_type           assigned = 0;
+    for (size_type u = 0; u < _nunits; ++u) {
+      double share    = (unit_weights[u] / weight_sum) * _size;
+      _local_sizes[u] = static_cast<size_type>(share);
+      remainders[u]   = share - _local_sizes[u];
+      assigned       += _local_sizes[u];
+    }
+    std::vector<size_type> units_by_remainder(_nunits);
+    std::iota(units_by_remainder.begin(), units_by_remainder.end(), 0);
+    std::stable_sort(units_by_remainder.begin(), units_by_remainder.end(),
+                     [&](size_type a, size_type b) {
+                       return remainders[a] > remainders[b];
+                     });
+    for (size_type r = 0; assigned < _size; ++r, ++assigned) {
+      _local_sizes[units_by_remainder[r % _nunits]]++;
+    }
+    update_local_sizes();
+    DASH_LOG_TRACE_VAR("DynamicPattern.balance >", _local_sizes);
+  }
+
+  /**
+   * Distribute the pattern's elements to the units in the pattern's
+   * associated team proportional to the unit weights determined by the
+   * specified performance measure, like \c dash::UnitClockFreqMeasure.
+   */
+  template<typename Measure>
+  inline void balance(const dash::util::TeamLocality & team_loc)
+  {
+    balance(Measure::unit_weights(team_loc));
+  }
+
+  /**
+   * Number of local elements of every unit in the pattern's associated
+   * team.
+   */
+  inline const std::vector<size_type> & local_sizes() const
+  {
+    return _local_sizes;
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -1127,7 +1220,9 @@ public:
   inline SizeType local_size(
     team_unit_t unit = UNDEFINED_TEAM_UNIT_ID) const
   {
-    return _local_size;
+    return (unit == UNDEFINED_TEAM_UNIT_ID)
+           ? _local_size
+           : _local_sizes[unit];
   }
 
   /**
@@ -1296,6 +1391,23 @@ private:
     _local_capacity(initialize_local_capacity())
   {}
 
+  /**
+   * Update members derived from the local sizes of all units after they
+   * have been changed.
+   */
+  void update_local_sizes()
+  {
+    _size                = initialize_size(_local_sizes);
+    _block_offsets       = initialize_block_offsets(_local_sizes);
+    _memory_layout       = MemoryLayout_t(std::array<SizeType, 1> { _size });
+    _blockspec           = initialize_blockspec(_size, _local_sizes);
+    _local_size          = initialize_local_extent(_myid);
+    _local_memory_layout = LocalMemoryLayout_t(
+                             std::array<SizeType, 1> { _local_size });
+    _local_capacity      = initialize_local_capacity();
+    initialize_local_range();
+  }
+
   /**
    * Initialize the size (number of mapped elements) of the Pattern.
    */
@@ -1333,8 +1445,11 @@ private:
     if (dist_type == dash::internal::DIST_BLOCKED ||
         dist_type == dash::internal::DIST_TILE) {
       auto blocksize = dash::math::div_ceil(total_size, nunits);
+      auto remaining = total_size;
       for (size_type u = 0; u < nunits; ++u) {
-        l_sizes.push_back(blocksize);
+        auto l_size = std::min<size_type>(blocksize, remaining);
+        l_sizes.push_back(l_size);
+        remaining  -= l_size;
       }
     // Unspecified distribution (default-constructed pattern instance),
     // set all local sizes to 0:
@@ -0,0 +1,95 @@
+#ifndef DASH__UTIL__COMM_PROFILE_H__
+#define DASH__UTIL__COMM_PROFILE_H__
+
+#include <dash/Types.h>
+
+#include <dash/dart/if/dart_profile.h>
+
+#include <iostream>
+#include <string>
+
+
+namespace dash {
+namespace util {
+
+/**
+ * Access to profiling counters of DART communication operations of the
+ * calling unit.
+ *
+ * Usage:
+ *
+ * \code
+ *   dash::util::CommProfile::on();
+ *   // ... communication ...
+ *   auto gets = dash::util::CommProfile::counters(DART_PROFILE_OP_GET);
+ *   std::cout << gets.num_calls << " gets, "
+ *             << gets.num_bytes << " bytes" << std::endl;
+ *   dash::util::CommProfile::write(std::cout);
+ *   dash::util::CommProfile::off();
+ * \endcode
+ *
+ * Profiling requires DART to be built with CMake option
+ * \c ENABLE_DART_PROFILING. It can also be enabled at startup by setting
+ * environment variable \c DART_PROFILE to \c on, counters are then
+ * written in \c dash::finalize.
+ *
+ * \see DartProfile
+ */
+class CommProfile
+{
+public:
+  typedef dart_profile_op_t         op_t;
+  typedef dart_profile_counters_t   counters_t;
+
+public:
+  /**
+   * Enable profiling of DART communication operations.
+   *
+   * \returns  true  if profiling has been enabled, false if DART has
+   *                 been built without profiling support.
+   */
+  static bool on();
+
+  /**
+   * Disable profiling of DART communication operations.
+   */
+  static void off();
+
+  /**
+   * Whether profiling of DART communication operations is enabled.
+   */
+  static bool enabled();
+
+  /**
+   * Reset all profiling counters of the calling unit.
+   */
+  static void reset();
+
+  /**
+   * Counters of the given operation accumulated over all target units.
+   */
+  static counters_t counters(op_t op);
+
+  /**
+   * Counters of the given operation targeting the given unit.
+   * Only available for operations preceding
+   * \c DART_PROFILE_OP_LAST_UNIT.
+   */
+  static counters_t counters(op_t op, dash::global_unit_t unit);
+
+  /**
+   * Name of the given operation, e.g. "dart_get".
+   */
+  static std::string op_name(op_t op);
+
+  /**
+   * Write counters of all operations called by the calling unit to given
+   * output stream.
+   */
+  static void write(std::ostream & out);
+};
+
+} // namespace util
+} // namespace dash
+
+#endif // DASH__UTIL__COMM_PROFILE_H__
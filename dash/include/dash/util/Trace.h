@@ -3,38 +3,132 @@
 
 #include <dash/Init.h>
 #include <dash/util/Timer.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace dash {
 namespace util {
 
+/**
+ * Storage of trace events recorded by instances of \c dash::util::Trace.
+ *
+ * Every thread records events into its own fixed-capacity ring buffer,
+ * allocated when the thread records its first event. Recording events by
+ * interned state id does not lock or allocate, see
+ * \c dash::util::Trace::state.
+ * State and context names are interned to integer ids, events only
+ * consist of a timestamp counter value and name ids.
+ * If the number of events recorded by a thread exceeds the buffer
+ * capacity, the oldest events are overwritten.
+ *
+ * Reading trace data (\c write, \c context_trace) and \c clear must not
+ * be called concurrently to threads recording events.
+ */
 class TraceStore
 {
 public:
   typedef std::string
     state_t;
-  typedef dash::util::Timer<dash::util::TimeMeasure::Clock>
+  /// Interned id of a state or context name
+  typedef uint16_t
+    state_id_t;
+  typedef dash::util::Timer<dash::util::TimeMeasure::Counter>
     timer_t;
   typedef typename timer_t::timestamp_t
     timestamp_t;
+  /// Time span of a state in microseconds since tracing has been enabled
   typedef struct {
-    timestamp_t start;
-    timestamp_t end;
+    double      start;
+    double      end;
     state_t     state;
   } state_timespan_t;
   typedef std::vector<state_timespan_t>
     trace_events_t;
 
+  enum class event_phase : uint8_t {
+    enter,
+    exit
+  };
+
+  typedef struct {
+    timestamp_t  ts;
+    state_id_t   state;
+    state_id_t   context;
+    event_phase  phase;
+  } trace_event_t;
+
+  /**
+   * Ring buffer of trace events recorded by a single thread.
+   */
+  class event_buffer
+  {
+  public:
+    event_buffer(std::size_t capacity, int thread_idx);
+
+    /**
+     * Record an event, overwrites the oldest event if the buffer is full.
+     */
+    inline void push(const trace_event_t & event) noexcept
+    {
+      auto const head = _head.load(std::memory_order_relaxed);
+      _events[head & _mask] = event;
+      _head.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * Number of events currently stored in the buffer.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * Number of events overwritten since the last \c clear.
+     */
+    std::size_t dropped() const noexcept;
+
+    /**
+     * Event at the given offset from the oldest stored event.
+     */
+    const trace_event_t & operator[](std::size_t idx) const noexcept;
+
+    inline int thread_index() const noexcept
+    {
+      return _thread_idx;
+    }
+
+    void clear() noexcept;
+
+    /**
+     * Remove all events recorded in the given context.
+     */
+    void erase_context(state_id_t context) noexcept;
+
+  private:
+    std::vector<trace_event_t> _events;
+    std::size_t                _mask;
+    int                        _thread_idx;
+    std::atomic<std::size_t>   _head;
+  };
+
 public:
   /**
    * Enable trace storage if environment variable DASH_ENABLE_TRACE
    * is set to 'on'.
    *
+   * The size of event buffers of threads that record their first event
+   * after this call is read from environment variable
+   * DASH_TRACE_BUFFER_SIZE, e.g. "4M", and defaults to 1 MB.
+   *
    * \returns  true  if trace storage has been enabled, otherwise false.
    */
   static bool on();
@@ -47,7 +141,10 @@ public:
   /**
    * Whether trace storage is enabled.
    */
-  static bool enabled();
+  static inline bool enabled()
+  {
+    return _trace_enabled.load(std::memory_order_relaxed);
+  }
 
   /**
    * Clear trace data.
@@ -65,44 +162,120 @@ public:
   static void add_context(const std::string & context);
 
   /**
-   * Return reference to traces list for given context.
+   * Time spans of states recorded in given context by all threads of the
+   * calling unit.
    */
-  static trace_events_t & context_trace(const std::string & context);
+  static trace_events_t context_trace(const std::string & context);
 
   /**
-   * Write trace data to given output stream.
+   * Interned id of the given state or context name.
+   */
+  static inline state_id_t state_id(const state_t & state)
+  {
+    static thread_local std::unordered_map<state_t, state_id_t> ids;
+    auto it = ids.find(state);
+    if (it != ids.end()) {
+      return it->second;
+    }
+    auto id = intern(state);
+    ids.emplace(state, id);
+    return id;
+  }
+
+  /**
+   * Name of state or context with the given interned id.
+   */
+  static state_t state_name(state_id_t id);
+
+  /**
+   * Record an event in the event buffer of the calling thread.
+   */
+  static inline void record(
+    state_id_t  context,
+    state_id_t  state,
+    event_phase phase) noexcept
+  {
+    trace_event_t event;
+    event.ts      = timer_t::Now();
+    event.state   = state;
+    event.context = context;
+    event.phase   = phase;
+    thread_buffer().push(event);
+  }
+
+  /**
+   * Write trace data of the calling unit to given output stream.
    */
   static void write(std::ostream & out, bool printHeader = true);
 
   /**
-   * Write trace data to file.
+   * Write trace data of the calling unit to file.
    */
   static void write(
     const std::string & filename,
     const std::string & path = "");
 
+  /**
+   * Write trace data of all units to a single file in Chrome trace event
+   * format, to be viewed in \c chrome://tracing or Perfetto.
+   * Units are listed as processes, threads of a unit as its threads.
+   *
+   * Collective operation, the file is written by unit 0.
+   * Timestamps of units are aligned at a barrier in this call.
+   */
+  static void write_chrome_json(
+    const std::string & filename,
+    const std::string & path = "");
+
+  /**
+   * Write trace data of all units to given output stream at unit 0 in
+   * Chrome trace event format.
+   *
+   * Collective operation.
+   */
+  static void write_chrome_json(std::ostream & out);
+
 private:
-  static std::map<std::string, trace_events_t> _traces;
-  static bool                                  _trace_enabled;
+  static inline event_buffer & thread_buffer() noexcept
+  {
+    static thread_local event_buffer * buffer = nullptr;
+    if (buffer == nullptr) {
+      buffer = add_thread_buffer();
+    }
+    return *buffer;
+  }
+
+  static state_id_t     intern(const state_t & state);
+
+  static event_buffer * add_thread_buffer();
+
+  static double         ticks_per_usec();
+
+private:
+  static std::atomic<bool>  _trace_enabled;
+  static std::size_t        _buffer_capacity;
 };
 
 class Trace
 {
 private:
-  typedef typename TraceStore::timestamp_t
-    timestamp_t;
   typedef typename TraceStore::state_t
     state_t;
-  typedef typename TraceStore::timer_t
-    timer_t;
-  typedef typename TraceStore::state_timespan_t
-    state_timespan_t;
-  typedef typename TraceStore::trace_events_t
-    trace_events_t;
+  typedef typename TraceStore::state_id_t
+    state_id_t;
+  typedef typename TraceStore::event_phase
+    event_phase;
+
+  /// Maximum nesting depth of recorded states, states entered at deeper
+  /// levels are not recorded
+  static constexpr int max_depth = 16;
 
 private:
-  std::string _context;
-  timestamp_t _ts_start;
+  std::string                         _context;
+  state_id_t                          _context_id   = 0;
+  bool                                _context_init = false;
+  std::array<state_id_t, max_depth>   _states;
+  int                                 _depth        = 0;
 
 public:
   Trace() : Trace("global")
@@ -114,10 +287,29 @@ public:
     if (!TraceStore::enabled()) {
       return;
     }
-    TraceStore::add_context(_context);
-    timer_t::Calibrate(0);
-    dash::barrier();
-    _ts_start = timer_t::Now();
+    context_id();
+  }
+
+  /**
+   * Trace in the context with the given interned id, see \c state.
+   */
+  explicit Trace(state_id_t context)
+  : _context_id(context),
+    _context_init(true)
+  { }
+
+  /**
+   * Interned id of the given state or context name, to be used in
+   * \c enter_state to avoid resolving the name on every event:
+   *
+   * \code
+   *   static const auto state_id = dash::util::Trace::state("local");
+   *   trace.enter_state(state_id);
+   * \endcode
+   */
+  static inline state_id_t state(const state_t & state)
+  {
+    return TraceStore::state_id(state);
   }
 
   inline void enter_state(const state_t & state)
@@ -125,23 +317,55 @@ public:
     if (!TraceStore::enabled()) {
       return;
     }
-    state_timespan_t state_timespan;
-    timestamp_t ts_event = timer_t::Now() - _ts_start;
-    state_timespan.start = ts_event;
-    state_timespan.end   = ts_event;
-    state_timespan.state = state;
-    TraceStore::context_trace(_context).push_back(state_timespan);
+    enter_state(TraceStore::state_id(state));
   }
 
-  inline void exit_state(const state_t &)
+  inline void enter_state(state_id_t state)
   {
     if (!TraceStore::enabled()) {
       return;
     }
-    timestamp_t ts_event = timer_t::Now() - _ts_start;
-    TraceStore::context_trace(_context).back().end = ts_event;
+    if (_depth++ < max_depth) {
+      _states[_depth - 1] = state;
+      TraceStore::record(context_id(), state, event_phase::enter);
+    }
+  }
+
+  /**
+   * Exit the most recently entered state.
+   */
+  inline void exit_state(const state_t &)
+  {
+    exit_state();
+  }
+
+  /**
+   * Exit the most recently entered state.
+   */
+  inline void exit_state(state_id_t)
+  {
+    exit_state();
   }
 
+  inline void exit_state()
+  {
+    if (!TraceStore::enabled() || _depth == 0) {
+      return;
+    }
+    if (--_depth < max_depth) {
+      TraceStore::record(context_id(), _states[_depth], event_phase::exit);
+    }
+  }
+
+private:
+  inline state_id_t context_id()
+  {
+    if (!_context_init) {
+      _context_id   = TraceStore::state_id(_context);
+      _context_init = true;
+    }
+    return _context_id;
+  }
 };
 
 } // namspace util
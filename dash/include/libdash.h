@@ -41,6 +41,7 @@ namespace dash {
 #include <dash/Onesided.h>
 
 #include <dash/LaunchPolicy.h>
+#include <dash/Execution.h>
 
 #include <dash/Container.h>
 #include <dash/Shared.h>
@@ -57,6 +58,7 @@ namespace dash {
 #include <dash/util/BenchmarkParams.h>
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
+#include <dash/util/CommProfile.h>
 #include <dash/util/PatternMetrics.h>
 #include <dash/util/Timer.h>
 
@@ -68,6 +70,7 @@ namespace dash {
 
 #include <dash/IO.h>
 #include <dash/io/HDF5.h>
+#include <dash/io/Checkpoint.h>
 
 #include <dash/internal/Math.h>
 #include <dash/internal/Logging.h>
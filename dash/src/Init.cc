@@ -6,6 +6,7 @@
 
 #include <dash/util/Locality.h>
 #include <dash/util/Config.h>
+#include <dash/memory/WriteCombineBuffer.h>
 #include <dash/internal/Logging.h>
 
 #include <dash/internal/Annotation.h>
@@ -68,6 +69,8 @@ void dash::init(int * argc, char ** *argv)
 
   DASH_LOG_DEBUG("dash::init", "dash::util::Locality::init()");
   dash::util::Locality::init();
+
+  dash::WriteCombineBuffer::initialize();
   DASH_LOG_DEBUG("dash::init >");
 }
 
@@ -84,6 +87,9 @@ void dash::finalize()
   // Wait for all units:
   dash::barrier();
 
+  // Complete buffered writes before global memory is deallocated:
+  dash::WriteCombineBuffer::finalize();
+
   // Deallocate global memory allocated in teams:
   DASH_LOG_DEBUG("dash::finalize", "free team global memory");
   dash::Team::finalize();
@@ -49,14 +49,17 @@ void mmult_local<float>(
   auto   tp_a  = CblasNoTrans;
   auto   tp_b  = CblasNoTrans;
   /// Leading dimension of A, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   lda   = k;
+  /// rows (for row major storage) or columns (for column major storage) in
+  /// memory.
+  auto   lda   = (storage == dash::ROW_MAJOR) ? k : m;
   /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldb   = n;
-  /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldc   = n;
+  /// rows (for row major storage) or columns (for column major storage) in
+  /// memory.
+  auto   ldb   = (storage == dash::ROW_MAJOR) ? n : k;
+  /// Leading dimension of C, or the number of elements between successive
+  /// rows (for row major storage) or columns (for column major storage) in
+  /// memory.
+  auto   ldc   = (storage == dash::ROW_MAJOR) ? n : m;
   /// Real value used to scale the product of matrices A and B.
   value_t alpha = 1.0;
   /// Real value used to scale matrix C.
@@ -114,14 +117,17 @@ void mmult_local<double>(
   auto   tp_a  = CblasNoTrans;
   auto   tp_b  = CblasNoTrans;
   /// Leading dimension of A, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   lda   = k;
-  /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldb   = n;
+  /// rows (for row major storage) or columns (for column major storage) in
+  /// memory.
+  auto   lda   = (storage == dash::ROW_MAJOR) ? k : m;
   /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldc   = n;
+  /// rows (for row major storage) or columns (for column major storage) in
+  /// memory.
+  auto   ldb   = (storage == dash::ROW_MAJOR) ? n : k;
+  /// Leading dimension of C, or the number of elements between successive
+  /// rows (for row major storage) or columns (for column major storage) in
+  /// memory.
+  auto   ldc   = (storage == dash::ROW_MAJOR) ? n : m;
   /// Real value used to scale the product of matrices A and B.
   value_t alpha = 1.0;
   /// Real value used to scale matrix C.
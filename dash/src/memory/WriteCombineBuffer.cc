@@ -0,0 +1,350 @@
+#include <dash/memory/WriteCombineBuffer.h>
+
+#include <dash/Init.h>
+#include <dash/Exception.h>
+#include <dash/util/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/**
+ * Buffered write, or sequence of buffered writes to adjacent addresses.
+ */
+struct wcb_run
+{
+  dart_gptr_t gptr;
+  /// Offset of the written bytes in the staging buffer
+  std::size_t staging_offset;
+  std::size_t nbytes;
+};
+
+/**
+ * Staging buffer of writes to a single target unit.
+ */
+struct wcb_target
+{
+  std::vector<char>    staging;
+  std::vector<wcb_run> runs;
+};
+
+struct wcb_registry
+{
+  std::mutex                                mutex;
+  /// Staging buffers by team id and unit id of the target unit
+  std::unordered_map<uint64_t, wcb_target>  targets;
+  uint64_t                                  last_key    = 0;
+  wcb_target                              * last_target = nullptr;
+  /// Writes of all targets sorted and packed into blocks
+  std::vector<char>                         pack;
+  std::vector<dart_handle_t>                handles;
+  std::vector<std::size_t>                  order;
+  std::vector<std::size_t>                  blocklen;
+  std::vector<std::size_t>                  blockoffs;
+  dash::WriteCombineBuffer::stats_t         stats;
+};
+
+wcb_registry & registry()
+{
+  static wcb_registry reg;
+  return reg;
+}
+
+inline uint64_t target_key(const dart_gptr_t & gptr)
+{
+  return (static_cast<uint64_t>(static_cast<uint16_t>(gptr.teamid)) << 32)
+         | static_cast<uint32_t>(gptr.unitid);
+}
+
+inline bool same_segment(const dart_gptr_t & a, const dart_gptr_t & b)
+{
+  return a.segid  == b.segid  &&
+         a.teamid == b.teamid &&
+         a.unitid == b.unitid &&
+         a.flags  == b.flags;
+}
+
+/**
+ * Issues puts of all writes buffered for the given target.
+ * Packed data is appended to \c reg.pack which must have sufficient
+ * capacity reserved, handles of pending puts are appended to
+ * \c reg.handles.
+ */
+void issue_target(wcb_registry & reg, wcb_target & target)
+{
+  auto & runs  = target.runs;
+  auto & order = reg.order;
+  if (runs.empty()) {
+    return;
+  }
+  order.resize(runs.size());
+  for (std::size_t r = 0; r < runs.size(); ++r) {
+    order[r] = r;
+  }
+  // Stable sort keeps the latest of multiple writes to the same address
+  // last:
+  std::stable_sort(order.begin(), order.end(),
+    [&](std::size_t a, std::size_t b) {
+      const auto & ga = runs[a].gptr;
+      const auto & gb = runs[b].gptr;
+      if (ga.segid != gb.segid) { return ga.segid < gb.segid; }
+      if (ga.flags != gb.flags) { return ga.flags < gb.flags; }
+      return ga.addr_or_offs.offset < gb.addr_or_offs.offset;
+    });
+
+  std::size_t group_begin = 0;
+  while (group_begin < order.size()) {
+    const auto & gptr_begin = runs[order[group_begin]].gptr;
+    std::size_t  group_end  = group_begin + 1;
+    while (group_end < order.size() &&
+           same_segment(runs[order[group_end]].gptr, gptr_begin)) {
+      ++group_end;
+    }
+    // Pack writes of the segment into blocks of adjacent addresses:
+    auto & blocklen  = reg.blocklen;
+    auto & blockoffs = reg.blockoffs;
+    blocklen.clear();
+    blockoffs.clear();
+    std::size_t pack_begin = reg.pack.size();
+    uint64_t    prev_offs  = 0;
+    std::size_t prev_len   = 0;
+    bool        overlap    = false;
+    for (std::size_t o = group_begin; o < group_end; ++o) {
+      const auto & run  = runs[order[o]];
+      uint64_t     offs = run.gptr.addr_or_offs.offset;
+      const char * src  = target.staging.data() + run.staging_offset;
+      if (!blocklen.empty() && offs == prev_offs && run.nbytes == prev_len) {
+        // Overwrite previous write to the same address:
+        std::memcpy(reg.pack.data() + reg.pack.size() - run.nbytes,
+                    src, run.nbytes);
+        continue;
+      }
+      if (!blocklen.empty() && offs < prev_offs + prev_len) {
+        overlap = true;
+        break;
+      }
+      reg.pack.insert(reg.pack.end(), src, src + run.nbytes);
+      if (!blocklen.empty() &&
+          offs == blockoffs.back() + blocklen.back()) {
+        blocklen.back() += run.nbytes;
+      } else {
+        blockoffs.push_back(offs);
+        blocklen.push_back(run.nbytes);
+      }
+      prev_offs = offs;
+      prev_len  = run.nbytes;
+    }
+
+    if (overlap) {
+      // Partially overlapping writes, transfer in order of writes:
+      reg.pack.resize(pack_begin);
+      for (const auto & run : runs) {
+        if (same_segment(run.gptr, gptr_begin)) {
+          DASH_ASSERT_RETURNS(
+            dart_put_blocking(
+              run.gptr, target.staging.data() + run.staging_offset,
+              run.nbytes, DART_TYPE_BYTE, DART_TYPE_BYTE),
+            DART_OK);
+          ++reg.stats.num_puts;
+          ++reg.stats.num_blocks;
+        }
+      }
+      group_begin = group_end;
+      continue;
+    }
+
+    dart_gptr_t   gptr       = gptr_begin;
+    std::size_t   pack_bytes = reg.pack.size() - pack_begin;
+    dart_handle_t handle     = DART_HANDLE_NULL;
+    gptr.addr_or_offs.offset = blockoffs.front();
+    if (blocklen.size() == 1) {
+      DASH_ASSERT_RETURNS(
+        dart_put_handle(
+          gptr, reg.pack.data() + pack_begin, pack_bytes,
+          DART_TYPE_BYTE, DART_TYPE_BYTE, &handle),
+        DART_OK);
+    } else {
+      uint64_t base_offs = blockoffs.front();
+      for (auto & offs : blockoffs) {
+        offs -= base_offs;
+      }
+      dart_datatype_t dst_type;
+      DASH_ASSERT_RETURNS(
+        dart_type_create_indexed(
+          DART_TYPE_BYTE, blocklen.size(), blocklen.data(),
+          blockoffs.data(), &dst_type),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_put_handle(
+          gptr, reg.pack.data() + pack_begin, pack_bytes,
+          DART_TYPE_BYTE, dst_type, &handle),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_type_destroy(&dst_type),
+        DART_OK);
+    }
+    if (handle != DART_HANDLE_NULL) {
+      reg.handles.push_back(handle);
+    }
+    ++reg.stats.num_puts;
+    reg.stats.num_blocks += blocklen.size();
+    group_begin = group_end;
+  }
+  target.staging.clear();
+  target.runs.clear();
+}
+
+void complete(wcb_registry & reg, bool remote_completion)
+{
+  if (!reg.handles.empty()) {
+    if (remote_completion) {
+      DASH_ASSERT_RETURNS(
+        dart_waitall(reg.handles.data(), reg.handles.size()),
+        DART_OK);
+    } else {
+      DASH_ASSERT_RETURNS(
+        dart_waitall_local(reg.handles.data(), reg.handles.size()),
+        DART_OK);
+    }
+    reg.handles.clear();
+  }
+  reg.pack.clear();
+}
+
+} // namespace
+
+std::size_t              dash::WriteCombineBuffer::_capacity = 0;
+std::atomic<std::size_t> dash::WriteCombineBuffer::_num_pending(0);
+
+void dash::WriteCombineBuffer::buffer_put(
+  dart_gptr_t   gptr,
+  const void  * src,
+  std::size_t   nbytes)
+{
+  auto & reg = registry();
+  std::unique_lock<std::mutex> lock(reg.mutex, std::defer_lock);
+  if (dash::is_multithreaded()) {
+    lock.lock();
+  }
+  auto key = target_key(gptr);
+  if (reg.last_target == nullptr || reg.last_key != key) {
+    auto & target = reg.targets[key];
+    if (target.staging.capacity() < _capacity) {
+      target.staging.reserve(_capacity);
+    }
+    reg.last_key    = key;
+    reg.last_target = &target;
+  }
+  auto & target = *reg.last_target;
+
+  if (target.staging.size() + nbytes > _capacity) {
+    DASH_LOG_TRACE("WriteCombineBuffer.put", "drain full staging buffer",
+                   "unit:", gptr.unitid);
+    auto staged_bytes = target.staging.size();
+    reg.pack.reserve(staged_bytes);
+    issue_target(reg, target);
+    complete(reg, false);
+    _num_pending.fetch_sub(staged_bytes, std::memory_order_relaxed);
+    ++reg.stats.num_full_drains;
+  }
+
+  const char * bytes = static_cast<const char *>(src);
+  if (!target.runs.empty()) {
+    auto & last = target.runs.back();
+    if (same_segment(last.gptr, gptr) &&
+        last.gptr.addr_or_offs.offset + last.nbytes
+          == gptr.addr_or_offs.offset) {
+      // Append to preceding write to adjacent address:
+      last.nbytes += nbytes;
+      target.staging.insert(target.staging.end(), bytes, bytes + nbytes);
+      _num_pending.fetch_add(nbytes, std::memory_order_relaxed);
+      ++reg.stats.num_writes;
+      reg.stats.num_bytes += nbytes;
+      return;
+    }
+  }
+  wcb_run run;
+  run.gptr           = gptr;
+  run.staging_offset = target.staging.size();
+  run.nbytes         = nbytes;
+  target.runs.push_back(run);
+  target.staging.insert(target.staging.end(), bytes, bytes + nbytes);
+  _num_pending.fetch_add(nbytes, std::memory_order_relaxed);
+  ++reg.stats.num_writes;
+  reg.stats.num_bytes += nbytes;
+}
+
+void dash::WriteCombineBuffer::drain(bool remote_completion)
+{
+  auto & reg = registry();
+  std::unique_lock<std::mutex> lock(reg.mutex, std::defer_lock);
+  if (dash::is_multithreaded()) {
+    lock.lock();
+  }
+  DASH_LOG_TRACE("WriteCombineBuffer.drain()",
+                 "pending bytes:", _num_pending.load(),
+                 "remote completion:", remote_completion);
+  // Packed data must not be reallocated before puts have completed:
+  reg.pack.reserve(_num_pending.load(std::memory_order_relaxed));
+  for (auto & target : reg.targets) {
+    issue_target(reg, target.second);
+  }
+  complete(reg, remote_completion);
+  _num_pending.store(0, std::memory_order_relaxed);
+  ++reg.stats.num_flushes;
+}
+
+void dash::WriteCombineBuffer::set_capacity(std::size_t capacity_bytes)
+{
+  flush();
+  auto & reg = registry();
+  std::unique_lock<std::mutex> lock(reg.mutex, std::defer_lock);
+  if (dash::is_multithreaded()) {
+    lock.lock();
+  }
+  DASH_LOG_DEBUG("WriteCombineBuffer.set_capacity()", capacity_bytes);
+  if (capacity_bytes < _capacity) {
+    // Release staging buffers, reallocated on next write:
+    reg.targets.clear();
+    reg.last_target = nullptr;
+  }
+  _capacity = capacity_bytes;
+}
+
+dash::WriteCombineBuffer::stats_t dash::WriteCombineBuffer::stats()
+{
+  return registry().stats;
+}
+
+void dash::WriteCombineBuffer::reset_stats()
+{
+  registry().stats = stats_t();
+}
+
+double dash::WriteCombineBuffer::coalescing()
+{
+  auto & stats = registry().stats;
+  if (stats.num_puts == 0) {
+    return 0;
+  }
+  return static_cast<double>(stats.num_writes) / stats.num_puts;
+}
+
+void dash::WriteCombineBuffer::initialize()
+{
+  set_capacity(
+    dash::util::Config::get<std::size_t>("DASH_WRITE_COMBINE_SIZE_BYTES"));
+  reset_stats();
+}
+
+void dash::WriteCombineBuffer::finalize()
+{
+  set_capacity(0);
+}
@@ -0,0 +1,106 @@
+#include <dash/util/CommProfile.h>
+#include <dash/Init.h>
+#include <dash/Exception.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+
+namespace dash {
+namespace util {
+
+bool CommProfile::on()
+{
+  return dart_profile_enable(true) == DART_OK;
+}
+
+void CommProfile::off()
+{
+  DASH_ASSERT_RETURNS(
+    dart_profile_enable(false),
+    DART_OK);
+}
+
+bool CommProfile::enabled()
+{
+  bool enabled = false;
+  DASH_ASSERT_RETURNS(
+    dart_profile_is_enabled(&enabled),
+    DART_OK);
+  return enabled;
+}
+
+void CommProfile::reset()
+{
+  DASH_ASSERT_RETURNS(
+    dart_profile_reset(),
+    DART_OK);
+}
+
+CommProfile::counters_t CommProfile::counters(op_t op)
+{
+  counters_t counters;
+  if (dart_profile_counters(op, &counters) != DART_OK) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "CommProfile::counters: invalid operation " << op);
+  }
+  return counters;
+}
+
+CommProfile::counters_t CommProfile::counters(
+  op_t                op,
+  dash::global_unit_t unit)
+{
+  counters_t counters;
+  if (dart_profile_unit_counters(op, unit, &counters) != DART_OK) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "CommProfile::counters: operation " << op_name(op) <<
+      " is not profiled for unit " << unit);
+  }
+  return counters;
+}
+
+std::string CommProfile::op_name(op_t op)
+{
+  return dart_profile_op_name(op);
+}
+
+void CommProfile::write(std::ostream & out)
+{
+  auto myid = dash::myid();
+  out << "# [COMM PROFILE] unit " << myid << std::endl;
+  out << "# " << std::left  << std::setw(22) << "operation"
+              << std::right << std::setw(12) << "calls"
+              << std::setw(12) << "shmem"
+              << std::setw(16) << "bytes"
+              << std::setw(14) << "total_us"
+              << std::setw(14) << "max_us"
+      << std::endl;
+  for (int op = 0; op < DART_PROFILE_OP_LAST; ++op) {
+    auto c = counters(static_cast<op_t>(op));
+    if (c.num_calls == 0) {
+      continue;
+    }
+    out << "  " << std::left  << std::setw(22)
+                << op_name(static_cast<op_t>(op))
+                << std::right << std::setw(12) << c.num_calls
+                << std::setw(12) << c.num_shmem
+                << std::setw(16) << c.num_bytes
+                << std::fixed << std::setprecision(3)
+                << std::setw(14) << (c.total_ns * 1e-3)
+                << std::setw(14) << (c.max_ns * 1e-3)
+        << std::endl;
+    out << "  " << std::left << std::setw(22) << "  latency histogram:"
+        << std::right;
+    for (int b = 0; b < DART_PROFILE_NUM_BINS; ++b) {
+      out << " " << c.latency_hist[b];
+    }
+    out << std::endl;
+  }
+}
+
+} // namespace util
+} // namespace dash
@@ -1,61 +1,321 @@
 #include <dash/util/Trace.h>
 #include <dash/util/Config.h>
 #include <dash/Team.h>
+#include <dash/Exception.h>
 
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <map>
+#include <mutex>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <unistd.h>
 
-std::map<std::string, dash::util::TraceStore::trace_events_t>
-dash::util::TraceStore::_traces
-  = {{ }};
+namespace {
 
-bool dash::util::TraceStore::_trace_enabled
-  = false;
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock>
+  clock_timer_t;
 
-bool dash::util::TraceStore::on()
+/**
+ * Interned names and event buffers of all threads of the unit.
+ */
+struct trace_registry
+{
+  std::mutex                                              mutex;
+  std::vector<std::string>                                names;
+  std::unordered_map<std::string,
+                     dash::util::TraceStore::state_id_t>  ids;
+  std::vector<
+    std::unique_ptr<dash::util::TraceStore::event_buffer>> buffers;
+  /// Timestamp counter value when tracing has been enabled first
+  dash::util::TraceStore::timestamp_t                     counter_start = 0;
+  /// Clock timestamp when tracing has been enabled first
+  clock_timer_t::timestamp_t                              clock_start   = 0;
+  bool                                                    started       = false;
+};
+
+trace_registry & registry()
 {
-  _trace_enabled = dash::util::Config::get<bool>("DASH_ENABLE_TRACE");
-  return _trace_enabled;
+  static trace_registry reg;
+  return reg;
 }
 
-void dash::util::TraceStore::off()
+/**
+ * Records reference timestamps to convert counter values to microseconds,
+ * requires lock on registry.
+ */
+void start_clock(trace_registry & reg)
+{
+  if (reg.started) {
+    return;
+  }
+  clock_timer_t::Calibrate(0);
+  reg.clock_start   = clock_timer_t::Now();
+  reg.counter_start = dash::util::TraceStore::timer_t::Now();
+  reg.started       = true;
+}
+
+/**
+ * Time spans of states recorded in an event buffer.
+ * Enter and exit events of a thread are properly nested, exit events of
+ * states entered before the oldest event in the buffer are skipped.
+ */
+template<class SpanFun>
+void for_each_timespan(
+  const dash::util::TraceStore::event_buffer & buffer,
+  SpanFun                                      span_fun)
+{
+  typedef dash::util::TraceStore::event_phase event_phase;
+  std::vector<std::size_t> entered;
+  for (std::size_t e = 0; e < buffer.size(); ++e) {
+    auto const & event = buffer[e];
+    if (event.phase == event_phase::enter) {
+      entered.push_back(e);
+    } else if (!entered.empty()) {
+      span_fun(buffer[entered.back()], event);
+      entered.pop_back();
+    }
+  }
+}
+
+/**
+ * Escapes a string for use in a JSON string literal.
+ */
+std::string json_escape(const std::string & str)
+{
+  std::ostringstream os;
+  for (auto c : str) {
+    switch (c) {
+      case '"':  os << "\\\""; break;
+      case '\\': os << "\\\\"; break;
+      case '\n': os << "\\n";  break;
+      case '\t': os << "\\t";  break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+             << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+          os << c;
+        }
+    }
+  }
+  return os.str();
+}
+
+/// Message tag of trace data sent to unit 0 in write_chrome_json
+constexpr int trace_msg_tag = 0x3000;
+
+} // namespace
+
+std::atomic<bool> dash::util::TraceStore::_trace_enabled
+  = { false };
+
+std::size_t dash::util::TraceStore::_buffer_capacity
+  = 0;
+
+dash::util::TraceStore::event_buffer::event_buffer(
+  std::size_t capacity,
+  int         thread_idx)
+: _thread_idx(thread_idx),
+  _head(0)
+{
+  // Round capacity down to power of two:
+  std::size_t cap = 1;
+  while (cap * 2 <= capacity) {
+    cap *= 2;
+  }
+  _events.resize(cap);
+  _mask = cap - 1;
+}
+
+std::size_t dash::util::TraceStore::event_buffer::size() const noexcept
+{
+  return std::min(_head.load(std::memory_order_acquire), _events.size());
+}
+
+std::size_t dash::util::TraceStore::event_buffer::dropped() const noexcept
+{
+  return _head.load(std::memory_order_acquire) - size();
+}
+
+const dash::util::TraceStore::trace_event_t &
+dash::util::TraceStore::event_buffer::operator[](
+  std::size_t idx) const noexcept
 {
-  _trace_enabled = false;
+  return _events[(dropped() + idx) & _mask];
 }
 
-bool dash::util::TraceStore::enabled()
+void dash::util::TraceStore::event_buffer::clear() noexcept
 {
-  return _trace_enabled == true;
+  _head.store(0, std::memory_order_release);
+}
+
+void dash::util::TraceStore::event_buffer::erase_context(
+  state_id_t context) noexcept
+{
+  std::vector<trace_event_t> keep;
+  for (std::size_t e = 0; e < size(); ++e) {
+    auto const & event = (*this)[e];
+    if (event.context != context) {
+      keep.push_back(event);
+    }
+  }
+  std::copy(keep.begin(), keep.end(), _events.begin());
+  _head.store(keep.size(), std::memory_order_release);
+}
+
+bool dash::util::TraceStore::on()
+{
+  if (dash::util::Config::get<bool>("DASH_ENABLE_TRACE")) {
+    auto & reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    start_clock(reg);
+    _buffer_capacity = 0;
+    if (dash::util::Config::is_set("DASH_TRACE_BUFFER_SIZE")) {
+      _buffer_capacity = dash::util::Config::get<std::size_t>(
+                           "DASH_TRACE_BUFFER_SIZE_BYTES")
+                         / sizeof(trace_event_t);
+    }
+    if (_buffer_capacity == 0) {
+      _buffer_capacity = (1 << 20) / sizeof(trace_event_t);
+    }
+    _trace_enabled.store(true);
+  }
+  return enabled();
+}
+
+void dash::util::TraceStore::off()
+{
+  _trace_enabled.store(false);
 }
 
 void dash::util::TraceStore::clear()
 {
-  _traces.clear();
+  auto & reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for (auto & buffer : reg.buffers) {
+    buffer->clear();
+  }
 }
 
 void dash::util::TraceStore::clear(const std::string & context)
 {
-  _traces[context].clear();
+  auto context_id = state_id(context);
+  auto & reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for (auto & buffer : reg.buffers) {
+    buffer->erase_context(context_id);
+  }
 }
 
 void dash::util::TraceStore::add_context(const std::string & context)
 {
-  if (_traces.count(context) == 0) {
-    _traces[context] = trace_events_t();
+  state_id(context);
+}
+
+dash::util::TraceStore::state_id_t
+dash::util::TraceStore::intern(const state_t & state)
+{
+  auto & reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  auto it = reg.ids.find(state);
+  if (it != reg.ids.end()) {
+    return it->second;
+  }
+  if (reg.names.size() > std::numeric_limits<state_id_t>::max()) {
+    DASH_THROW(
+      dash::exception::RuntimeError,
+      "TraceStore::intern: number of trace states exceeds " <<
+      std::numeric_limits<state_id_t>::max());
+  }
+  auto id = static_cast<state_id_t>(reg.names.size());
+  reg.names.push_back(state);
+  reg.ids.emplace(state, id);
+  return id;
+}
+
+dash::util::TraceStore::state_t
+dash::util::TraceStore::state_name(state_id_t id)
+{
+  auto & reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  DASH_ASSERT_LT(id, reg.names.size(), "invalid trace state id");
+  return reg.names[id];
+}
+
+dash::util::TraceStore::event_buffer *
+dash::util::TraceStore::add_thread_buffer()
+{
+  auto & reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  start_clock(reg);
+  auto capacity = _buffer_capacity > 0
+                  ? _buffer_capacity
+                  : (1 << 20) / sizeof(trace_event_t);
+  reg.buffers.emplace_back(
+    new event_buffer(capacity, static_cast<int>(reg.buffers.size())));
+  return reg.buffers.back().get();
+}
+
+double dash::util::TraceStore::ticks_per_usec()
+{
+  auto & reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  start_clock(reg);
+  // Calibrate counter frequency against the clock over at least 1ms:
+  auto clock_now   = clock_timer_t::Now();
+  auto counter_now = timer_t::Now();
+  auto usecs       = clock_timer_t::FromInterval(reg.clock_start, clock_now);
+  if (usecs < 1000.0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(
+      1000 - static_cast<int>(usecs)));
+    clock_now   = clock_timer_t::Now();
+    counter_now = timer_t::Now();
+    usecs       = clock_timer_t::FromInterval(reg.clock_start, clock_now);
+  }
+  auto ticks = static_cast<double>(counter_now - reg.counter_start);
+  if (usecs <= 0.0 || ticks <= 0.0) {
+    return 1.0;
   }
+  return ticks / usecs;
 }
 
-dash::util::TraceStore::trace_events_t &
+dash::util::TraceStore::trace_events_t
 dash::util::TraceStore::context_trace(const std::string & context)
 {
-  return _traces[context];
+  trace_events_t spans;
+  auto   context_id = state_id(context);
+  double ticks_us   = ticks_per_usec();
+  auto & reg        = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  auto   ts_start   = reg.counter_start;
+  for (auto & buffer : reg.buffers) {
+    for_each_timespan(*buffer,
+      [&](const trace_event_t & enter, const trace_event_t & exit) {
+        if (enter.context != context_id) {
+          return;
+        }
+        state_timespan_t span;
+        span.start = static_cast<double>(enter.ts - ts_start) / ticks_us;
+        span.end   = static_cast<double>(exit.ts  - ts_start) / ticks_us;
+        span.state = reg.names[enter.state];
+        spans.push_back(span);
+      });
+  }
+  std::sort(spans.begin(), spans.end(),
+            [](const state_timespan_t & a, const state_timespan_t & b) {
+              return a.start < b.start;
+            });
+  return spans;
 }
 
 void dash::util::TraceStore::write(std::ostream & out, bool printHeader)
@@ -64,11 +324,28 @@ void dash::util::TraceStore::write(std::ostream & out, bool printHeader)
     return;
   }
 
+  std::vector<std::string> contexts;
+  {
+    auto & reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    std::vector<bool> used(reg.names.size(), false);
+    for (auto & buffer : reg.buffers) {
+      for (std::size_t e = 0; e < buffer->size(); ++e) {
+        used[(*buffer)[e].context] = true;
+      }
+    }
+    for (std::size_t id = 0; id < used.size(); ++id) {
+      if (used[id]) {
+        contexts.push_back(reg.names[id]);
+      }
+    }
+  }
+  std::sort(contexts.begin(), contexts.end());
+
   std::ostringstream os;
   auto unit   = dash::Team::GlobalUnitID();
-  for (auto context_traces : _traces) {
-    std::string      context = context_traces.first;
-    trace_events_t & events  = context_traces.second;
+  for (auto context : contexts) {
+    trace_events_t events = context_trace(context);
 
     // Master prints CSV headers:
     if (printHeader && unit == 0) {
@@ -126,3 +403,135 @@ void dash::util::TraceStore::write(
   write(out);
   out.close();
 }
+
+void dash::util::TraceStore::write_chrome_json(std::ostream & out)
+{
+  auto & team   = dash::Team::All();
+  auto   unit   = team.myid();
+  auto   nunits = team.size();
+
+  // Align timestamps of units at the barrier:
+  double ticks_us = ticks_per_usec();
+  team.barrier();
+  auto   ts_sync  = timer_t::Now();
+
+  // Earliest event of the unit relative to the barrier:
+  double min_ts = std::numeric_limits<double>::max();
+  {
+    auto & reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto & buffer : reg.buffers) {
+      if (buffer->size() > 0) {
+        auto ts = (*buffer)[0].ts;
+        min_ts  = std::min(min_ts,
+                           -static_cast<double>(ts_sync - ts) / ticks_us);
+      }
+    }
+  }
+  double ts_offset;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&min_ts, &ts_offset, 1, DART_TYPE_DOUBLE, DART_OP_MIN,
+                   team.dart_id()),
+    DART_OK);
+  if (ts_offset == std::numeric_limits<double>::max()) {
+    ts_offset = 0;
+  }
+
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(3);
+  {
+    auto & reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    // Events are preceded by a separator, the metadata event naming the
+    // unit's process is the first event of every unit:
+    os << ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << unit
+       << ",\"args\":{\"name\":\"unit " << unit << "\"}}";
+    for (auto & buffer : reg.buffers) {
+      auto tid = buffer->thread_index();
+      // Enter and exit events are written as complete events:
+      for_each_timespan(*buffer,
+        [&](const trace_event_t & enter, const trace_event_t & exit) {
+          double ts  = -static_cast<double>(ts_sync - enter.ts) / ticks_us
+                       - ts_offset;
+          double dur = static_cast<double>(exit.ts - enter.ts) / ticks_us;
+          os << ",\n{\"name\":\""  << json_escape(reg.names[enter.state])
+             << "\",\"cat\":\"" << json_escape(reg.names[enter.context])
+             << "\",\"ph\":\"X\",\"ts\":" << ts
+             << ",\"dur\":" << dur
+             << ",\"pid\":" << unit
+             << ",\"tid\":" << tid
+             << "}";
+        });
+      if (buffer->dropped() > 0) {
+        os << ",\n{\"name\":\"dropped_events\",\"ph\":\"C\",\"ts\":0"
+           << ",\"pid\":" << unit
+           << ",\"tid\":" << tid
+           << ",\"args\":{\"count\":" << buffer->dropped() << "}}";
+      }
+    }
+  }
+  std::string events = os.str();
+
+  // Unit 0 receives trace events of all units:
+  uint64_t nbytes = events.size();
+  std::vector<uint64_t> unit_nbytes(unit == 0 ? nunits : 0);
+  DASH_ASSERT_RETURNS(
+    dart_gather(&nbytes, unit_nbytes.data(), 1, DART_TYPE_ULONGLONG,
+                dart_team_unit_t { 0 }, team.dart_id()),
+    DART_OK);
+  if (unit != 0) {
+    if (nbytes > 0) {
+      DASH_ASSERT_RETURNS(
+        dart_send(events.data(), nbytes, DART_TYPE_BYTE, trace_msg_tag,
+                  team.global_id(dash::team_unit_t { 0 })),
+        DART_OK);
+    }
+    return;
+  }
+
+  // Skip separator of the first event:
+  out << "{\"traceEvents\":[";
+  out << events.substr(1);
+  std::vector<char> unit_events;
+  for (std::size_t u = 1; u < nunits; ++u) {
+    if (unit_nbytes[u] == 0) {
+      continue;
+    }
+    unit_events.resize(unit_nbytes[u]);
+    DASH_ASSERT_RETURNS(
+      dart_recv(unit_events.data(), unit_nbytes[u], DART_TYPE_BYTE,
+                trace_msg_tag,
+                team.global_id(dash::team_unit_t {
+                  static_cast<dart_unit_t>(u) })),
+      DART_OK);
+    out.write(unit_events.data(), unit_events.size());
+  }
+  out << "\n],\"displayTimeUnit\":\"ns\"}" << std::endl;
+}
+
+void dash::util::TraceStore::write_chrome_json(
+  const std::string & filename,
+  const std::string & path)
+{
+  std::string trace_log_dir;
+  if (dash::util::Config::is_set("DASH_TRACE_LOG_PATH")) {
+    trace_log_dir = dash::util::Config::get<std::string>(
+                      "DASH_TRACE_LOG_PATH");
+    if (path.length() > 0) {
+      trace_log_dir += "/";
+    }
+  }
+  trace_log_dir += path;
+  std::string trace_file = trace_log_dir.empty()
+                           ? filename
+                           : trace_log_dir + "/" + filename;
+
+  if (dash::Team::All().myid() == 0) {
+    std::ofstream out(trace_file);
+    write_chrome_json(out);
+    out.close();
+  } else {
+    std::ostringstream out;
+    write_chrome_json(out);
+  }
+}
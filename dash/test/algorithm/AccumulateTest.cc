@@ -148,3 +148,53 @@ TEST_F(AccumulateTest, LocalStdIterator) {
 
   ASSERT_EQ_U(((dash::size()-1)*(dash::size())/2) * (1 + 2 + 3)  + 1, result);
 }
+
+TEST_F(AccumulateTest, Async) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  auto value = 2, start = 10;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+
+  dash::fill(target.begin(), target.end(), value);
+
+  dash::barrier();
+
+  auto fut_sum  = dash::accumulate_async(target.begin(),
+                                         target.end(),
+                                         start);
+  // Multiple reductions may be pending at the same time
+  auto fut_prod = dash::accumulate_async(target.begin(),
+                                         target.begin() + 8,
+                                         1,
+                                         dash::multiply<int>());
+
+  ASSERT_EQ_U(1 << 8, fut_prod.get());
+  ASSERT_EQ_U(num_elem_total * value + start, fut_sum.get());
+}
+
+TEST_F(AccumulateTest, ExecutionPolicies) {
+  // Enough local elements to be split into several chunks:
+  const size_t num_elem_local = 5003;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  auto value = 2, start = 10;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKCYCLIC(4093));
+
+  dash::fill(target.begin(), target.end(), value);
+
+  dash::barrier();
+
+  auto fut_sum = dash::accumulate_async(dash::execution::par_unseq,
+                                        target.begin(),
+                                        target.end(),
+                                        start);
+  auto result  = dash::accumulate(dash::execution::par,
+                                  target.begin() + 1,
+                                  target.end(),
+                                  start,
+                                  dash::plus<int>());
+
+  ASSERT_EQ_U((num_elem_total - 1) * value + start, result);
+  ASSERT_EQ_U(num_elem_total * value + start, fut_sum.get());
+}
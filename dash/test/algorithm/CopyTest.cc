@@ -5,8 +5,11 @@
 #include <dash/Matrix.h>
 
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/pattern/BlockPattern1D.h>
+#include <dash/pattern/ShiftTilePattern.h>
 #include <dash/pattern/ShiftTilePattern1D.h>
+#include <dash/pattern/TilePattern.h>
 #include <dash/pattern/TilePattern1D.h>
 
 #include "../TestBase.h"
@@ -892,6 +895,226 @@ TEST_F(CopyTest, AsyncGlobalToLocalTest)
   }
 }
 
+TEST_F(CopyTest, BlockingGlobalToLocalCyclic)
+{
+  const size_t num_elem_total = _dash_size * 29 + 3;
+
+  dash::Array<int> array_bc(num_elem_total, dash::BLOCKCYCLIC(3));
+  dash::Array<int> array_c(num_elem_total, dash::CYCLIC);
+  for (size_t l = 0; l < array_bc.lsize(); ++l) {
+    array_bc.local[l] = array_bc.pattern().global(l);
+  }
+  for (size_t l = 0; l < array_c.lsize(); ++l) {
+    array_c.local[l] = array_c.pattern().global(l);
+  }
+  dash::barrier();
+
+  // Subrange starting in a block of the calling unit:
+  const size_t offset = dash::myid() * 3 + 1;
+  std::vector<int> local_copy(num_elem_total - offset, -1);
+  auto copy_last = dash::copy(array_bc.begin() + offset,
+                              array_bc.end(),
+                              local_copy.data());
+  EXPECT_EQ_U(local_copy.data() + local_copy.size(), copy_last);
+  for (size_t i = 0; i < local_copy.size(); ++i) {
+    EXPECT_EQ_U(static_cast<int>(offset + i), local_copy[i]);
+  }
+
+  std::fill(local_copy.begin(), local_copy.end(), -1);
+  auto fut_last = dash::copy_async(array_c.begin() + offset,
+                                   array_c.end(),
+                                   local_copy.data());
+  EXPECT_EQ_U(local_copy.data() + local_copy.size(), fut_last.get());
+  for (size_t i = 0; i < local_copy.size(); ++i) {
+    EXPECT_EQ_U(static_cast<int>(offset + i), local_copy[i]);
+  }
+  dash::barrier();
+}
+
+TEST_F(CopyTest, BlockingLocalToGlobalCyclic)
+{
+  const size_t num_elem_per_unit = 31;
+  const size_t num_elem_total    = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(4));
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  // Every unit writes a segment of the array that is not aligned to
+  // blocks, the segment of the last unit is written asynchronously:
+  std::vector<int> local_range(num_elem_per_unit);
+  auto g_offset = dash::myid() * num_elem_per_unit;
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    local_range[l] = g_offset + l;
+  }
+  auto out_first = array.begin() + g_offset;
+  if (dash::myid() == static_cast<dash::global_unit_t>(_dash_size - 1)) {
+    auto fut_out_last = dash::copy_async(local_range.data(),
+                                         local_range.data()
+                                           + num_elem_per_unit,
+                                         out_first);
+    EXPECT_EQ_U(array.end(), fut_out_last.get());
+  } else {
+    auto out_last = dash::copy(local_range.data(),
+                               local_range.data() + num_elem_per_unit,
+                               out_first);
+    EXPECT_EQ_U(out_first + num_elem_per_unit, out_last);
+  }
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(array.pattern().global(l), array.local[l]);
+  }
+}
+
+template <class PatternT>
+void copy_test_tiled_matrix(const PatternT & pattern)
+{
+  typedef dash::Matrix<
+            int, 2, typename PatternT::index_type, PatternT> matrix_t;
+
+  matrix_t matrix(pattern);
+  dash::fill(matrix.begin(), matrix.end(), -1);
+  matrix.barrier();
+
+  // Unit 0 scatters the matrix elements in global order:
+  auto num_elem_total = pattern.size();
+  if (dash::myid() == 0) {
+    std::vector<int> values(num_elem_total);
+    for (size_t i = 0; i < num_elem_total; ++i) {
+      values[i] = i;
+    }
+    dash::copy(values.data(), values.data() + num_elem_total,
+               matrix.begin());
+  }
+  matrix.barrier();
+
+  for (size_t l = 0; l < matrix.local_size(); ++l) {
+    EXPECT_EQ_U(pattern.global(l), matrix.lbegin()[l]);
+  }
+
+  // All units gather the matrix in global order:
+  std::vector<int> gathered(num_elem_total, -1);
+  dash::copy(matrix.begin(), matrix.end(), gathered.data());
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    EXPECT_EQ_U(static_cast<int>(i), gathered[i]);
+  }
+  matrix.barrier();
+}
+
+TEST_F(CopyTest, LocalToGlobalToLocalTiles)
+{
+  const size_t tile_rows = 3;
+  const size_t tile_cols = 2;
+
+  dash::SizeSpec<2> sizespec(_dash_size * tile_rows * 3,
+                             _dash_size * tile_cols * 2);
+  dash::DistributionSpec<2> distspec(dash::TILE(tile_rows),
+                                     dash::TILE(tile_cols));
+  dash::TeamSpec<2> teamspec(_dash_size, 1);
+  teamspec.balance_extents();
+
+  copy_test_tiled_matrix(
+    dash::TilePattern<2>(sizespec, distspec, teamspec));
+  copy_test_tiled_matrix(
+    dash::ShiftTilePattern<2>(sizespec, distspec, teamspec));
+  copy_test_tiled_matrix(
+    dash::Pattern<2>(sizespec,
+                     dash::DistributionSpec<2>(
+                       dash::BLOCKCYCLIC(tile_rows),
+                       dash::BLOCKCYCLIC(tile_cols)),
+                     teamspec));
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalRepartition)
+{
+  const size_t num_elem_total = _dash_size * 103 + 5;
+
+  dash::Array<int> src_blocked(num_elem_total, dash::BLOCKED);
+  dash::Array<int> src_cyclic(num_elem_total, dash::CYCLIC);
+  for (size_t l = 0; l < src_blocked.lsize(); ++l) {
+    src_blocked.local[l] = src_blocked.pattern().global(l);
+  }
+  for (size_t l = 0; l < src_cyclic.lsize(); ++l) {
+    src_cyclic.local[l] = src_cyclic.pattern().global(l);
+  }
+  dash::barrier();
+
+  // BLOCKED to TILE:
+  dash::Array<int> dst_tiled(num_elem_total, dash::BLOCKCYCLIC(7));
+  auto dst_last = dash::copy(src_blocked.begin(), src_blocked.end(),
+                             dst_tiled.begin());
+  EXPECT_EQ_U(dst_tiled.end(), dst_last);
+  for (size_t l = 0; l < dst_tiled.lsize(); ++l) {
+    EXPECT_EQ_U(dst_tiled.pattern().global(l), dst_tiled.local[l]);
+  }
+
+  // CYCLIC to BLOCKED:
+  dash::Array<int> dst_blocked(num_elem_total, dash::BLOCKED);
+  dash::copy(src_cyclic.begin(), src_cyclic.end(), dst_blocked.begin());
+  for (size_t l = 0; l < dst_blocked.lsize(); ++l) {
+    EXPECT_EQ_U(dst_blocked.pattern().global(l), dst_blocked.local[l]);
+  }
+
+  // Shifted subranges:
+  const int offset = 3;
+  dash::fill(dst_blocked.begin(), dst_blocked.end(), -1);
+  dash::copy(src_cyclic.begin() + offset, src_cyclic.end(),
+             dst_blocked.begin());
+  for (size_t l = 0; l < dst_blocked.lsize(); ++l) {
+    auto g_idx    = dst_blocked.pattern().global(l);
+    int  expected = (g_idx + offset < num_elem_total)
+                    ? g_idx + offset
+                    : -1;
+    EXPECT_EQ_U(expected, dst_blocked.local[l]);
+  }
+}
+
+TEST_F(CopyTest, AsyncGlobalToGlobal)
+{
+  const size_t num_elem_total = _dash_size * 64;
+
+  dash::Array<double> src(num_elem_total, dash::BLOCKCYCLIC(5));
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = src.pattern().global(l) * 0.5;
+  }
+  dash::barrier();
+
+  dash::Array<double> dst(num_elem_total, dash::CYCLIC);
+  auto fut_dst_last = dash::copy_async(src.begin(), src.end(), dst.begin());
+  EXPECT_EQ_U(dst.end(), fut_dst_last.get());
+  for (size_t l = 0; l < dst.lsize(); ++l) {
+    EXPECT_EQ_U(dst.pattern().global(l) * 0.5, dst.local[l]);
+  }
+  dash::barrier();
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalMatrix)
+{
+  typedef dash::TilePattern<2> tile_pattern_t;
+
+  const size_t rows = _dash_size * 4;
+  const size_t cols = _dash_size * 6;
+
+  dash::Matrix<int, 2> src(dash::SizeSpec<2>(rows, cols));
+  for (size_t l = 0; l < src.local_size(); ++l) {
+    src.lbegin()[l] = src.pattern().global(l);
+  }
+  dash::barrier();
+
+  dash::TeamSpec<2> teamspec(_dash_size, 1);
+  teamspec.balance_extents();
+  tile_pattern_t pattern(dash::SizeSpec<2>(rows, cols),
+                         dash::DistributionSpec<2>(
+                           dash::TILE(2), dash::TILE(3)),
+                         teamspec);
+  dash::Matrix<int, 2, dash::default_index_t, tile_pattern_t> dst(pattern);
+  dash::copy(src.begin(), src.end(), dst.begin());
+  for (size_t l = 0; l < dst.local_size(); ++l) {
+    EXPECT_EQ_U(pattern.global(l), dst.lbegin()[l]);
+  }
+}
+
 #if 0
 // TODO
 TEST_F(CopyTest, AsyncAllToLocalVector)
@@ -22,6 +22,10 @@ TEST_F(EqualTest, EqualDistribution){
   auto beg_b = B.begin() + 10;
   auto end_b = B.begin() + 501;
 
+  // Elements outside of the compared ranges must differ:
+  dash::fill(A.begin(), A.end(), 0);
+  dash::fill(B.begin(), B.end(), 0);
+  dash::barrier();
   dash::fill(beg_a, end_a, 1);
   dash::fill(beg_b, end_b, 1);
   A.flush();
@@ -38,6 +42,38 @@ TEST_F(EqualTest, EqualDistribution){
 }
 
 
+TEST_F(EqualTest, Async){
+  using value_type = int;
+  using array_type = dash::Array<value_type>;
+
+  size_t num_local_elem = 513;
+
+  array_type A(num_local_elem, dash::BLOCKED);
+  array_type B(num_local_elem, dash::BLOCKED);
+
+  auto beg_a = A.begin() + 10;
+  auto end_a = A.begin() + 501;
+  auto beg_b = B.begin() + 10;
+
+  // Elements outside of the compared ranges must differ:
+  dash::fill(A.begin(), A.end(), 0);
+  dash::fill(B.begin(), B.end(), 0);
+  dash::barrier();
+  dash::fill(beg_a, end_a, 1);
+  dash::fill(beg_b, beg_b + (end_a - beg_a), 1);
+  A.flush();
+  B.flush();
+  dash::barrier();
+
+  auto fut_ab1 = dash::equal_async(beg_a, end_a, beg_b);
+  auto fut_ab2 = dash::equal_async(beg_a, end_a, beg_b-1);
+
+  // matching
+  EXPECT_EQ_U(fut_ab1.get(), true);
+  // mismatch
+  EXPECT_EQ_U(fut_ab2.get(), false);
+}
+
 // TODO: This is currently not supported.
 // Re-enable testcase when implementation is ready
 #if 0
@@ -42,3 +42,53 @@ TEST_F(FillTest, TestAllItemsFilled)
     EXPECT_EQ_U(17, static_cast<value_t>(*lbegin));
   }
 }
+
+TEST_F(FillTest, BlockCyclicSubrange)
+{
+  typedef int                                         Element_t;
+  typedef dash::Array<Element_t>                        Array_t;
+
+  size_t num_local_elem = 67;
+  size_t num_elem       = num_local_elem * dash::size();
+  size_t sub_begin      = 5;
+  size_t sub_end        = num_elem - 3;
+
+  Array_t array(num_elem, dash::BLOCKCYCLIC(7));
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  dash::fill(array.begin() + sub_begin, array.begin() + sub_end, 17);
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    size_t g = array.pattern().global(l);
+    Element_t expected = (g >= sub_begin && g < sub_end) ? 17 : 0;
+    EXPECT_EQ_U(expected, array.local[l]);
+  }
+}
+
+TEST_F(FillTest, ExecutionPolicies)
+{
+  typedef int                                         Element_t;
+  typedef dash::Array<Element_t>                        Array_t;
+
+  // Enough local elements to be split into several chunks:
+  size_t num_elem = 5003 * dash::size();
+  Array_t array(num_elem, dash::BLOCKCYCLIC(4099));
+
+  dash::fill(dash::execution::seq, array.begin(), array.end(), 1);
+  array.barrier();
+  dash::fill(dash::execution::par, array.begin() + 3, array.end(), 2);
+  array.barrier();
+  dash::fill(dash::execution::par_unseq,
+             array.begin() + 5, array.end() - 7, 3);
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    size_t g = array.pattern().global(l);
+    Element_t expected = (g < 3) ? 1
+                       : (g < 5 || g >= num_elem - 7) ? 2
+                       : 3;
+    EXPECT_EQ_U(expected, array.local[l]);
+  }
+}
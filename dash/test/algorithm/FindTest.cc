@@ -3,6 +3,7 @@
 
 #include <dash/Array.h>
 #include <dash/Team.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Find.h>
 
 #include <limits>
@@ -320,3 +321,83 @@ TEST_F(FindTest, LessElementsThanUnits)
   array.barrier();
 }
 
+
+TEST_F(FindTest, Async)
+{
+  _num_elem           = dash::Team::All().size() * 3;
+  Element_t init_fill = 0;
+  Element_t find_me   = 24;
+  index_t   find_pos  = _num_elem - 2;
+
+  Array_t array(_num_elem);
+  dash::fill(array.begin(), array.end(), init_fill);
+  array.barrier();
+  if (dash::myid() == 0) {
+    array[find_pos] = find_me;
+  }
+  array.barrier();
+
+  auto fut_found     = dash::find_async(array.begin(), array.end(), find_me);
+  auto fut_not_found = dash::find_async(array.begin(), array.end(), 1);
+
+  EXPECT_EQ_U(array.begin() + find_pos, fut_found.get());
+  EXPECT_EQ_U(array.end(), fut_not_found.get());
+
+  array.barrier();
+}
+
+TEST_F(FindTest, CyclicSubrange)
+{
+  _num_elem           = dash::Team::All().size() * 11;
+  Element_t init_fill = 0;
+  Element_t find_me   = 24;
+  index_t   sub_begin = 3;
+  index_t   find_pos  = _num_elem - 4;
+
+  Array_t array(_num_elem, dash::CYCLIC);
+  dash::fill(array.begin(), array.end(), init_fill);
+  array.barrier();
+  if (dash::myid() == 0) {
+    // Matches before the range and after the expected position:
+    array[sub_begin - 1] = find_me;
+    array[find_pos]      = find_me;
+    array[find_pos + 2]  = find_me;
+  }
+  array.barrier();
+
+  auto found = dash::find(array.begin() + sub_begin, array.end(), find_me);
+  EXPECT_EQ_U(array.begin() + find_pos, found);
+
+  array.barrier();
+}
+
+TEST_F(FindTest, ExecutionPolicies)
+{
+  // Enough local elements to be split into several chunks:
+  _num_elem           = dash::Team::All().size() * 5003;
+  Element_t init_fill = 0;
+  Element_t find_me   = 24;
+  index_t   find_pos  = _num_elem - 1500;
+
+  Array_t array(_num_elem, dash::BLOCKCYCLIC(3001));
+  dash::fill(array.begin(), array.end(), init_fill);
+  array.barrier();
+  if (dash::myid() == 0) {
+    array[find_pos]        = find_me;
+    array[find_pos + 1000] = find_me;
+  }
+  array.barrier();
+
+  EXPECT_EQ_U(array.begin() + find_pos,
+              dash::find(dash::execution::par,
+                         array.begin(), array.end(), find_me));
+  auto found_if = dash::find_if(dash::execution::par_unseq,
+                                array.begin(), array.end(),
+                                [](Element_t e) { return e > 0; });
+  EXPECT_EQ_U(array.begin() + find_pos, found_if);
+  EXPECT_EQ_U(array.end(),
+              dash::find_async(dash::execution::par,
+                               array.begin(), array.end(), 1).get());
+
+  array.barrier();
+}
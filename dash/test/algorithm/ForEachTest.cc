@@ -166,3 +166,83 @@ TEST_F(ForEachTest, Lambdas)
                  });
 }
 
+
+TEST_F(ForEachTest, ExecutionPolicies)
+{
+  // Enough local elements to be split into several chunks:
+  dash::Array<int> array(5003 * dash::size(), dash::BLOCKCYCLIC(2053));
+  dash::fill(array.begin(), array.end(), dash::myid());
+
+  dash::for_each(dash::execution::par, array.begin(), array.end(),
+                 [](int & el) {
+                   el += 100;
+                 });
+  dash::for_each_with_index(dash::execution::par_unseq,
+                 array.begin(), array.end(),
+                 [](int & el, index_t gindex) {
+                   el += gindex;
+                 });
+  dash::for_each_with_index(dash::execution::seq,
+                 array.begin(), array.end(),
+                 [](int & el, index_t gindex) {
+                   EXPECT_EQ_U(100 + dash::myid() + gindex, el);
+                 });
+}
+
+TEST_F(ForEachTest, SegmentsOfView)
+{
+  const size_t nrows = 3 * dash::size();
+  const size_t ncols = 8;
+  dash::Matrix<int, 2> matrix(
+                         dash::SizeSpec<2>(nrows, ncols),
+                         dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE),
+                         dash::Team::All(),
+                         dash::TeamSpec<2>(dash::size(), 1));
+  // Rows of the view are shorter than the rows of the matrix' blocks:
+  auto view = matrix.cols(0, ncols - 1);
+
+  size_t num_segments = 0;
+  dash::internal::for_each_segment(view.begin(), view.end(),
+    [&](const dash::internal::glob_segment<decltype(view.begin())> & seg) {
+      EXPECT_EQ_U(ncols - 1, seg.size);
+      ++num_segments;
+    });
+  EXPECT_EQ_U(nrows, num_segments);
+}
+
+TEST_F(ForEachTest, LocalRunsOfCyclicRange)
+{
+  dash::Array<int> array(100 * dash::size(), dash::CYCLIC);
+  typedef dash::Array<int>::iterator::local_pointer local_pointer;
+
+  // Local elements of a cyclic range are visited in a single run:
+  size_t num_runs  = 0;
+  size_t num_local = 0;
+  dash::internal::for_each_local_run(array.begin(), array.end(),
+    [&](local_pointer lbegin, local_pointer lend) {
+      EXPECT_EQ_U(array.lbegin(), lbegin);
+      num_local += lend - lbegin;
+      ++num_runs;
+    });
+  EXPECT_EQ_U(1, num_runs);
+  EXPECT_EQ_U(array.lsize(), num_local);
+
+  // Also in a range containing a part of the local elements:
+  auto first = array.begin() + 3;
+  auto last  = array.end() - 5;
+  num_runs   = 0;
+  num_local  = 0;
+  dash::internal::for_each_local_run(first, last,
+    [&](local_pointer lbegin, local_pointer lend) {
+      num_local += lend - lbegin;
+      ++num_runs;
+    });
+  size_t num_local_exp = 0;
+  for (auto it = first; it != last; ++it) {
+    if (it.is_local()) {
+      ++num_local_exp;
+    }
+  }
+  EXPECT_EQ_U(num_local_exp > 0 ? 1 : 0, num_runs);
+  EXPECT_EQ_U(num_local_exp, num_local);
+}
@@ -55,3 +55,22 @@ TEST_F(GenerateTest, TestGenerateWithIndex)
     }
   }
 }
+
+TEST_F(GenerateTest, ExecutionPolicies)
+{
+  // Enough local elements to be split into several chunks:
+  Array_t array(4999 * dash::size(), dash::BLOCKCYCLIC(1021));
+
+  dash::generate(dash::execution::par, array.begin(), array.end(),
+                 []() { return 17L; });
+  array.barrier();
+  dash::generate_with_index(dash::execution::par_unseq,
+                            array.begin() + 1, array.end(),
+                            [](Array_t::index_type idx) { return 2 * idx; });
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    auto g = array.pattern().global(l);
+    EXPECT_EQ_U(g == 0 ? 17 : 2 * g, array.local[l]);
+  }
+}
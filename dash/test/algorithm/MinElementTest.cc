@@ -271,3 +271,92 @@ TEST_F(MinElementTest, TestFindMatrixDefault)
   EXPECT_EQ(min_value, found_min);
 }
 
+
+TEST_F(MinElementTest, TestFindArrayAsync)
+{
+  int num_elem        = dash::Team::All().size() * 5;
+  Element_t min_value = 11;
+  // Initialize global array:
+  Array_t array(num_elem);
+  if (dash::myid() == 0) {
+    for (auto i = 0; i < array.size(); ++i) {
+      Element_t value = (i + 1) * 41;
+      array[i] = value;
+    }
+    // Set minimum element in the last position:
+    array[array.size() - 1] = min_value;
+  }
+  array.barrier();
+
+  auto fut_min = dash::min_element_async(array.begin(), array.end());
+  // Test until the result is available:
+  while (!fut_min.test()) { }
+  auto found_gptr = fut_min.get();
+
+  EXPECT_EQ_U(array.begin() + (num_elem - 1), found_gptr);
+  EXPECT_EQ_U(min_value, static_cast<Element_t>(*found_gptr));
+
+  // Destroying an incomplete future waits for the operation
+  {
+    auto fut_discard = dash::min_element_async(array.begin(), array.end());
+  }
+  array.barrier();
+}
+
+TEST_F(MinElementTest, TestFirstOfEqualMinimaBlockcyclic)
+{
+  Element_t min_value = 3;
+  index_t   sub_begin = 2;
+  index_t   min_pos   = _num_elem / 4;
+
+  Array_t array(_num_elem, dash::BLOCKCYCLIC(5));
+  if (dash::myid() == 0) {
+    for (auto i = 0; i < array.size(); ++i) {
+      array[i] = 100 + i;
+    }
+    // Smaller value before the range, equal minima after the first one:
+    array[sub_begin - 1] = min_value - 1;
+    array[min_pos]       = min_value;
+    array[min_pos + 7]   = min_value;
+    array[_num_elem - 1] = min_value;
+  }
+  array.barrier();
+
+  auto found = dash::min_element(array.begin() + sub_begin, array.end());
+  EXPECT_EQ_U(array.begin() + min_pos, found);
+  EXPECT_EQ_U(min_value, static_cast<Element_t>(*found));
+
+  array.barrier();
+}
+
+TEST_F(MinElementTest, ExecutionPolicies)
+{
+  // Enough local elements to be split into several chunks:
+  size_t    num_elem  = dash::size() * 5003;
+  Element_t min_value = 3;
+  index_t   min_pos   = num_elem / 2 + 1;
+
+  Array_t array(num_elem, dash::BLOCKCYCLIC(4001));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = 100 + (array.pattern().global(l) % 1000);
+  }
+  array.barrier();
+  if (dash::myid() == 0) {
+    array[min_pos]        = min_value;
+    array[min_pos + 2000] = min_value;
+    array[num_elem - 1]   = 10000;
+  }
+  array.barrier();
+
+  auto found_min = dash::min_element(dash::execution::par,
+                                     array.begin(), array.end());
+  EXPECT_EQ_U(array.begin() + min_pos, found_min);
+  auto found_max = dash::max_element(dash::execution::par_unseq,
+                                     array.begin(), array.end());
+  EXPECT_EQ_U(array.end() - 1, found_max);
+  auto fut_min   = dash::min_element_async(dash::execution::seq,
+                                           array.begin(), array.end());
+  EXPECT_EQ_U(array.begin() + min_pos, fut_min.get());
+
+  array.barrier();
+}
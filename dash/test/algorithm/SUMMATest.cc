@@ -3,10 +3,13 @@
 
 #include <dash/Matrix.h>
 #include <dash/Meta.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/algorithm/SUMMA.h>
 
+#include <array>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 #define SKIP_TEST_IF_NO_SUMMA()           \
   auto conf = dash::util::DashConfig;     \
@@ -118,6 +121,9 @@ TEST_F(SUMMATest, Deduction)
   dash::Matrix<value_t, 2, index_t, decltype(pattern)> matrix_c(pattern);
 
   LOG_MESSAGE("Starting initialization of matrix values");
+  // Matrix memory is not initialized:
+  dash::fill(matrix_b.begin(), matrix_b.end(), 0);
+  dash::fill(matrix_c.begin(), matrix_c.end(), 0);
   dash::barrier();
 
   // Initialize operands:
@@ -160,7 +166,7 @@ TEST_F(SUMMATest, Deduction)
   dash::barrier();
 
   // Verify multiplication result (A x id = A):
-  if (false) {
+  if (true) {
     // Multiplication of matrix A with identity matrix B should be identical
     // to matrix A:
     for (index_t row = 0; row < static_cast<index_t>(extent_rows); ++row) {
@@ -209,6 +215,9 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
   dash::Matrix<value_t, 2, index_t, pattern_t> matrix_c(pattern);
 
   LOG_MESSAGE("Starting initialization of matrix values");
+  // Matrix memory is not initialized:
+  dash::fill(matrix_b.begin(), matrix_b.end(), 0);
+  dash::fill(matrix_c.begin(), matrix_c.end(), 0);
   dash::barrier();
 
   // Initialize operands:
@@ -259,7 +268,7 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
   dash::barrier();
 
   // Verify multiplication result (A x id = A):
-  if (false) {
+  if (true) {
     // Multiplication of matrix A with identity matrix B should be identical
     // to matrix A:
     for (index_t row = 0; row < static_cast<index_t>(extent_rows); ++row) {
@@ -275,3 +284,90 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
 
   dash::barrier();
 }
+
+namespace {
+
+template <typename ValueT>
+void verify_local_gemm(
+  long long        m,
+  long long        n,
+  long long        k,
+  dash::MemArrange storage)
+{
+  // Linear offsets of matrix elements in given storage order:
+  auto a_at = [=](long long i, long long p) {
+                return (storage == dash::ROW_MAJOR) ? i * k + p : p * m + i;
+              };
+  auto b_at = [=](long long p, long long j) {
+                return (storage == dash::ROW_MAJOR) ? p * n + j : j * k + p;
+              };
+  auto c_at = [=](long long i, long long j) {
+                return (storage == dash::ROW_MAJOR) ? i * n + j : j * m + i;
+              };
+
+  std::vector<ValueT> a(m * k);
+  std::vector<ValueT> b(k * n);
+  std::vector<ValueT> c(m * n);
+  std::vector<ValueT> expected(m * n);
+  for (long long i = 0; i < m; ++i) {
+    for (long long p = 0; p < k; ++p) {
+      a[a_at(i, p)] = static_cast<ValueT>((i * 7 + p * 3) % 11) - 5;
+    }
+  }
+  for (long long p = 0; p < k; ++p) {
+    for (long long j = 0; j < n; ++j) {
+      b[b_at(p, j)] = static_cast<ValueT>((p * 5 + j) % 13) - 6;
+    }
+  }
+  for (long long i = 0; i < m; ++i) {
+    for (long long j = 0; j < n; ++j) {
+      // Multiplication result is added to existing values in C:
+      c[c_at(i, j)]    = static_cast<ValueT>(i - j);
+      ValueT sum       = static_cast<ValueT>(i - j);
+      for (long long p = 0; p < k; ++p) {
+        sum += a[a_at(i, p)] * b[b_at(p, j)];
+      }
+      expected[c_at(i, j)] = sum;
+    }
+  }
+
+  // Built-in kernel, also used by mmult_local if MKL and BLAS are not
+  // available:
+  std::vector<ValueT> c_builtin(c);
+  dash::internal::gemm<ValueT>(
+    a.data(), b.data(), c_builtin.data(), m, n, k, storage);
+  dash::internal::mmult_local<ValueT>(
+    a.data(), b.data(), c.data(), m, n, k, storage);
+
+  for (long long i = 0; i < m; ++i) {
+    for (long long j = 0; j < n; ++j) {
+      ASSERT_EQ_U(expected[c_at(i, j)], c_builtin[c_at(i, j)]);
+      ASSERT_EQ_U(expected[c_at(i, j)], c[c_at(i, j)]);
+    }
+  }
+}
+
+} // namespace
+
+TEST_F(SUMMATest, LocalGemm)
+{
+  // Extents are no multiples of the micro-kernel tile and exceed the
+  // cache blocking of the built-in kernel, values are small integers so
+  // results are exact:
+  std::vector<std::array<long long, 3>> extents {{
+    {{   1,   1,   1 }},
+    {{   7,   5,   3 }},
+    {{  64,  64,  64 }},
+    {{ 101,  37, 300 }},
+    {{  13, 129,  17 }},
+    {{ 200, 150,  90 }}
+  }};
+  for (auto storage : { dash::ROW_MAJOR, dash::COL_MAJOR }) {
+    for (auto ext : extents) {
+      LOG_MESSAGE("m:%lld n:%lld k:%lld", ext[0], ext[1], ext[2]);
+      verify_local_gemm<double>(ext[0], ext[1], ext[2], storage);
+      verify_local_gemm<float>(ext[0], ext[1], ext[2], storage);
+      verify_local_gemm<long>(ext[0], ext[1], ext[2], storage);
+    }
+  }
+}
@@ -0,0 +1,217 @@
+
+#include <gtest/gtest.h>
+
+#include "../TestBase.h"
+#include "ScanTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Scan.h>
+
+#include <numeric>
+#include <vector>
+
+
+namespace {
+
+/**
+ * Affine function x -> m * x + c, composition of affine functions is
+ * associative but not commutative.
+ */
+struct affine_t {
+  long m;
+  long c;
+};
+
+struct affine_compose {
+  affine_t operator()(const affine_t & f, const affine_t & g) const {
+    // g(f(x)):
+    return affine_t { f.m * g.m, f.c * g.m + g.c };
+  }
+};
+
+template <class ArrayT, class Generator>
+void init_array(ArrayT & array, Generator gen)
+{
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = gen(array.pattern().global(l));
+  }
+  array.barrier();
+}
+
+} // namespace
+
+
+TEST_F(ScanTest, InclusiveBlocked) {
+  const size_t num_elem_local = 1000;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<long> in(num_elem_total, dash::BLOCKED);
+  dash::Array<long> out(num_elem_total, dash::BLOCKED);
+  init_array(in, [](size_t g) { return static_cast<long>(g + 1); });
+
+  auto out_last = dash::inclusive_scan(in.begin(), in.end(), out.begin());
+  out.barrier();
+
+  ASSERT_EQ_U(out.end(), out_last);
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    long g = out.pattern().global(l);
+    EXPECT_EQ_U((g + 1) * (g + 2) / 2, static_cast<long>(out.local[l]));
+  }
+}
+
+TEST_F(ScanTest, InclusiveInit) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  long   init                 = 42;
+
+  dash::Array<long> array(num_elem_total, dash::BLOCKED);
+  init_array(array, [](size_t) { return 1L; });
+
+  dash::inclusive_scan(array.begin(), array.end(), array.begin(),
+                       dash::plus<long>(), init);
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    long g = array.pattern().global(l);
+    EXPECT_EQ_U(init + g + 1, static_cast<long>(array.local[l]));
+  }
+}
+
+TEST_F(ScanTest, ExclusiveInPlace) {
+  const size_t num_elem_local = 1000;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  long   init                 = 10;
+
+  dash::Array<long> array(num_elem_total, dash::BLOCKED);
+  init_array(array, [](size_t g) { return static_cast<long>(g); });
+
+  dash::exclusive_scan(array.begin(), array.end(), array.begin(), init);
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    long g = array.pattern().global(l);
+    EXPECT_EQ_U(init + g * (g - 1) / 2, static_cast<long>(array.local[l]));
+  }
+}
+
+TEST_F(ScanTest, TransformScan) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int>  in(num_elem_total, dash::BLOCKED);
+  dash::Array<long> out(num_elem_total, dash::BLOCKED);
+  init_array(in, [](size_t g) { return static_cast<int>(g % 7); });
+
+  std::vector<long> squares(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    squares[g] = (g % 7) * (g % 7);
+  }
+  std::vector<long> expected_inc(num_elem_total);
+  std::partial_sum(squares.begin(), squares.end(), expected_inc.begin());
+
+  auto square = [](int x) { return static_cast<long>(x) * x; };
+
+  dash::transform_inclusive_scan(in.begin(), in.end(), out.begin(),
+                                 dash::plus<long>(), square);
+  out.barrier();
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    auto g = out.pattern().global(l);
+    EXPECT_EQ_U(expected_inc[g], static_cast<long>(out.local[l]));
+  }
+  out.barrier();
+
+  dash::transform_exclusive_scan(in.begin(), in.end(), out.begin(), 0L,
+                                 dash::plus<long>(), square);
+  out.barrier();
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    auto g = out.pattern().global(l);
+    EXPECT_EQ_U(expected_inc[g] - squares[g],
+                static_cast<long>(out.local[l]));
+  }
+}
+
+TEST_F(ScanTest, PartialRange) {
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  size_t first                = 3;
+  size_t last                 = num_elem_total - 4;
+
+  dash::Array<long> array(num_elem_total, dash::BLOCKED);
+  init_array(array, [](size_t) { return -1L; });
+
+  dash::Array<long> in(num_elem_total, dash::BLOCKED);
+  init_array(in, [](size_t) { return 1L; });
+
+  auto out_last = dash::inclusive_scan(in.begin() + first,
+                                       in.begin() + last,
+                                       array.begin() + first);
+  array.barrier();
+
+  ASSERT_EQ_U(array.begin() + last, out_last);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    size_t g = array.pattern().global(l);
+    if (g < first || g >= last) {
+      EXPECT_EQ_U(-1, static_cast<long>(array.local[l]));
+    } else {
+      EXPECT_EQ_U(g - first + 1, static_cast<long>(array.local[l]));
+    }
+  }
+}
+
+TEST_F(ScanTest, EmptyUnits) {
+  // Fewer elements than units, last unit has no local elements:
+  size_t num_elem_total = std::max<size_t>(1, _dash_size - 1);
+
+  dash::Array<long> array(num_elem_total, dash::BLOCKED);
+  init_array(array, [](size_t g) { return static_cast<long>(g + 1); });
+
+  dash::exclusive_scan(array.begin(), array.end(), array.begin(), 0L);
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    long g = array.pattern().global(l);
+    EXPECT_EQ_U(g * (g + 1) / 2, static_cast<long>(array.local[l]));
+  }
+}
+
+TEST_F(ScanTest, NonCommutative) {
+  const size_t num_elem_local = 50;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  auto gen = [](size_t g) {
+               return affine_t { (g % 3 == 0) ? -1L : 1L,
+                                 static_cast<long>(g % 5) };
+             };
+
+  dash::Array<affine_t> array(num_elem_total, dash::BLOCKED);
+  init_array(array, gen);
+
+  std::vector<affine_t> expected;
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected.push_back(gen(g));
+  }
+  std::partial_sum(expected.begin(), expected.end(), expected.begin(),
+                   affine_compose());
+
+  dash::inclusive_scan(array.begin(), array.end(), array.begin(),
+                       affine_compose());
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    auto     g     = array.pattern().global(l);
+    affine_t value = array.local[l];
+    EXPECT_EQ_U(expected[g].m, value.m);
+    EXPECT_EQ_U(expected[g].c, value.c);
+  }
+}
+
+TEST_F(ScanTest, UnsupportedDistribution) {
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  dash::Array<long> array(4 * _dash_size, dash::BLOCKCYCLIC(1));
+
+  EXPECT_THROW(
+    dash::inclusive_scan(array.begin(), array.end(), array.begin()),
+    dash::exception::NotImplemented);
+}
@@ -1,13 +1,17 @@
 
 #include "TransformTest.h"
 
+#include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
 #include <dash/algorithm/Transform.h>
 
 #include <dash/Array.h>
 #include <dash/Matrix.h>
+#include <dash/pattern/TilePattern.h>
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 
 TEST_F(TransformTest, ArrayLocalPlusLocal)
@@ -221,3 +225,178 @@ TEST_F(TransformTest, MatrixGlobalPlusGlobalBlocking)
   EXPECT_EQ_U(first_l_block_a_begin,
               first_l_block_a_offsets);
 }
+
+TEST_F(TransformTest, ArrayGlobalOpGlobalOutOfPlace)
+{
+  // Out-of-place transform with identical distribution of all ranges,
+  // does not require communication
+  const size_t num_elem_local = 100;
+  size_t num_elem_total = dash::size() * num_elem_local;
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_c(num_elem_total, dash::BLOCKED);
+
+  for (size_t l_idx = 0; l_idx < array_a.lsize(); ++l_idx) {
+    auto g_idx = array_a.pattern().global(l_idx);
+    array_a.local[l_idx] = g_idx;
+    array_b.local[l_idx] = 2 * g_idx + 1;
+    array_c.local[l_idx] = -1;
+  }
+  dash::barrier();
+
+  auto out_last =
+    dash::transform(array_a.begin(), array_a.end(), // A
+                    array_b.begin(),                // B
+                    array_c.begin(),                // C = op(A,B)
+                    [](int a, int b) { return a * b; });
+  EXPECT_EQ_U(array_c.end(), out_last);
+
+  dash::barrier();
+
+  for (size_t l_idx = 0; l_idx < array_c.lsize(); ++l_idx) {
+    int g_idx = array_c.pattern().global(l_idx);
+    EXPECT_EQ_U(g_idx * (2 * g_idx + 1), array_c.local[l_idx]);
+  }
+}
+
+TEST_F(TransformTest, ArrayGlobalOpGlobalMisaligned)
+{
+  // Out-of-place transform of ranges with different distributions and
+  // start offsets, local output ranges span several pipeline stages
+  const size_t num_elem_local = 20011;
+  const size_t offset         = 5;
+  size_t num_elem_total = dash::size() * num_elem_local;
+  dash::Array<int64_t> array_a(num_elem_total, dash::CYCLIC);
+  dash::Array<int64_t> array_b(num_elem_total, dash::BLOCKCYCLIC(7));
+  dash::Array<int64_t> array_c(num_elem_total, dash::BLOCKED);
+
+  for (size_t l_idx = 0; l_idx < array_a.lsize(); ++l_idx) {
+    array_a.local[l_idx] = array_a.pattern().global(l_idx);
+  }
+  for (size_t l_idx = 0; l_idx < array_b.lsize(); ++l_idx) {
+    array_b.local[l_idx] = 3 * array_b.pattern().global(l_idx);
+  }
+  std::fill(array_c.lbegin(), array_c.lend(), -1);
+  dash::barrier();
+
+  // C[i] = A[i + offset] - B[i]
+  dash::transform(array_a.begin() + offset, array_a.end(), // A
+                  array_b.begin(),                          // B
+                  array_c.begin(),                          // C
+                  [](int64_t a, int64_t b) { return a - b; });
+
+  dash::barrier();
+
+  for (size_t l_idx = 0; l_idx < array_c.lsize(); ++l_idx) {
+    int64_t g_idx    = array_c.pattern().global(l_idx);
+    int64_t expected = (g_idx + offset < num_elem_total)
+                       ? (g_idx + offset) - 3 * g_idx
+                       : -1;
+    EXPECT_EQ_U(expected, array_c.local[l_idx]);
+  }
+}
+
+TEST_F(TransformTest, MatrixGlobalOpGlobalTiled)
+{
+  // Out-of-place transform from blocked to tiled matrices
+  typedef dash::TilePattern<2> tile_pattern_t;
+
+  const size_t rows = dash::size() * 4;
+  const size_t cols = dash::size() * 5;
+
+  dash::Matrix<double, 2> matrix_a(dash::SizeSpec<2>(rows, cols));
+  dash::Matrix<double, 2> matrix_b(dash::SizeSpec<2>(rows, cols));
+  for (size_t l = 0; l < matrix_a.local_size(); ++l) {
+    matrix_a.lbegin()[l] = matrix_a.pattern().global(l);
+    matrix_b.lbegin()[l] = 0.5;
+  }
+  dash::barrier();
+
+  dash::TeamSpec<2> teamspec(dash::size(), 1);
+  teamspec.balance_extents();
+  tile_pattern_t pattern(dash::SizeSpec<2>(rows, cols),
+                         dash::DistributionSpec<2>(
+                           dash::TILE(2), dash::TILE(5)),
+                         teamspec);
+  dash::Matrix<double, 2, dash::default_index_t, tile_pattern_t>
+    matrix_c(pattern);
+
+  dash::transform(matrix_a.begin(), matrix_a.end(),
+                  matrix_b.begin(),
+                  matrix_c.begin(),
+                  dash::plus<double>());
+
+  dash::barrier();
+
+  for (size_t l = 0; l < matrix_c.local_size(); ++l) {
+    EXPECT_EQ_U(pattern.global(l) + 0.5, matrix_c.lbegin()[l]);
+  }
+}
+
+TEST_F(TransformTest, ArrayLocalOpGlobalOutOfPlace)
+{
+  // Local range combined with a remote block of a global range, result
+  // is written to a remote block of another global range
+  const size_t num_elem_local = 10;
+  size_t num_elem_total = dash::size() * num_elem_local;
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_c(num_elem_total, dash::BLOCKED);
+  std::vector<int> local(num_elem_local, dash::myid() + 1);
+
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    array_b.local[l_idx] = array_b.pattern().global(l_idx);
+  }
+  dash::barrier();
+
+  auto block_offset = ((dash::myid() + 1) % dash::size()) * num_elem_local;
+  dash::transform(local.data(), local.data() + num_elem_local, // A
+                  array_b.begin() + block_offset,              // B
+                  array_c.begin() + block_offset,              // C
+                  [](int a, int b) { return b - a; });
+
+  dash::barrier();
+
+  int writer = (dash::myid() + dash::size() - 1) % dash::size();
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    int g_idx = array_c.pattern().global(l_idx);
+    EXPECT_EQ_U(g_idx - (writer + 1), array_c.local[l_idx]);
+  }
+}
+
+TEST_F(TransformTest, ExecutionPolicies)
+{
+  // Enough local elements to be split into several chunks:
+  const size_t num_elem_local = 5003;
+  size_t num_elem_total = dash::size() * num_elem_local;
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_c(num_elem_total, dash::BLOCKCYCLIC(1031));
+
+  for (size_t l_idx = 0; l_idx < array_a.lsize(); ++l_idx) {
+    auto g_idx = array_a.pattern().global(l_idx);
+    array_a.local[l_idx] = g_idx;
+    array_b.local[l_idx] = 2;
+  }
+  dash::fill(array_c.begin(), array_c.end(), -1);
+  dash::barrier();
+
+  // Identical distribution:
+  dash::transform(dash::execution::par,
+                  array_a.begin(), array_a.end(), // A
+                  array_b.begin(),                // B
+                  array_b.begin(),                // C = op(A,B)
+                  [](int a, int b) { return a - b; });
+  dash::barrier();
+  // Different distribution of output range:
+  dash::transform(dash::execution::seq,
+                  array_a.begin(), array_a.end(), // A
+                  array_b.begin(),                // B
+                  array_c.begin(),                // C = op(A,B)
+                  [](int a, int b) { return a * b; });
+  dash::barrier();
+
+  for (size_t l_idx = 0; l_idx < array_c.lsize(); ++l_idx) {
+    int g_idx = array_c.pattern().global(l_idx);
+    EXPECT_EQ_U(g_idx * (g_idx - 2), array_c.local[l_idx]);
+  }
+}
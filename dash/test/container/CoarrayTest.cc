@@ -552,3 +552,102 @@ TEST_F(CoarrayTest, CoEventIter)
     events.wait(num_images());
   }
 }
+
+TEST_F(CoarrayTest, CoEventWaitAnyAll)
+{
+  if(num_images() < 2){
+    SKIP_TEST_MSG("This test requires at least 2 units");
+  }
+  dash::Coevent ev_a;
+  dash::Coevent ev_b;
+
+  // Units post alternately to event a and b at unit 0:
+  int exp_a = 0;
+  int exp_b = 0;
+  for(int u = 1; u < static_cast<int>(num_images()); ++u){
+    if(u % 2 == 1){ ++exp_a; } else { ++exp_b; }
+  }
+  auto myid = static_cast<int>(this_image());
+  if(myid > 0){
+    if(myid % 2 == 1){ ev_a(0).post(); } else { ev_b(0).post(); }
+  } else {
+    int num_a = 0;
+    int num_b = 0;
+    for(int e = 0; e < exp_a + exp_b; ++e){
+      auto idx = dash::wait_any({ ev_a, ev_b });
+      if(idx == 0){ ++num_a; } else { ++num_b; }
+    }
+    EXPECT_EQ_U(exp_a, num_a);
+    EXPECT_EQ_U(exp_b, num_b);
+    EXPECT_EQ_U(0, ev_a.test());
+    EXPECT_EQ_U(0, ev_b.test());
+    EXPECT_FALSE_U(ev_a.try_wait());
+  }
+  dash::barrier();
+
+  // Every unit posts to both events at unit 0:
+  if(myid > 0){
+    ev_a(0).post();
+    ev_b(0).post();
+  } else {
+    dash::wait_all({ ev_a, ev_b }, num_images() - 1);
+    EXPECT_EQ_U(0, ev_a.test());
+    EXPECT_EQ_U(0, ev_b.test());
+  }
+  dash::barrier();
+}
+
+TEST_F(CoarrayTest, CoEventNotifyMessage)
+{
+  dash::Coevent events(dash::Team::All(),
+                       dash::coarray::coevent_notify::message);
+  EXPECT_EQ_U(dash::coarray::coevent_notify::message, events.notify());
+  EXPECT_FALSE_U(events.try_wait());
+  dash::barrier();
+
+  auto myid   = static_cast<int>(this_image());
+  auto nunits = static_cast<int>(num_images());
+  // Pass events around a ring of units:
+  int rounds = 10;
+  for(int r = 0; r < rounds; ++r){
+    events((myid + 1) % nunits).post();
+    events.wait();
+  }
+  dash::barrier();
+
+  // All units post to unit 0:
+  events(0).post();
+  if(myid == 0){
+    events.wait(nunits);
+    EXPECT_EQ_U(0, events.test());
+  }
+  dash::barrier();
+}
+
+TEST_F(CoarrayTest, CoEventNotifyMessageTeams)
+{
+  if(num_images() < 2){
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  auto & team_all = dash::Team::All();
+  auto & team_sub = team_all.split(2);
+  if(team_sub.num_siblings() < 2){
+    SKIP_TEST_MSG("Team::All().split(2) resulted in < 2 groups");
+  }
+  // Event counters of both coevents may have the same segment id in
+  // their team:
+  dash::Coevent ev_all(team_all, dash::coarray::coevent_notify::message);
+  dash::Coevent ev_sub(team_sub, dash::coarray::coevent_notify::message);
+
+  ev_all(0).post();
+  ev_sub(0).post();
+  if(team_sub.myid() == 0){
+    ev_sub.wait(team_sub.size());
+    EXPECT_EQ_U(0, ev_sub.test());
+  }
+  if(team_all.myid() == 0){
+    ev_all.wait(team_all.size());
+    EXPECT_EQ_U(0, ev_all.test());
+  }
+  team_all.barrier();
+}
@@ -1567,7 +1567,10 @@ TEST_F(MatrixTest, SubViewMatrix3Dim)
   
   if (dash::myid().id == 0) {
   int visited = 0;
-    for (auto it = matrix[0].begin(); it != matrix[0].end();
+    // Iterators refer to the view spec of the sub-matrix, which must
+    // outlive them:
+    auto matrix_0 = matrix[0];
+    for (auto it = matrix_0.begin(); it != matrix_0.end();
          ++it, ++visited) {
       double val = *it;
     }
@@ -0,0 +1,68 @@
+
+#include "SharedCounterTest.h"
+
+#include <dash/SharedCounter.h>
+
+
+TEST_F(SharedCounterTest, IncDec)
+{
+  typedef long value_t;
+
+  dash::SharedCounter<value_t> counter;
+  EXPECT_EQ_U(dash::size(), counter.num_shards());
+  EXPECT_EQ_U(0, counter.get());
+  dash::barrier();
+
+  value_t num_units = dash::size();
+  value_t my_inc    = dash::myid() + 1;
+  for (int i = 0; i < 10; ++i) {
+    counter.inc(my_inc);
+  }
+  counter.dec(my_inc);
+  dash::barrier();
+
+  value_t expected = 9 * (num_units * (num_units + 1)) / 2;
+  EXPECT_EQ_U(expected, counter.get());
+  dash::barrier();
+}
+
+TEST_F(SharedCounterTest, Shards)
+{
+  typedef size_t value_t;
+
+  for (size_t num_shards : { size_t(1), size_t(2), dash::size() + 1 }) {
+    dash::SharedCounter<value_t> counter(dash::Team::All(), num_shards);
+    EXPECT_EQ_U(std::min(num_shards, dash::size()), counter.num_shards());
+
+    // All units increment concurrently, shards are shared by several
+    // units unless there is one shard per unit:
+    for (int i = 0; i < 100; ++i) {
+      counter.inc(1);
+    }
+    dash::barrier();
+    EXPECT_EQ_U(100 * dash::size(), counter.get());
+    dash::barrier();
+  }
+}
+
+TEST_F(SharedCounterTest, RelaxedRead)
+{
+  typedef int value_t;
+
+  dash::SharedCounter<value_t> counter;
+  // First relaxed read is exact:
+  EXPECT_EQ_U(0, counter.get_relaxed());
+  dash::barrier();
+
+  counter.inc(1);
+  dash::barrier();
+
+  // Returns the value of the refresh started before increments:
+  value_t relaxed = counter.get_relaxed();
+  EXPECT_LE_U(0, relaxed);
+  EXPECT_GE_U(static_cast<value_t>(dash::size()), relaxed);
+  // Returns the value of the refresh started after increments:
+  EXPECT_EQ_U(static_cast<value_t>(dash::size()), counter.get_relaxed());
+  EXPECT_EQ_U(static_cast<value_t>(dash::size()), counter.get());
+  dash::barrier();
+}
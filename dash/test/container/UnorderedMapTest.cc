@@ -4,9 +4,11 @@
 #include <dash/Meta.h>
 #include <dash/UnorderedMap.h>
 #include <dash/Atomic.h>
+#include <dash/map/UnorderedMapIndex.h>
 
 #include <vector>
 #include <algorithm>
+#include <cstring>
 
 
 TEST_F(UnorderedMapTest, Initialization)
@@ -543,3 +545,163 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, HashIndexLookup)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  // Exceeds the initial capacity of the hash index:
+  size_type local_elements = 100;
+
+  map_t map;
+  DASH_LOG_DEBUG("UnorderedMapTest.HashIndexLookup", "map initialized");
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t     key    = (nunits * li) + dash::myid().id;
+    mapped_t  mapped = 1.0 * (dash::myid().id + 1) + (0.01 * (li + 1));
+    map_value value({ key, mapped });
+    auto insertion = map.local.insert(value);
+    EXPECT_TRUE_U(insertion.second);
+    EXPECT_EQ_U(1, map.local.count(key));
+  }
+
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+
+  for (int unit = 0; unit < nunits; ++unit) {
+    for (int li = 0; li < local_elements; ++li) {
+      key_t     key    = (nunits * li) + unit;
+      mapped_t  mapped = 1.0 * (unit + 1) + (0.01 * (li + 1));
+      map_value value({ key, mapped });
+
+      auto found = map.find(key);
+      EXPECT_NE_U(map.end(), found);
+      map_value found_value = *found;
+      EXPECT_EQ_U(value, found_value);
+      EXPECT_EQ_U(1, map.count(key));
+    }
+  }
+  // Keys not contained in the map:
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * (local_elements + li)) + dash::myid().id;
+    EXPECT_EQ_U(map.end(), map.find(key));
+    EXPECT_EQ_U(0, map.count(key));
+  }
+}
+
+TEST_F(UnorderedMapTest, BulkInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits       = dash::size();
+  size_type myid         = dash::myid().id;
+  size_type nkeys        = 1000;
+
+  map_t map;
+
+  // Every unit inserts the keys mapped to the next unit and the key mapped
+  // to itself, every key occurs twice in the local range:
+  std::vector<map_value> values;
+  for (size_type key = 0; key < nkeys; ++key) {
+    if (key % nunits == (myid + 1) % nunits || key % nunits == myid) {
+      values.push_back(map_value(key, 0.5 * key));
+      values.push_back(map_value(key, 0.5 * key));
+    }
+  }
+  map.bulk_insert(values.begin(), values.end());
+
+  EXPECT_EQ_U(nkeys, map.size());
+  size_type exp_lsize = 0;
+  for (size_type key = 0; key < nkeys; ++key) {
+    if (key % nunits == myid) {
+      exp_lsize++;
+    }
+  }
+  EXPECT_EQ_U(exp_lsize, map.lsize());
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(myid, value.first % nunits);
+  }
+
+  for (size_type key = 0; key < nkeys; ++key) {
+    auto found = map.find(key);
+    EXPECT_NE_U(map.end(), found);
+    map_value found_value = *found;
+    EXPECT_EQ_U(map_value(key, 0.5 * key), found_value);
+  }
+
+  // Inserting existing keys does not change the map:
+  map.bulk_insert(values.begin(), values.end());
+  EXPECT_EQ_U(nkeys, map.size());
+  EXPECT_EQ_U(exp_lsize, map.lsize());
+}
+
+struct PaddedKey
+{
+  char tag;
+  int  id;
+};
+
+struct PaddedKeyEqual
+{
+  bool operator()(const PaddedKey & a, const PaddedKey & b) const {
+    return a.id == b.id;
+  }
+};
+
+namespace std {
+template<>
+struct hash<PaddedKey>
+{
+  std::size_t operator()(const PaddedKey & key) const {
+    return std::hash<int>()(key.id);
+  }
+};
+} // namespace std
+
+TEST_F(UnorderedMapTest, IndexKeyHash)
+{
+  typedef dash::internal::UnorderedMapIndex<
+            PaddedKey, PaddedKeyEqual, size_t>         index_t;
+
+  static_assert(dash::internal::is_std_hashable<int>::value,
+                "std::hash enabled for int");
+  static_assert(dash::internal::is_std_hashable<PaddedKey>::value,
+                "std::hash specialized for PaddedKey");
+  static_assert(!dash::internal::is_std_hashable<PaddedKeyEqual>::value,
+                "std::hash not enabled for PaddedKeyEqual");
+
+  index_t index;
+  for (int id = 0; id < 100; ++id) {
+    PaddedKey key;
+    std::memset(&key, 0, sizeof(key));
+    key.tag = 'a';
+    key.id  = id;
+    index.insert(key, id);
+  }
+  EXPECT_EQ_U(100, index.size());
+
+  // Keys compared equal by the predicate differ in padding bytes and
+  // fields ignored by the predicate:
+  for (int id = 0; id < 100; ++id) {
+    PaddedKey key;
+    std::memset(&key, 0xff, sizeof(key));
+    key.tag = 'b';
+    key.id  = id;
+    EXPECT_EQ_U(id, index.find(key));
+  }
+  PaddedKey missing { 'a', 100 };
+  EXPECT_EQ_U(index_t::npos, index.find(missing));
+}
@@ -182,3 +182,223 @@ TEST_F(DARTCollectiveTest, MaxElementAt) {
   dart_op_destroy(&new_op);
 
 }
+
+TEST_F(DARTCollectiveTest, Alltoall) {
+  const size_t nunits = dash::size();
+  const size_t nelem  = 3;
+
+  std::vector<int> send(nunits * nelem);
+  std::vector<int> recv(nunits * nelem, -1);
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nelem; ++e) {
+      send[u * nelem + e] = (dash::myid() * 1000) + (u * 10) + e;
+    }
+  }
+
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoall(send.data(), recv.data(), nelem, DART_TYPE_INT,
+                  dash::Team::All().dart_id()));
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nelem; ++e) {
+      ASSERT_EQ_U((u * 1000) + (dash::myid() * 10) + e,
+                  recv[u * nelem + e]);
+    }
+  }
+
+  // non-blocking variant
+  std::fill(recv.begin(), recv.end(), -1);
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoall_handle(send.data(), recv.data(), nelem, DART_TYPE_INT,
+                         dash::Team::All().dart_id(), &handle));
+  ASSERT_EQ_U(DART_OK, dart_wait_local(&handle));
+  ASSERT_EQ_U(DART_HANDLE_NULL, handle);
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nelem; ++e) {
+      ASSERT_EQ_U((u * 1000) + (dash::myid() * 10) + e,
+                  recv[u * nelem + e]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, Alltoallv) {
+  const size_t nunits = dash::size();
+  const size_t myid   = dash::myid();
+
+  // unit i sends (i + u) % 3 values to unit u
+  std::vector<size_t> sendcounts(nunits), senddispls(nunits);
+  std::vector<size_t> recvcounts(nunits), recvdispls(nunits);
+  size_t nsend = 0, nrecv = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    sendcounts[u] = (myid + u) % 3;
+    senddispls[u] = nsend;
+    nsend        += sendcounts[u];
+    recvcounts[u] = (u + myid) % 3;
+    recvdispls[u] = nrecv;
+    nrecv        += recvcounts[u];
+  }
+
+  std::vector<int> send(nsend);
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < sendcounts[u]; ++e) {
+      send[senddispls[u] + e] = (myid * 1000) + (u * 10) + e;
+    }
+  }
+
+  std::vector<int> recv(nrecv, -1);
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoallv(send.data(), sendcounts.data(), senddispls.data(),
+                   DART_TYPE_INT,
+                   recv.data(), recvcounts.data(), recvdispls.data(),
+                   dash::Team::All().dart_id()));
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < recvcounts[u]; ++e) {
+      ASSERT_EQ_U((u * 1000) + (myid * 10) + e, recv[recvdispls[u] + e]);
+    }
+  }
+
+  // non-blocking variant, counts and displacements are released before
+  // completion
+  std::fill(recv.begin(), recv.end(), -1);
+  dart_handle_t handle;
+  {
+    auto sc = sendcounts, sd = senddispls, rc = recvcounts, rd = recvdispls;
+    ASSERT_EQ_U(DART_OK,
+      dart_alltoallv_handle(send.data(), sc.data(), sd.data(), DART_TYPE_INT,
+                            recv.data(), rc.data(), rd.data(),
+                            dash::Team::All().dart_id(), &handle));
+  }
+  ASSERT_EQ_U(DART_OK, dart_wait_local(&handle));
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < recvcounts[u]; ++e) {
+      ASSERT_EQ_U((u * 1000) + (myid * 10) + e, recv[recvdispls[u] + e]);
+    }
+  }
+
+  // DASH wrapper with non-DART value type
+  struct value_t { int a; char b; };
+  std::vector<value_t> vsend(nsend);
+  for (size_t i = 0; i < nsend; ++i) {
+    vsend[i] = value_t{send[i], static_cast<char>(i)};
+  }
+  std::vector<value_t> vrecv(nrecv);
+  dash::Team::All().alltoallv(
+    vsend.data(), sendcounts.data(), senddispls.data(),
+    vrecv.data(), recvcounts.data(), recvdispls.data());
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < recvcounts[u]; ++e) {
+      ASSERT_EQ_U((u * 1000) + (myid * 10) + e,
+                  vrecv[recvdispls[u] + e].a);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, CollectiveHandles) {
+  const size_t nunits = dash::size();
+  const int    myid   = dash::myid();
+  dart_team_t  team   = dash::Team::All().dart_id();
+
+  dart_handle_t handles[4];
+
+  // barrier
+  ASSERT_EQ_U(DART_OK, dart_barrier_handle(team, &handles[0]));
+
+  // broadcast from last unit
+  int bcast_val = (myid == static_cast<int>(nunits) - 1) ? 42 : -1;
+  ASSERT_EQ_U(DART_OK,
+    dart_bcast_handle(&bcast_val, 1, DART_TYPE_INT,
+                      dart_team_unit_t{static_cast<int>(nunits) - 1},
+                      team, &handles[1]));
+
+  // allgather
+  std::vector<int> gathered(nunits, -1);
+  ASSERT_EQ_U(DART_OK,
+    dart_allgather_handle(&myid, gathered.data(), 1, DART_TYPE_INT,
+                          team, &handles[2]));
+
+  // allreduce
+  int sum = -1;
+  ASSERT_EQ_U(DART_OK,
+    dart_allreduce_handle(&myid, &sum, 1, DART_TYPE_INT, DART_OP_SUM,
+                          team, &handles[3]));
+
+  ASSERT_EQ_U(DART_OK, dart_waitall_local(handles, 4));
+
+  ASSERT_EQ_U(42, bcast_val);
+  for (size_t u = 0; u < nunits; ++u) {
+    ASSERT_EQ_U(u, gathered[u]);
+  }
+  ASSERT_EQ_U((nunits * (nunits - 1)) / 2, sum);
+
+  // test until completion
+  int32_t flag = 0;
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK, dart_barrier_handle(team, &handle));
+  while (!flag) {
+    ASSERT_EQ_U(DART_OK, dart_test_local(&handle, &flag));
+  }
+  ASSERT_EQ_U(DART_HANDLE_NULL, handle);
+}
+
+TEST_F(DARTCollectiveTest, HierarchicalCollectives) {
+  const int    nunits = dash::size();
+  const int    myid   = dash::myid();
+  dart_team_t  team   = dash::Team::All().dart_id();
+
+  dart_coll_algorithm_t prev_algorithm;
+  ASSERT_EQ_U(DART_OK, dart_team_get_coll_algorithm(team, &prev_algorithm));
+  ASSERT_EQ_U(DART_OK,
+    dart_team_set_coll_algorithm(team, DART_COLL_HIERARCHICAL));
+  dart_coll_algorithm_t algorithm;
+  ASSERT_EQ_U(DART_OK, dart_team_get_coll_algorithm(team, &algorithm));
+  ASSERT_EQ_U(DART_COLL_HIERARCHICAL, algorithm);
+
+  ASSERT_EQ_U(DART_OK, dart_barrier(team));
+
+  // broadcast from every unit, exceeding the size of the shared buffers
+  const int nbcast = 100000;
+  std::vector<int> bcast_buf(nbcast);
+  for (int root = 0; root < nunits; ++root) {
+    for (int i = 0; i < nbcast; ++i) {
+      bcast_buf[i] = (myid == root) ? (root * 7) + i : -1;
+    }
+    ASSERT_EQ_U(DART_OK,
+      dart_bcast(bcast_buf.data(), nbcast, DART_TYPE_INT,
+                 dart_team_unit_t{root}, team));
+    for (int i = 0; i < nbcast; ++i) {
+      ASSERT_EQ_U((root * 7) + i, bcast_buf[i]);
+    }
+  }
+
+  // allreduce exceeding the size of the shared buffers
+  const int nreduce = 50000;
+  std::vector<long> reduce_in(nreduce);
+  std::vector<long> reduce_out(nreduce, -1);
+  for (int i = 0; i < nreduce; ++i) {
+    reduce_in[i] = myid + i;
+  }
+  ASSERT_EQ_U(DART_OK,
+    dart_allreduce(reduce_in.data(), reduce_out.data(), nreduce,
+                   DART_TYPE_LONG, DART_OP_SUM, team));
+  for (int i = 0; i < nreduce; ++i) {
+    ASSERT_EQ_U((static_cast<long>(nunits) * i) +
+                  (nunits * (nunits - 1)) / 2,
+                reduce_out[i]);
+  }
+
+  std::array<int, 2> min_max_in{{myid, myid + nunits}};
+  std::array<int, 2> min_max_out{};
+  ASSERT_EQ_U(DART_OK,
+    dart_allreduce(&min_max_in, &min_max_out, 2, DART_TYPE_INT,
+                   DART_OP_MINMAX, team));
+  ASSERT_EQ_U(0, min_max_out[DART_OP_MINMAX_MIN]);
+  ASSERT_EQ_U(2 * nunits - 1, min_max_out[DART_OP_MINMAX_MAX]);
+
+  ASSERT_EQ_U(DART_OK, dart_barrier(team));
+  ASSERT_EQ_U(DART_OK, dart_team_set_coll_algorithm(team, prev_algorithm));
+}
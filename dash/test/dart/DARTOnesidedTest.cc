@@ -280,6 +280,71 @@ TEST_F(DARTOnesidedTest, StridedPutSimple) {
 }
 
 
+TEST_F(DARTOnesidedTest, StridedTypeCache) {
+  constexpr size_t num_elem_per_unit = 120;
+  constexpr size_t stride            = 3;
+  constexpr int    num_iter          = 10;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = i;
+  }
+  dash::barrier();
+
+  dart_unit_t neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid = neighbor;
+
+  int *buf = new int[num_elem_per_unit];
+
+  dart_datatype_t new_type;
+  dart_type_create_strided(DART_TYPE_INT, stride, 1, &new_type);
+
+  dart_type_cache_stats_t stats_begin;
+  ASSERT_EQ_U(DART_OK, dart_type_cache_stats(&stats_begin));
+
+  for (int iter = 0; iter < num_iter; ++iter) {
+    memset(buf, 0, sizeof(int)*num_elem_per_unit);
+    dart_get_blocking(buf, gptr, num_elem_per_unit / stride,
+                      new_type, DART_TYPE_INT);
+    for (int i = 0; i < num_elem_per_unit / stride; ++i) {
+      ASSERT_EQ_U(i*stride, buf[i]);
+    }
+  }
+
+  dart_type_cache_stats_t stats;
+  ASSERT_EQ_U(DART_OK, dart_type_cache_stats(&stats));
+  // MPI type is only created in the first transfer:
+  EXPECT_EQ_U(1,            stats.misses - stats_begin.misses);
+  EXPECT_EQ_U(num_iter - 1, stats.hits   - stats_begin.hits);
+
+  // Transfers with more different block counts than cache entries:
+  for (int nblocks = 1; nblocks <= num_elem_per_unit / stride; ++nblocks) {
+    memset(buf, 0, sizeof(int)*num_elem_per_unit);
+    dart_get_blocking(buf, gptr, nblocks, new_type, DART_TYPE_INT);
+    for (int i = 0; i < nblocks; ++i) {
+      ASSERT_EQ_U(i*stride, buf[i]);
+    }
+  }
+  ASSERT_EQ_U(DART_OK, dart_type_cache_stats(&stats));
+  EXPECT_GT_U(stats.evictions, stats_begin.evictions);
+
+  dart_type_destroy(&new_type);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+
+  delete[] buf;
+}
+
+
 TEST_F(DARTOnesidedTest, BlockedStridedToStrided) {
 
   constexpr size_t num_elem_per_unit = 120;
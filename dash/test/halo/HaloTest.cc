@@ -986,6 +986,139 @@ TEST_F(HaloTest, HaloMatrixWrapperBigMix3D)
   dash::Team::All().barrier();
 }
 
+TEST_F(HaloTest, HaloMatrixWrapperPush3D)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using PatternCol_t = dash::Pattern<3, dash::COL_MAJOR>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using MatrixCol_t = dash::Matrix<long, 3, index_type, PatternCol_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 26>;
+
+  auto myid(dash::myid());
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+  PatternCol_t pattern_col(SizeSpec_t(ext_per_dim,ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_halo(pattern);
+  MatrixCol_t matrix_halo_col(pattern_col);
+
+  dash::fill(matrix_halo.begin(), matrix_halo.end(), 1);
+  dash::fill(matrix_halo_col.begin(), matrix_halo_col.end(), 1);
+
+  dash::Team::All().barrier();
+
+  init_matrix3D(matrix_halo);
+  init_matrix3D(matrix_halo_col);
+
+  dash::Team::All().barrier();
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1,-1,-1), StencilP_t(-1,-1, 0), StencilP_t(-1,-1, 1),
+      StencilP_t(-1, 0,-1), StencilP_t(-1, 0, 0), StencilP_t(-1, 0, 1),
+      StencilP_t(-1, 1,-1), StencilP_t(-1, 1, 0), StencilP_t(-1, 1, 1),
+      StencilP_t( 0,-1,-1), StencilP_t( 0,-1, 0), StencilP_t( 0,-1, 1),
+      StencilP_t( 0, 0,-1),                     StencilP_t( 0, 0, 1),
+      StencilP_t( 0, 1,-1), StencilP_t( 0, 1, 0), StencilP_t( 0, 1, 1),
+      StencilP_t( 1,-1,-1), StencilP_t( 1,-1, 0), StencilP_t( 1,-1, 1),
+      StencilP_t( 1, 0,-1), StencilP_t( 1, 0, 0), StencilP_t( 1, 0, 1),
+      StencilP_t( 1, 1,-1), StencilP_t( 1, 1, 0), StencilP_t( 1, 1, 1)
+  );
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC, BoundaryProp::CUSTOM);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix_halo, bound_spec, stencil_spec);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_push(
+    matrix_halo, bound_spec, HaloUpdateMode::PUSH, stencil_spec);
+  HaloMatrixWrapper<MatrixCol_t> halo_wrapper_col_push(
+    matrix_halo_col, bound_spec, HaloUpdateMode::PUSH, stencil_spec);
+
+  EXPECT_EQ_U(HaloUpdateMode::PULL, halo_wrapper.update_mode());
+  EXPECT_EQ_U(HaloUpdateMode::PUSH, halo_wrapper_push.update_mode());
+
+  auto custom_halo = [](const std::array<dash::default_index_t,3>& coords) {
+      return 20;
+  };
+  halo_wrapper.set_custom_halos(custom_halo);
+  halo_wrapper_push.set_custom_halos(custom_halo);
+  halo_wrapper_col_push.set_custom_halos(custom_halo);
+
+  auto stencil_op          = halo_wrapper.stencil_operator(stencil_spec);
+  auto stencil_op_push     = halo_wrapper_push.stencil_operator(stencil_spec);
+  auto stencil_op_col_push = halo_wrapper_col_push.stencil_operator(stencil_spec);
+
+  auto sum_halo          = calc_sum_halo(halo_wrapper, stencil_op);
+  auto sum_halo_push     = calc_sum_halo(halo_wrapper_push, stencil_op_push);
+  auto sum_halo_col_push = calc_sum_halo(halo_wrapper_col_push,
+                                         stencil_op_col_push);
+  if(myid == 0) {
+    EXPECT_EQ(sum_halo, sum_halo_push);
+    EXPECT_EQ(sum_halo, sum_halo_col_push);
+  }
+
+  // Subsequent updates have to push the modified boundary elements:
+  std::for_each(matrix_halo.lbegin(), matrix_halo.lend(),
+                [](long& elem) { elem += 1; });
+  std::for_each(matrix_halo_col.lbegin(), matrix_halo_col.lend(),
+                [](long& elem) { elem += 1; });
+  dash::Team::All().barrier();
+
+  sum_halo          = calc_sum_halo(halo_wrapper, stencil_op);
+  sum_halo_push     = calc_sum_halo(halo_wrapper_push, stencil_op_push);
+  sum_halo_col_push = calc_sum_halo(halo_wrapper_col_push,
+                                    stencil_op_col_push, true);
+  auto sum_halo_push_2 = calc_sum_halo(halo_wrapper_push, stencil_op_push);
+  if(myid == 0) {
+    EXPECT_EQ(sum_halo, sum_halo_push);
+    EXPECT_EQ(sum_halo, sum_halo_col_push);
+    EXPECT_EQ(sum_halo, sum_halo_push_2);
+  }
+
+  EXPECT_THROW(halo_wrapper_push.update_at(0),
+               dash::exception::NotImplemented);
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperPushMultipleOwners)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t      = StencilPoint<2>;
+  using StencilSpec_t   = StencilSpec<StencilP_t, 2>;
+
+  if (dash::size() < 3) {
+    SKIP_TEST_MSG("requires at least 3 units");
+  }
+
+  // Single row per unit, halo regions of width 2 span two units:
+  DistSpec_t dist_spec(dash::BLOCKED, dash::NONE);
+  TeamSpec_t team_spec(dash::size(), 1);
+  Pattern_t  pattern(SizeSpec_t(dash::size(), 8), dist_spec, team_spec,
+                     dash::Team::All());
+  Matrix_t   matrix_halo(pattern);
+
+  StencilSpec_t stencil_spec(StencilP_t(-2, 0), StencilP_t(2, 0));
+  EXPECT_THROW(
+    (HaloMatrixWrapper<Matrix_t>(matrix_halo, GlobBoundSpec_t(),
+                                 HaloUpdateMode::PUSH, stencil_spec)),
+    dash::exception::InvalidArgument);
+
+  dash::Team::All().barrier();
+}
+
 TEST_F(HaloTest, HaloMatrixWrapperMultiStencil3D)
 {
   using Pattern_t = dash::Pattern<3>;
@@ -0,0 +1,133 @@
+
+#include "CheckpointTest.h"
+
+#include <dash/io/Checkpoint.h>
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/algorithm/Fill.h>
+
+using dash::io::Checkpoint;
+
+TEST_F(CheckpointTest, ArrayInPlace)
+{
+  const size_t size = 1000 * dash::size() + 17;
+
+  dash::Array<long> arr1(size);
+  for (size_t l = 0; l < arr1.lsize(); ++l) {
+    arr1.local[l] = arr1.pattern().global(l) * 3;
+  }
+  Checkpoint::write(arr1, _filename);
+
+  dash::Array<long> arr2(size);
+  dash::fill(arr2.begin(), arr2.end(), -1);
+  ASSERT_TRUE_U(Checkpoint::read(arr2, _filename));
+
+  for (size_t l = 0; l < arr2.lsize(); ++l) {
+    ASSERT_EQ_U(arr2.pattern().global(l) * 3, arr2.local[l]);
+  }
+}
+
+TEST_F(CheckpointTest, ArrayRedistribute)
+{
+  const size_t size = 1000 * dash::size() + 17;
+
+  dash::Array<double> arr1(size, dash::BLOCKCYCLIC(7));
+  for (size_t l = 0; l < arr1.lsize(); ++l) {
+    arr1.local[l] = arr1.pattern().global(l) + 0.5;
+  }
+  Checkpoint::write(arr1, _filename);
+
+  dash::Array<double> arr2(size, dash::CYCLIC);
+  ASSERT_FALSE_U(Checkpoint::read(arr2, _filename));
+
+  for (size_t l = 0; l < arr2.lsize(); ++l) {
+    ASSERT_EQ_U(arr2.pattern().global(l) + 0.5, arr2.local[l]);
+  }
+
+  // restore on a subset of the units:
+  auto & team = dash::Team::All().split(2);
+  if (team.num_siblings() < 2) {
+    SKIP_TEST_MSG("Team::All().split(2) resulted in < 2 groups");
+  }
+  if (team.position() == 0) {
+    dash::Array<double> arr3(size, dash::BLOCKED, team);
+    ASSERT_FALSE_U(Checkpoint::read(arr3, _filename));
+    for (size_t l = 0; l < arr3.lsize(); ++l) {
+      ASSERT_EQ_U(arr3.pattern().global(l) + 0.5, arr3.local[l]);
+    }
+  }
+  dash::Team::All().barrier();
+}
+
+TEST_F(CheckpointTest, MatrixRedistribute)
+{
+  typedef dash::Matrix<int, 2>              matrix_t;
+  typedef dash::TilePattern<2>              tile_pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, tile_pattern_t>
+                                            tile_matrix_t;
+
+  const size_t nunits = dash::size();
+  const size_t rows   = 4 * nunits;
+  const size_t cols   = 6 * nunits;
+
+  dash::TeamSpec<2> teamspec(nunits, 1);
+  teamspec.balance_extents();
+
+  tile_pattern_t pattern(dash::SizeSpec<2>(rows, cols),
+                         dash::DistributionSpec<2>(
+                           dash::TILE(2), dash::TILE(3)),
+                         teamspec);
+  tile_matrix_t mat1(pattern);
+  for (size_t l = 0; l < mat1.local_size(); ++l) {
+    auto coords = pattern.coords(pattern.global(l));
+    mat1.lbegin()[l] = coords[0] * 1000 + coords[1];
+  }
+  Checkpoint::write(mat1, _filename);
+
+  tile_matrix_t mat2(pattern);
+  ASSERT_TRUE_U(Checkpoint::read(mat2, _filename));
+  for (size_t l = 0; l < mat2.local_size(); ++l) {
+    ASSERT_EQ_U(mat1.lbegin()[l], mat2.lbegin()[l]);
+  }
+
+  matrix_t mat3(dash::SizeSpec<2>(rows, cols),
+                dash::DistributionSpec<2>(dash::NONE, dash::BLOCKED));
+  ASSERT_FALSE_U(Checkpoint::read(mat3, _filename));
+  for (size_t r = 0; r < mat3.local.extent(0); ++r) {
+    for (size_t c = 0; c < mat3.local.extent(1); ++c) {
+      auto g_coords = mat3.pattern().global({{ static_cast<long>(r),
+                                               static_cast<long>(c) }});
+      ASSERT_EQ_U(g_coords[0] * 1000 + g_coords[1], mat3.local[r][c]);
+    }
+  }
+}
+
+TEST_F(CheckpointTest, ExtentMismatch)
+{
+  dash::Array<int> arr1(dash::size() * 10);
+  Checkpoint::write(arr1, _filename);
+
+  dash::Array<int> arr2(dash::size() * 11);
+  EXPECT_THROW(
+    Checkpoint::read(arr2, _filename),
+    dash::exception::InvalidArgument);
+  dash::Team::All().barrier();
+}
+
+TEST_F(CheckpointTest, FailureAtSingleUnit)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+  dash::Array<int> arr(dash::size() * 10);
+
+  // Units except unit 0 fail to open the checkpoint file for writing
+  // their local elements, unit 0 must not wait for them:
+  std::string filename = (dash::myid() == 0)
+                         ? _filename
+                         : "nonexistent_directory/" + _filename;
+  EXPECT_THROW(
+    Checkpoint::write(arr, filename),
+    dash::exception::RuntimeError);
+  dash::Team::All().barrier();
+}
@@ -0,0 +1,36 @@
+#ifndef DASH__TEST__CHECKPOINT_TEST_H__INCLUDED
+#define DASH__TEST__CHECKPOINT_TEST_H__INCLUDED
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::io::Checkpoint
+ */
+class CheckpointTest : public dash::test::TestBase {
+ protected:
+  std::string _filename = "test_checkpoint.ckpt";
+
+  CheckpointTest() { LOG_MESSAGE(">>> Test suite: CheckpointTest"); }
+
+  virtual ~CheckpointTest() {
+    LOG_MESSAGE("<<< Closing test suite: CheckpointTest");
+  }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    if (dash::myid() == 0) {
+      remove(_filename.c_str());
+    }
+    dash::Team::All().barrier();
+  }
+
+  virtual void TearDown() {
+    dash::Team::All().barrier();
+    if (dash::myid() == 0) {
+      remove(_filename.c_str());
+    }
+    dash::test::TestBase::TearDown();
+  }
+};
+
+#endif  // DASH__TEST__CHECKPOINT_TEST_H__INCLUDED
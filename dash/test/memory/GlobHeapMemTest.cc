@@ -554,3 +554,160 @@ TEST_F(GlobHeapMemTest, RemoteAccess)
     }
   }
 }
+
+TEST_F(GlobHeapMemTest, RandomAccess)
+{
+  typedef int value_t;
+
+  size_t initial_local_capacity = 3;
+  dash::GlobHeapMem<value_t> gdmem(initial_local_capacity);
+
+  // Every unit attaches a different number of buckets with different
+  // sizes, some units do not grow:
+  auto myid = static_cast<size_t>(dash::myid());
+  for (size_t b = 0; b < myid % 4; ++b) {
+    gdmem.grow(b + myid + 1);
+  }
+  gdmem.commit();
+
+  // Expected local sizes and global offsets of all units:
+  std::vector<size_t> unit_lsizes;
+  std::vector<size_t> unit_offsets;
+  size_t gsize = 0;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    size_t lsize = initial_local_capacity;
+    for (size_t b = 0; b < u % 4; ++b) {
+      lsize += b + u + 1;
+    }
+    unit_lsizes.push_back(lsize);
+    unit_offsets.push_back(gsize);
+    gsize += lsize;
+  }
+  ASSERT_EQ_U(gsize, gdmem.size());
+  ASSERT_EQ_U(unit_lsizes[myid], gdmem.local_size());
+
+  auto lbegin = gdmem.lbegin();
+  for (size_t li = 0; li < gdmem.local_size(); ++li) {
+    *(lbegin + li) = static_cast<value_t>(1000 * (myid + 1) + li);
+  }
+  dash::barrier();
+
+  auto expected_at = [&](size_t gidx) {
+                       size_t u = 0;
+                       while (gidx >= unit_offsets[u] + unit_lsizes[u]) {
+                         ++u;
+                       }
+                       return static_cast<value_t>(
+                                1000 * (u + 1) + (gidx - unit_offsets[u]));
+                     };
+
+  // Random access from the global begin pointer:
+  auto gbegin = gdmem.begin();
+  for (size_t gidx = 0; gidx < gsize; ++gidx) {
+    auto gptr = gbegin + gidx;
+    EXPECT_EQ_U(static_cast<long>(gidx), gptr.pos());
+    value_t actual;
+    dash::get_value(&actual, gptr);
+    EXPECT_EQ_U(expected_at(gidx), actual);
+  }
+
+  // Strided forward and backward jumps across units and buckets:
+  auto   gptr = gdmem.end();
+  size_t gidx = gsize;
+  for (size_t stride : { 7, 3, 1, 5 }) {
+    while (gidx >= stride) {
+      gptr -= stride;
+      gidx -= stride;
+      value_t actual;
+      dash::get_value(&actual, gptr);
+      EXPECT_EQ_U(expected_at(gidx), actual);
+    }
+    while (gidx + stride < gsize) {
+      gptr += stride;
+      gidx += stride;
+      value_t actual;
+      dash::get_value(&actual, gptr);
+      EXPECT_EQ_U(expected_at(gidx), actual);
+    }
+  }
+
+  // Resolution of unit and local offset:
+  for (dash::team_unit_t u{0}; u < dash::size(); ++u) {
+    for (size_t li = 0; li < unit_lsizes[u]; ++li) {
+      auto gptr_u = gdmem.at(u, li);
+      EXPECT_EQ_U(static_cast<long>(unit_offsets[u] + li), gptr_u.pos());
+      EXPECT_EQ_U(u, gptr_u.lpos().unit);
+      EXPECT_EQ_U(static_cast<long>(li), gptr_u.lpos().index);
+    }
+  }
+  dash::barrier();
+}
+
+TEST_F(GlobHeapMemTest, CoalescedCommit)
+{
+  typedef int value_t;
+
+  dash::GlobHeapMem<value_t> gdmem(0);
+  auto myid = static_cast<size_t>(dash::myid());
+
+  // Units grow an unbalanced number of small buckets in every commit, the
+  // number of collective operations per commit must not depend on the
+  // number of buckets:
+  size_t num_commits = 3;
+  for (size_t c = 0; c < num_commits; ++c) {
+    auto   stats_old   = gdmem.commit_stats();
+    size_t num_buckets = ((myid + c) % 3) * 8;
+    for (size_t b = 0; b < num_buckets; ++b) {
+      gdmem.grow(1 + (b % 2));
+    }
+    gdmem.commit();
+    auto stats = gdmem.commit_stats();
+    size_t max_num_buckets = 0;
+    for (size_t u = 0; u < dash::size(); ++u) {
+      max_num_buckets = std::max(max_num_buckets, ((u + c) % 3) * 8);
+    }
+    EXPECT_EQ_U(stats_old.num_commits + 1, stats.num_commits);
+    EXPECT_LE_U(stats.num_collectives - stats_old.num_collectives, 3);
+    EXPECT_EQ_U(num_buckets,
+                stats.num_attached_buckets - stats_old.num_attached_buckets);
+    EXPECT_EQ_U(max_num_buckets - num_buckets,
+                stats.num_padding_buckets - stats_old.num_padding_buckets);
+  }
+
+  std::vector<size_t> unit_offsets;
+  size_t gsize = 0;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    unit_offsets.push_back(gsize);
+    for (size_t c = 0; c < num_commits; ++c) {
+      size_t num_buckets = ((u + c) % 3) * 8;
+      for (size_t b = 0; b < num_buckets; ++b) {
+        gsize += 1 + (b % 2);
+      }
+    }
+  }
+  unit_offsets.push_back(gsize);
+  ASSERT_EQ_U(gsize, gdmem.size());
+  ASSERT_EQ_U(unit_offsets[myid + 1] - unit_offsets[myid],
+              gdmem.local_size());
+
+  auto lbegin = gdmem.lbegin();
+  for (size_t li = 0; li < gdmem.local_size(); ++li) {
+    *(lbegin + li) = static_cast<value_t>(1000 * (myid + 1) + li);
+  }
+  dash::barrier();
+
+  // Buckets attached in different commits are resolved at all units:
+  size_t unit = 0;
+  auto   gptr = gdmem.begin();
+  for (size_t gidx = 0; gidx < gsize; ++gidx, ++gptr) {
+    while (gidx >= unit_offsets[unit + 1]) {
+      ++unit;
+    }
+    value_t actual;
+    dash::get_value(&actual, gptr);
+    EXPECT_EQ_U(static_cast<value_t>(
+                  1000 * (unit + 1) + (gidx - unit_offsets[unit])),
+                actual);
+  }
+  dash::barrier();
+}
@@ -0,0 +1,117 @@
+#include "WriteCombineBufferTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/memory/WriteCombineBuffer.h>
+
+
+TEST_F(WriteCombineBufferTest, CoalesceContiguousWrites)
+{
+  const size_t elem_per_unit = 64;
+  dash::Array<int> array(elem_per_unit * dash::size());
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  dash::WriteCombineBuffer::set_capacity(4096);
+  dash::WriteCombineBuffer::reset_stats();
+
+  auto neighbor = (dash::myid() + 1) % dash::size();
+  for (size_t i = 0; i < elem_per_unit; ++i) {
+    array.async[neighbor * elem_per_unit + i] = neighbor * 1000 + i;
+  }
+  EXPECT_TRUE_U(dash::WriteCombineBuffer::pending());
+  array.flush();
+  EXPECT_FALSE_U(dash::WriteCombineBuffer::pending());
+
+  auto stats = dash::WriteCombineBuffer::stats();
+  EXPECT_EQ_U(elem_per_unit,               stats.num_writes);
+  EXPECT_EQ_U(elem_per_unit * sizeof(int), stats.num_bytes);
+  EXPECT_EQ_U(1,                           stats.num_puts);
+  EXPECT_EQ_U(1,                           stats.num_blocks);
+  EXPECT_EQ_U(0,                           stats.num_full_drains);
+  EXPECT_DOUBLE_EQ(static_cast<double>(elem_per_unit),
+                   dash::WriteCombineBuffer::coalescing());
+  array.barrier();
+
+  for (size_t i = 0; i < elem_per_unit; ++i) {
+    EXPECT_EQ_U(static_cast<int>(dash::myid() * 1000 + i), array.local[i]);
+  }
+  array.barrier();
+}
+
+TEST_F(WriteCombineBufferTest, PackScatteredWrites)
+{
+  const size_t elem_per_unit = 64;
+  dash::Array<int> array(elem_per_unit * dash::size());
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  dash::WriteCombineBuffer::set_capacity(4096);
+  dash::WriteCombineBuffer::reset_stats();
+
+  auto neighbor = (dash::myid() + 1) % dash::size();
+  auto g_offset = neighbor * elem_per_unit;
+  // Write every second element in descending order, then overwrite
+  // the first element:
+  for (size_t i = elem_per_unit; i > 0; i -= 2) {
+    array.async[g_offset + i - 2] = i - 2;
+  }
+  array.async[g_offset] = 1234;
+  dash::barrier();
+  EXPECT_FALSE_U(dash::WriteCombineBuffer::pending());
+
+  auto stats = dash::WriteCombineBuffer::stats();
+  EXPECT_EQ_U(elem_per_unit / 2 + 1, stats.num_writes);
+  EXPECT_EQ_U(1,                     stats.num_puts);
+  EXPECT_EQ_U(elem_per_unit / 2,     stats.num_blocks);
+  array.barrier();
+
+  EXPECT_EQ_U(1234, array.local[0]);
+  for (size_t i = 1; i < elem_per_unit; ++i) {
+    EXPECT_EQ_U((i % 2 == 0) ? static_cast<int>(i) : -1, array.local[i]);
+  }
+  array.barrier();
+}
+
+TEST_F(WriteCombineBufferTest, DrainFullBuffer)
+{
+  const size_t elem_per_unit = 64;
+  dash::Array<int> array(elem_per_unit * dash::size());
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  // Capacity of 8 elements:
+  dash::WriteCombineBuffer::set_capacity(8 * sizeof(int));
+  dash::WriteCombineBuffer::reset_stats();
+
+  for (size_t i = 0; i < elem_per_unit * dash::size(); ++i) {
+    if (i % dash::size() == static_cast<size_t>(dash::myid())) {
+      array.async[i] = i;
+    }
+  }
+  array.barrier();
+
+  auto stats = dash::WriteCombineBuffer::stats();
+  EXPECT_EQ_U(elem_per_unit, stats.num_writes);
+  if (dash::size() == 1) {
+    EXPECT_EQ_U(elem_per_unit / 8, stats.num_puts);
+    EXPECT_EQ_U(elem_per_unit / 8 - 1, stats.num_full_drains);
+  } else {
+    EXPECT_GT_U(stats.num_full_drains, 0);
+  }
+
+  for (size_t i = 0; i < elem_per_unit; ++i) {
+    EXPECT_EQ_U(static_cast<int>(array.pattern().global(i)),
+                array.local[i]);
+  }
+  array.barrier();
+
+  // Disabled write-combining:
+  dash::WriteCombineBuffer::set_capacity(0);
+  dash::WriteCombineBuffer::reset_stats();
+  array.async[0] = 42;
+  array.flush();
+  EXPECT_EQ_U(0, dash::WriteCombineBuffer::stats().num_writes);
+  EXPECT_FALSE_U(dash::WriteCombineBuffer::pending());
+  array.barrier();
+}
@@ -0,0 +1,30 @@
+#ifndef DASH__TEST__WRITE_COMBINE_BUFFER_TEST_H_
+#define DASH__TEST__WRITE_COMBINE_BUFFER_TEST_H_
+
+#include "../TestBase.h"
+
+#include <dash/memory/WriteCombineBuffer.h>
+
+#include <cstddef>
+
+/**
+ * Test fixture for class dash::WriteCombineBuffer
+ */
+class WriteCombineBufferTest : public dash::test::TestBase {
+ protected:
+  std::size_t _capacity = 0;
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    _capacity = dash::WriteCombineBuffer::capacity();
+  }
+
+  virtual void TearDown() {
+    // Restore the configured capacity for subsequent tests:
+    dash::WriteCombineBuffer::set_capacity(_capacity);
+    dash::WriteCombineBuffer::reset_stats();
+    dash::test::TestBase::TearDown();
+  }
+};
+
+#endif // DASH__TEST__WRITE_COMBINE_BUFFER_TEST_H_
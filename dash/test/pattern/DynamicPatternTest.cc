@@ -0,0 +1,98 @@
+
+#include "DynamicPatternTest.h"
+
+#include <dash/Array.h>
+#include <dash/pattern/DynamicPattern.h>
+
+
+TEST_F(DynamicPatternTest, Balance)
+{
+  typedef dash::DynamicPattern<1>      pattern_t;
+  typedef pattern_t::size_type         extent_t;
+
+  auto nunits = dash::size();
+
+  std::vector<extent_t> local_sizes;
+  extent_t              size = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    local_sizes.push_back((u + 1) * 7);
+    size += local_sizes.back();
+  }
+  pattern_t pattern(local_sizes);
+  ASSERT_EQ_U(size, pattern.size());
+
+  pattern.balance();
+  EXPECT_EQ_U(size, pattern.size());
+
+  extent_t lsize_sum = 0;
+  extent_t gbegin    = 0;
+  for (dash::team_unit_t u{0}; u < static_cast<int>(nunits); ++u) {
+    auto lsize = pattern.local_size(u);
+    EXPECT_GE_U(lsize, size / nunits);
+    EXPECT_LE_U(lsize, size / nunits + 1);
+    EXPECT_EQ_U(gbegin, pattern.global(u, 0));
+    lsize_sum += lsize;
+    gbegin    += lsize;
+  }
+  EXPECT_EQ_U(size, lsize_sum);
+  EXPECT_EQ_U(pattern.local_size(dash::team_unit_t(dash::myid())),
+              pattern.local_size());
+
+  // Unit 0 receives three times the number of elements of other units:
+  std::vector<double> weights(nunits, 1.0);
+  weights[0] = 3.0;
+  pattern.balance(weights);
+  EXPECT_EQ_U(size, pattern.size());
+  if (nunits > 1) {
+    auto lsize_0 = pattern.local_size(dash::team_unit_t{0});
+    auto lsize_1 = pattern.local_size(dash::team_unit_t{1});
+    EXPECT_GE_U(lsize_0 + 3, 3 * lsize_1);
+    EXPECT_LE_U(lsize_0, 3 * lsize_1 + 3);
+  }
+}
+
+TEST_F(DynamicPatternTest, RedistributeArray)
+{
+  typedef dash::DynamicPattern<1>      pattern_t;
+  typedef pattern_t::size_type         extent_t;
+  typedef pattern_t::index_type        index_t;
+  typedef int                          value_t;
+
+  auto myid   = dash::myid();
+  auto nunits = dash::size();
+
+  // All elements at unit 0:
+  std::vector<extent_t> local_sizes(nunits, 0);
+  local_sizes[0] = 100 * nunits + 3;
+
+  pattern_t pattern(local_sizes);
+  dash::Array<value_t, index_t, pattern_t> array(pattern);
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = static_cast<value_t>(pattern.global(l));
+  }
+  array.barrier();
+
+  auto balanced = array.pattern();
+  balanced.balance();
+  auto nbytes   = array.redistribute(balanced);
+
+  EXPECT_EQ_U(balanced.local_size(), array.lsize());
+  EXPECT_EQ_U(balanced.size(),       array.size());
+  if (myid == 0) {
+    EXPECT_EQ_U(0, nbytes);
+  } else {
+    EXPECT_EQ_U(array.lsize() * sizeof(value_t), nbytes);
+  }
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<value_t>(balanced.global(l)),
+                static_cast<value_t>(array.local[l]));
+  }
+  array.barrier();
+
+  for (size_t g = 0; g < array.size(); g += 17) {
+    EXPECT_EQ_U(static_cast<value_t>(g),
+                static_cast<value_t>(array[g]));
+  }
+  array.barrier();
+}
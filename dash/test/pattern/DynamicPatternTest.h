@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__DYNAMIC_PATTERN_TEST_H_
+#define DASH__TEST__DYNAMIC_PATTERN_TEST_H_
+
+#include "../TestBase.h"
+
+
+/**
+ * Test fixture for class dash::DynamicPattern
+ */
+class DynamicPatternTest : public dash::test::TestBase {
+protected:
+
+  DynamicPatternTest() {
+    LOG_MESSAGE(">>> Test suite: DynamicPatternTest");
+  }
+
+  virtual ~DynamicPatternTest() {
+    LOG_MESSAGE("<<< Closing test suite: DynamicPatternTest");
+  }
+};
+
+#endif // DASH__TEST__DYNAMIC_PATTERN_TEST_H_
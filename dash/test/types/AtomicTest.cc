@@ -721,3 +721,52 @@ TEST_F(AtomicTest, LongDouble){
   // array[0].compare_exchange(dash::size()*1.0, dash::myid()*1.0);
 
 }
+
+TEST_F(AtomicTest, BatchAdd){
+  using value_t = int;
+  using atom_t  = dash::Atomic<value_t>;
+  using array_t = dash::Array<atom_t>;
+
+  const size_t nbins = 7 * dash::size() + 3;
+  array_t histo(nbins);
+  for (size_t l = 0; l < histo.lsize(); ++l) {
+    histo[histo.pattern().global(l)].set(0);
+  }
+  histo.barrier();
+
+  // Every unit adds (unit + 1) to every bin, bins with even index are
+  // updated twice:
+  std::vector<size_t>  indices;
+  std::vector<value_t> values;
+  for (size_t b = nbins; b > 0; --b) {
+    indices.push_back(b - 1);
+    values.push_back(dash::myid() + 1);
+    if ((b - 1) % 2 == 0) {
+      indices.push_back(b - 1);
+      values.push_back(dash::myid() + 1);
+    }
+  }
+  dash::atomic::batch_add(histo, indices, values);
+  histo.barrier();
+
+  value_t unit_sum = (dash::size() * (dash::size() + 1)) / 2;
+  for (size_t l = 0; l < histo.lsize(); ++l) {
+    auto g_idx = histo.pattern().global(l);
+    value_t expected = (g_idx % 2 == 0) ? 2 * unit_sum : unit_sum;
+    EXPECT_EQ_U(expected, histo[g_idx].load());
+  }
+  histo.barrier();
+
+  // Batch operation with iterators and other operation:
+  std::vector<size_t>  max_indices { 0, nbins - 1 };
+  std::vector<value_t> max_values  { 1000 + dash::myid(), -1 };
+  dash::atomic::batch_op(histo, max_indices.begin(), max_indices.end(),
+                         max_values.begin(), dash::max<value_t>());
+  histo.barrier();
+
+  if (dash::myid() == 0) {
+    EXPECT_EQ_U(static_cast<value_t>(1000 + dash::size() - 1),
+                static_cast<value_t>(histo[0].load()));
+  }
+  histo.barrier();
+}
@@ -0,0 +1,76 @@
+#include "CommProfileTest.h"
+
+#include <dash/util/CommProfile.h>
+#include <dash/Array.h>
+
+#include <sstream>
+#include <string>
+
+
+TEST_F(CommProfileTest, CountGetsAndBarriers) {
+  using dash::util::CommProfile;
+
+  const size_t elem_per_unit = 4;
+  dash::Array<int> array(elem_per_unit * dash::size());
+  for (size_t l = 0; l < elem_per_unit; ++l) {
+    array.local[l] = dash::myid() * 100 + l;
+  }
+  array.barrier();
+
+  if (!CommProfile::on()) {
+    SKIP_TEST_MSG("DART has been built without profiling support");
+  }
+  ASSERT_TRUE_U(CommProfile::enabled());
+  CommProfile::reset();
+
+  dash::global_unit_t neighbor((dash::myid() + 1) % dash::size());
+  int value = array[neighbor.id * elem_per_unit + 1];
+  EXPECT_EQ_U(neighbor.id * 100 + 1, value);
+  dash::barrier();
+
+  CommProfile::off();
+  EXPECT_FALSE_U(CommProfile::enabled());
+
+  auto gets = CommProfile::counters(DART_PROFILE_OP_GET_BLOCKING);
+  EXPECT_EQ_U(1,           gets.num_calls);
+  EXPECT_EQ_U(sizeof(int), gets.num_bytes);
+  EXPECT_LE_U(gets.num_shmem, gets.num_calls);
+  EXPECT_LE_U(gets.max_ns,    gets.total_ns);
+  uint64_t hist_calls = 0;
+  for (int b = 0; b < DART_PROFILE_NUM_BINS; ++b) {
+    hist_calls += gets.latency_hist[b];
+  }
+  EXPECT_EQ_U(gets.num_calls, hist_calls);
+
+  auto unit_gets = CommProfile::counters(
+                     DART_PROFILE_OP_GET_BLOCKING, neighbor);
+  EXPECT_EQ_U(1,           unit_gets.num_calls);
+  EXPECT_EQ_U(sizeof(int), unit_gets.num_bytes);
+  if (dash::size() > 1) {
+    auto self_gets = CommProfile::counters(
+                       DART_PROFILE_OP_GET_BLOCKING, dash::myid());
+    EXPECT_EQ_U(0, self_gets.num_calls);
+  }
+
+  auto barriers = CommProfile::counters(DART_PROFILE_OP_BARRIER);
+  EXPECT_GE_U(barriers.num_calls, 1);
+  EXPECT_EQ_U(0, barriers.num_bytes);
+
+  // Collective operations are not profiled per unit:
+  EXPECT_THROW(
+    CommProfile::counters(DART_PROFILE_OP_BARRIER, neighbor),
+    dash::exception::InvalidArgument);
+
+  // Operations are not recorded while profiling is disabled:
+  dash::barrier();
+  EXPECT_EQ_U(barriers.num_calls,
+              CommProfile::counters(DART_PROFILE_OP_BARRIER).num_calls);
+
+  std::ostringstream os;
+  CommProfile::write(os);
+  EXPECT_NE_U(std::string::npos, os.str().find("dart_get_blocking"));
+
+  CommProfile::reset();
+  EXPECT_EQ_U(0, CommProfile::counters(
+                   DART_PROFILE_OP_GET_BLOCKING).num_calls);
+}
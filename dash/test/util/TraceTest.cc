@@ -0,0 +1,155 @@
+#include "TraceTest.h"
+
+#include <dash/util/Trace.h>
+#include <dash/util/Config.h>
+
+#include <sstream>
+#include <string>
+
+
+TEST_F(TraceTest, EventBufferOverflow) {
+  DASH_TEST_LOCAL_ONLY();
+
+  using dash::util::TraceStore;
+
+  TraceStore::event_buffer buffer(10, 0);
+  TraceStore::trace_event_t event;
+  event.state   = 0;
+  event.context = 0;
+  event.phase   = TraceStore::event_phase::enter;
+  for (int e = 0; e < 5; ++e) {
+    event.ts = e;
+    buffer.push(event);
+  }
+  // Capacity is rounded down to power of two:
+  EXPECT_EQ_U(5, buffer.size());
+  EXPECT_EQ_U(0, buffer.dropped());
+  for (int e = 5; e < 20; ++e) {
+    event.ts = e;
+    buffer.push(event);
+  }
+  EXPECT_EQ_U(8,  buffer.size());
+  EXPECT_EQ_U(12, buffer.dropped());
+  for (size_t e = 0; e < buffer.size(); ++e) {
+    EXPECT_EQ_U(12 + e, buffer[e].ts);
+  }
+  buffer.clear();
+  EXPECT_EQ_U(0, buffer.size());
+}
+
+TEST_F(TraceTest, StateTimespans) {
+  using dash::util::Config;
+  using dash::util::TraceStore;
+
+  bool trace_enabled = Config::get<bool>("DASH_ENABLE_TRACE");
+  Config::set("DASH_ENABLE_TRACE", true);
+  ASSERT_TRUE_U(TraceStore::on());
+  TraceStore::clear();
+
+  dash::util::Trace trace("TraceTest.StateTimespans");
+  auto state_inner = dash::util::Trace::state("inner");
+  trace.enter_state("outer");
+  trace.enter_state(state_inner);
+  trace.exit_state("inner");
+  trace.exit_state("outer");
+  // Unmatched exit is ignored:
+  trace.exit_state("outer");
+
+  TraceStore::off();
+  // Events are not recorded while tracing is disabled:
+  trace.enter_state("disabled");
+  trace.exit_state("disabled");
+
+  EXPECT_EQ_U("inner", TraceStore::state_name(state_inner));
+
+  auto spans = TraceStore::context_trace("TraceTest.StateTimespans");
+  ASSERT_EQ_U(2, spans.size());
+  EXPECT_EQ_U("outer", spans[0].state);
+  EXPECT_EQ_U("inner", spans[1].state);
+  EXPECT_LE_U(spans[0].start, spans[1].start);
+  EXPECT_LE_U(spans[1].start, spans[1].end);
+  EXPECT_LE_U(spans[1].end,   spans[0].end);
+
+  TraceStore::clear("TraceTest.StateTimespans");
+  EXPECT_EQ_U(0, TraceStore::context_trace(
+                   "TraceTest.StateTimespans").size());
+
+  Config::set("DASH_ENABLE_TRACE", trace_enabled);
+}
+
+TEST_F(TraceTest, InternedStates) {
+  using dash::util::Config;
+  using dash::util::TraceStore;
+
+  bool trace_enabled = Config::get<bool>("DASH_ENABLE_TRACE");
+  Config::set("DASH_ENABLE_TRACE", true);
+  ASSERT_TRUE_U(TraceStore::on());
+  TraceStore::clear();
+
+  auto context = dash::util::Trace::state("TraceTest.InternedStates");
+  auto state   = dash::util::Trace::state("nested");
+  dash::util::Trace trace(context);
+  // States nested deeper than 16 levels are not recorded:
+  for (int d = 0; d < 20; ++d) {
+    trace.enter_state(state);
+  }
+  for (int d = 0; d < 20; ++d) {
+    trace.exit_state(state);
+  }
+  TraceStore::off();
+
+  auto spans = TraceStore::context_trace("TraceTest.InternedStates");
+  EXPECT_EQ_U(16, spans.size());
+  for (const auto & span : spans) {
+    EXPECT_EQ_U("nested", span.state);
+  }
+  TraceStore::clear();
+  Config::set("DASH_ENABLE_TRACE", trace_enabled);
+}
+
+TEST_F(TraceTest, ChromeJson) {
+  using dash::util::Config;
+  using dash::util::TraceStore;
+
+  bool trace_enabled = Config::get<bool>("DASH_ENABLE_TRACE");
+  Config::set("DASH_ENABLE_TRACE", true);
+  ASSERT_TRUE_U(TraceStore::on());
+  TraceStore::clear();
+
+  {
+    dash::util::Trace trace("TraceTest.ChromeJson");
+    trace.enter_state("phase \"1\"");
+    trace.exit_state("phase \"1\"");
+    trace.enter_state("phase 2");
+    dash::barrier();
+    trace.exit_state("phase 2");
+  }
+  TraceStore::off();
+
+  std::ostringstream os;
+  TraceStore::write_chrome_json(os);
+  TraceStore::clear();
+  Config::set("DASH_ENABLE_TRACE", trace_enabled);
+
+  if (dash::myid() != 0) {
+    EXPECT_TRUE_U(os.str().empty());
+    return;
+  }
+  std::string json = os.str();
+  EXPECT_EQ_U(0, json.find("{\"traceEvents\":["));
+  EXPECT_EQ_U(std::string::npos, json.find("[,"));
+  EXPECT_EQ_U(std::string::npos, json.find(",\n]"));
+  size_t nspans = 0;
+  for (auto pos = json.find("\"ph\":\"X\"");
+       pos != std::string::npos;
+       pos = json.find("\"ph\":\"X\"", pos + 1)) {
+    ++nspans;
+  }
+  EXPECT_EQ_U(2 * dash::size(), nspans);
+  EXPECT_NE_U(std::string::npos, json.find("\"name\":\"phase \\\"1\\\"\""));
+  for (size_t u = 0; u < dash::size(); ++u) {
+    std::ostringstream unit_name;
+    unit_name << "\"name\":\"unit " << u << "\"";
+    EXPECT_NE_U(std::string::npos, json.find(unit_name.str()));
+  }
+}